@@ -5,6 +5,7 @@
 //
 
 #import <Foundation/Foundation.h>
+#include <pthread.h>
 
 // declare C classes, the following idea is from 
 // http://www.zedkep.com/blog/index.php?/archives/247-Forward-declaring-C++-classes-in-Objective-C.html
@@ -12,11 +13,37 @@ struct PDFDoc;
 typedef struct PDFDoc PDFDoc;
 struct TextPage;
 typedef struct TextPage TextPage;
+struct TextSelection;
+typedef struct TextSelection TextSelection;
 
 @interface PDFTextLib : NSObject {
 	PDFDoc *doc;
 	TextPage **pages;
 	int numPages;
+	NSString *fileName;
+	NSString *layoutCacheDir;
+	
+	// pages are kept in an LRU list, most recently used first
+	size_t cacheBudget;
+	size_t cacheBytes;
+	size_t *pageBytes;
+	int *lruPrev, *lruNext;
+	int lruHead, lruTail;
+	TextSelection *selections;	// selections of released pages
+	
+	// neighbouring pages are built ahead on a background thread
+	NSCondition *prefetchCond;	// guards the fields below and changes to pages
+	pthread_t prefetchThread;
+	BOOL prefetchRunning;
+	volatile BOOL prefetchStop;
+	volatile int prefetchWindow;
+	volatile int prefetchCenter;	// last touched page
+	volatile int prefetchBuilding;	// page being built ahead, or -1
+	volatile int selfBuilding;	// page being built by touchPage, or -1
+	TextPage **prefetched;		// pages built ahead and not touched yet
+	char *prefetchFailed;
+	
+	double pageTimeLimit;		// seconds per page build, or 0
 	
 	CGMutablePathRef selectPath;
 	CGMutablePathRef searchPath;
@@ -29,10 +56,56 @@ typedef struct TextPage TextPage;
 // Please call this after all [PDFTextLib release]
 + (void)globalRelease;
 
+// Compile the CMap and cidToUnicode files of poppler-data into dir, skipping the
+// ones that are up to date, and use them from then on: they are mapped read-only
+// and shared by all documents instead of being parsed. Run it as a build step (dir
+// is then "poppler-data/compiled" in the bundle, which is used by default) or at
+// first launch with a writable dir. Call it after globalInit.
+// Return NO if some file couldn't be compiled.
++ (BOOL)compileEncodingDataToDirectory:(NSString *)dir;
+
 - (id)initWithFilename:(NSString *)filename;
 
 - (id)initWithFilenameAndPassword:(NSString *)filename userPW:(NSString *)userPW ownerPW:(NSString *)ownerPW;
 
+// Save the layout of each page into dir once it is built, and load it from there
+// instead of parsing the page when the same file is opened again. Entries are
+// named after the file's full path and only used while its size, modification
+// time and document ID still match. Pass nil to turn this off (the default).
+- (void)setLayoutCacheDirectory:(NSString *)dir;
+
+// Limit the memory held by page layouts to about bytes. The least recently used
+// pages beyond that are released and rebuilt when touched again, keeping their
+// selections. The default is 16 MB; 0 means no limit.
+- (void)setPageCacheBudget:(size_t)bytes;
+
+// Build up to window pages on each side of the last touched page on a background
+// thread, so that they are ready when touched. Work for pages that fall out of the
+// window is cancelled. The default is 0, i.e. no prefetching.
+- (void)setPrefetchWindow:(int)window;
+
+// Stop interpreting a page after the given number of seconds (0, the default, means
+// no limit). The text found so far is still usable; see isPageComplete:.
+- (void)setPageTimeLimit:(double)seconds;
+
+// NO if the page was loaded and its build was stopped by the time limit.
+- (BOOL)isPageComplete:(NSInteger)pageNum;
+
+// Decode all compressed object streams of the document on all processors, so that
+// later page builds only look objects up. Call this right after opening the document;
+// it only pays off for PDF 1.5+ files with many object streams.
+- (void)preloadObjectStreams;
+
+// Write every image drawn in the document into dir, one file per image: JPEG and
+// JPEG 2000 images as they are stored in the PDF (.jpg, .jp2), all others decoded
+// (.pgm, .ppm). An image drawn more than once is written once. Masks are written
+// as separate images, black where painted.
+// Return an array with a dictionary for each image drawn, with the keys "file",
+// "page", "mask" and "x", "y", "width", "height": the bounding box on the page, in
+// points from the top left. nil on error.
+// Autorelease.
+- (NSArray *)exportImagesToDirectory:(NSString *)dir;
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Selection Functions                                                        //
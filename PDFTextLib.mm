@@ -8,12 +8,115 @@
 #include "Page.h"
 #include "PDFDoc.h"
 #include "TextOutputDev.h"
+#include "ImageOutputDev.h"
 #include "GlobalParams.h"
 #include "gmem.h"
 #include "Object.h"
 
 #import "PDFTextLib.h"
 
+#define defaultPageCacheBudget (16 << 20)
+
+@interface PDFTextLib (Prefetch)
+- (void)prefetchLoop;
+- (BOOL)prefetchShouldAbort;
+@end
+
+static void *prefetchMain(void *data)
+{
+	[(PDFTextLib *)data prefetchLoop];
+	return NULL;
+}
+
+static GBool prefetchAbortCheck(void *data)
+{
+	return [(PDFTextLib *)data prefetchShouldAbort] ? gTrue : gFalse;
+}
+
+// Name of the layout cache file for a page: the file name for people looking
+// in the directory, and a hash of the full path so that files with the same
+// name in different folders don't share entries.
+static NSString *layoutCacheName(NSString *path, int pageNum)
+{
+	const char *p = [[[path stringByResolvingSymlinksInPath] stringByStandardizingPath] fileSystemRepresentation];
+	unsigned long long h = 14695981039346656037ULL;
+	for (; *p; ++p)
+		h = (h ^ (unsigned char)*p) * 1099511628211ULL;
+	return [NSString stringWithFormat:@"%@.%016llx.%d.layout", [path lastPathComponent], h, pageNum];
+}
+
+// Writes each image to its own file and records where it was drawn.
+class FileImageSink : public ImageSink {
+public:
+	FileImageSink(NSString *dirA)
+	{
+		dir = dirA;
+		images = [NSMutableArray array];
+		written = [NSMutableDictionary dictionary];
+		f = NULL;
+		nFiles = 0;
+		ok = YES;
+	}
+	
+	virtual GBool startImage(ImageInfo *info)
+	{
+		NSString *key = nil, *name;
+		if (info->num >= 0) {
+			key = [NSString stringWithFormat:@"%d %d %d", info->num, info->gen, (int)info->kind];
+			name = [written objectForKey:key];
+		}
+		else
+			name = nil;
+		GBool copy = name == nil;
+		if (copy) {
+			NSString *ext;
+			if (info->format == imageFormatJPEG) ext = @"jpg";
+			else if (info->format == imageFormatJPX) ext = @"jp2";
+			else ext = info->nComps == 1 ? @"pgm" : @"ppm";
+			name = [NSString stringWithFormat:@"image-%d.%@", ++nFiles, ext];
+			if (key) [written setObject:name forKey:key];
+			f = fopen([[dir stringByAppendingPathComponent:name] fileSystemRepresentation], "wb");
+			if (!f) {
+				ok = NO;
+				copy = gFalse;
+			}
+			else if (info->format == imageFormatPixels)
+				fprintf(f, "P%c\n%d %d\n255\n", info->nComps == 1 ? '5' : '6', info->width, info->height);
+		}
+		[images addObject:[NSDictionary dictionaryWithObjectsAndKeys:
+						   name, @"file",
+						   [NSNumber numberWithInt:info->pageNum], @"page",
+						   [NSNumber numberWithBool:info->kind != imageKindImage], @"mask",
+						   [NSNumber numberWithDouble:info->xMin], @"x",
+						   [NSNumber numberWithDouble:info->yMin], @"y",
+						   [NSNumber numberWithDouble:info->xMax - info->xMin], @"width",
+						   [NSNumber numberWithDouble:info->yMax - info->yMin], @"height",
+						   nil]];
+		return copy;
+	}
+	
+	virtual void writeImageData(Guchar *data, int len)
+	{
+		if (fwrite(data, 1, len, f) != (size_t)len) ok = NO;
+	}
+	
+	virtual void endImage()
+	{
+		if (fclose(f) != 0) ok = NO;
+		f = NULL;
+	}
+	
+	NSArray *getImages() { return ok ? images : nil; }
+	
+private:
+	NSString *dir;
+	NSMutableArray *images;
+	NSMutableDictionary *written;	// file names by "num gen kind"
+	FILE *f;
+	int nFiles;
+	BOOL ok;
+};
+
 @implementation PDFTextLib
 
 + (void)globalInit
@@ -32,6 +135,12 @@
 #endif
 }
 
++ (BOOL)compileEncodingDataToDirectory:(NSString *)dir
+{
+	globalParams->setCompiledDataDir([dir fileSystemRepresentation]);
+	return globalParams->compileEncodingData();
+}
+
 - (id)initWithFilename:(NSString *)filename
 {
 	return [self initWithFilenameAndPassword:filename userPW:nil ownerPW:nil];
@@ -47,41 +156,306 @@
 		[self release];
 		return nil;
 	}
+	fileName = [filename copy];
 	numPages = doc->getNumPages();
 	pages = new TextPage *[numPages];
-	for (int i = 0; i < numPages; ++i)
+	pageBytes = new size_t[numPages];
+	lruPrev = new int[numPages];
+	lruNext = new int[numPages];
+	selections = new TextSelection[numPages];
+	prefetched = new TextPage *[numPages];
+	prefetchFailed = new char[numPages];
+	for (int i = 0; i < numPages; ++i) {
 		pages[i] = NULL;
+		selections[i].startWord = -1;
+		prefetched[i] = NULL;
+		prefetchFailed[i] = 0;
+	}
+	lruHead = lruTail = -1;
+	cacheBytes = 0;
+	cacheBudget = defaultPageCacheBudget;
+	prefetchCond = [[NSCondition alloc] init];
+	prefetchWindow = 0;
+	prefetchCenter = 0;
+	prefetchBuilding = -1;
+	selfBuilding = -1;
+	pageTimeLimit = 0;
 	return self;
 }
 
 - (void)dealloc
 {
+	if (prefetchRunning) {
+		[prefetchCond lock];
+		prefetchStop = YES;
+		[prefetchCond broadcast];
+		[prefetchCond unlock];
+		pthread_join(prefetchThread, NULL);
+	}
+	[prefetchCond release];
 	if (pages) {
-		for (int i = 0; i < numPages; ++i)
+		for (int i = 0; i < numPages; ++i) {
 			if (pages[i]) delete pages[i];
+			if (prefetched[i]) delete prefetched[i];
+		}
 		delete [] pages;
+		delete [] pageBytes;
+		delete [] lruPrev;
+		delete [] lruNext;
+		delete [] selections;
+		delete [] prefetched;
+		delete [] prefetchFailed;
 	}
 	if (doc) delete doc;
+	[fileName release];
+	[layoutCacheDir release];
 	
 	CGPathRelease(selectPath);
 	CGPathRelease(searchPath);
 	[super dealloc];
 }
 
+- (void)setLayoutCacheDirectory:(NSString *)dir
+{
+	[prefetchCond lock];
+	[layoutCacheDir release];
+	layoutCacheDir = [dir copy];
+	[prefetchCond unlock];
+}
+
+- (void)setPageCacheBudget:(size_t)bytes
+{
+	cacheBudget = bytes;
+	[self trimPageCache];
+}
+
+- (void)setPrefetchWindow:(int)window
+{
+	[prefetchCond lock];
+	prefetchWindow = window > 0 ? window : 0;
+	[prefetchCond signal];
+	[prefetchCond unlock];
+	if (prefetchWindow > 0 && !prefetchRunning)
+		prefetchRunning = pthread_create(&prefetchThread, NULL, &prefetchMain, self) == 0;
+}
+
+- (void)setPageTimeLimit:(double)seconds
+{
+	pageTimeLimit = seconds;
+}
+
+- (BOOL)isPageComplete:(NSInteger)pageNum
+{
+	if (pageNum <= 0 || pageNum > numPages)
+		return NO;
+	TextPage *page = pages[pageNum - 1];
+	return !page || page->isComplete();
+}
+
+- (void)preloadObjectStreams
+{
+	doc->preloadObjectStreams((int)[[NSProcessInfo processInfo] activeProcessorCount]);
+}
+
+- (NSArray *)exportImagesToDirectory:(NSString *)dir
+{
+	FileImageSink sink(dir);
+	ImageOutputDev *out = new ImageOutputDev(&sink);
+	for (int i = 0; i < numPages; ++i) {
+		// keep the background build off the document meanwhile
+		[prefetchCond lock];
+		selfBuilding = i;
+		while (prefetchBuilding >= 0)
+			[prefetchCond wait];
+		[prefetchCond unlock];
+		
+		doc->displayPage(out, i + 1, 72, 72, 0, gTrue, gFalse, gFalse);
+		
+		[prefetchCond lock];
+		selfBuilding = -1;
+		[prefetchCond signal];
+		[prefetchCond unlock];
+	}
+	delete out;
+	return sink.getImages();
+}
+
+- (BOOL)isInPrefetchWindow:(int)i
+{
+	return i >= prefetchCenter - prefetchWindow && i <= prefetchCenter + prefetchWindow;
+}
+
+// Called with prefetchCond locked. Returns the next page to build ahead, or -1.
+- (int)nextPrefetchTarget
+{
+	// drop pages built for a window that has moved away
+	for (int i = 0; i < numPages; ++i)
+		if (prefetched[i] && ![self isInPrefetchWindow:i]) {
+			delete prefetched[i];
+			prefetched[i] = NULL;
+		}
+	if (selfBuilding >= 0)
+		return -1;
+	for (int d = 1; d <= prefetchWindow; ++d) {
+		int i = prefetchCenter + d;
+		if (i < numPages && !pages[i] && !prefetched[i] && !prefetchFailed[i])
+			return i;
+		i = prefetchCenter - d;
+		if (i >= 0 && !pages[i] && !prefetched[i] && !prefetchFailed[i])
+			return i;
+	}
+	return -1;
+}
+
+// The background build gives way when the window moves past it, or when
+// touchPage: needs the document for a page of its own.
+- (BOOL)prefetchShouldAbort
+{
+	return prefetchStop || selfBuilding >= 0 || ![self isInPrefetchWindow:prefetchBuilding];
+}
+
+- (void)prefetchLoop
+{
+	[prefetchCond lock];
+	while (!prefetchStop) {
+		int i = [self nextPrefetchTarget];
+		if (i < 0) {
+			[prefetchCond wait];
+			continue;
+		}
+		prefetchBuilding = i;
+		NSString *dir = [layoutCacheDir retain];
+		[prefetchCond unlock];
+		
+		NSAutoreleasePool *pool = [[NSAutoreleasePool alloc] init];
+		TextPage *page = [self buildPage:i + 1 cacheDir:dir inBackground:YES];
+		[pool release];
+		[dir release];
+		
+		[prefetchCond lock];
+		if (page) {
+			// publish only complete pages that are still wanted
+			if (!pages[i] && [self isInPrefetchWindow:i]) prefetched[i] = page;
+			else delete page;
+		}
+		else if (![self prefetchShouldAbort])
+			prefetchFailed[i] = 1;
+		prefetchBuilding = -1;
+		[prefetchCond broadcast];
+	}
+	[prefetchCond unlock];
+}
+
+- (TextPage *)buildPage:(int)pageNum cacheDir:(NSString *)dir inBackground:(BOOL)background
+{
+	TextPage *page = NULL;
+	const char *cacheFile = NULL;
+	if (dir) {
+		cacheFile = [[dir stringByAppendingPathComponent:layoutCacheName(fileName, pageNum)] fileSystemRepresentation];
+		page = new TextPage(cacheFile, doc, pageNum);
+		if (page->isOk()) return page;
+		delete page;
+	}
+	if (background) {
+		// a page cut short by a cancel is of no use
+		page = new TextPage(doc, pageNum, 0, 0, &prefetchAbortCheck, self);
+		if (!page->isComplete()) {
+			delete page;
+			return NULL;
+		}
+	}
+	else
+		page = new TextPage(doc, pageNum, pageTimeLimit);
+	if (!page->isOk()) {
+		if (!background) printf("Error on page %d.\n", pageNum);
+		delete page;
+		return NULL;
+	}
+	if (cacheFile)
+		page->writeCache(cacheFile, doc, pageNum);
+	return page;
+}
+
+- (void)unlinkPage:(int)i
+{
+	if (lruPrev[i] >= 0) lruNext[lruPrev[i]] = lruNext[i];
+	else lruHead = lruNext[i];
+	if (lruNext[i] >= 0) lruPrev[lruNext[i]] = lruPrev[i];
+	else lruTail = lruPrev[i];
+}
+
+// Release least recently used pages until the budget is met. The most recently
+// used page is always kept.
+- (void)trimPageCache
+{
+	[prefetchCond lock];
+	while (cacheBudget && cacheBytes > cacheBudget && lruTail != lruHead) {
+		int i = lruTail;
+		[self unlinkPage:i];
+		if (!pages[i]->getSelection(&selections[i]))
+			selections[i].startWord = -1;
+		cacheBytes -= pageBytes[i];
+		delete pages[i];
+		pages[i] = NULL;
+	}
+	[prefetchCond unlock];
+}
+
 - (TextPage *)touchPage:(NSInteger)pageNum
 {
 	if (pageNum <= 0 || pageNum > numPages)
 		return NULL;
-	if (pages[pageNum - 1] == NULL) {
-		pages[pageNum - 1] = new TextPage(doc, pageNum);
-		if (!pages[pageNum - 1]->isOk()) {
-			printf("Error on page %d.\n", (int)pageNum);
-			delete pages[pageNum - 1];
-			pages[pageNum - 1] = NULL;
+	int i = (int)pageNum - 1;
+	if (pages[i] == NULL) {
+		TextPage *page;
+		[prefetchCond lock];
+		prefetchCenter = i;
+		while (prefetchBuilding == i)
+			[prefetchCond wait];
+		if ((page = prefetched[i]))
+			prefetched[i] = NULL;
+		else
+			selfBuilding = i;
+		[prefetchCond unlock];
+		
+		if (!page)
+			page = [self buildPage:(int)pageNum cacheDir:layoutCacheDir inBackground:NO];
+		
+		[prefetchCond lock];
+		pages[i] = page;
+		selfBuilding = -1;
+		[prefetchCond signal];
+		[prefetchCond unlock];
+		if (!page)
 			return NULL;
+		if (selections[i].startWord >= 0) {
+			pages[i]->setSelection(&selections[i]);
+			selections[i].startWord = -1;
+		}
+		pageBytes[i] = 0;
+	}
+	else {
+		[self unlinkPage:i];
+		if (prefetchCenter != i) {
+			[prefetchCond lock];
+			prefetchCenter = i;
+			[prefetchCond signal];
+			[prefetchCond unlock];
 		}
 	}
-	return pages[pageNum - 1];
+	
+	// move to the front of the LRU list
+	lruPrev[i] = -1;
+	lruNext[i] = lruHead;
+	if (lruHead >= 0) lruPrev[lruHead] = i;
+	else lruTail = i;
+	lruHead = i;
+	
+	// the footprint grows as words get normalized for searching
+	cacheBytes += pages[i]->getMemoryUsage() - pageBytes[i];
+	pageBytes[i] = pages[i]->getMemoryUsage();
+	[self trimPageCache];
+	return pages[i];
 }
 
 - (void)setBeginCoordinate:(double)x andY:(double)y onPage:(NSInteger)pageNum
@@ -0,0 +1,44 @@
+//========================================================================
+//
+// GooTimer.cc
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifdef USE_GCC_PRAGMAS
+#pragma implementation
+#endif
+
+#include <stddef.h>
+#include "GooTimer.h"
+
+//------------------------------------------------------------------------
+// GooTimer
+//------------------------------------------------------------------------
+
+GooTimer::GooTimer() {
+  start();
+}
+
+void GooTimer::start() {
+  gettimeofday(&startTime, NULL);
+  active = gTrue;
+}
+
+void GooTimer::stop() {
+  gettimeofday(&endTime, NULL);
+  active = gFalse;
+}
+
+double GooTimer::getElapsed() {
+  struct timeval now;
+
+  if (active) {
+    gettimeofday(&now, NULL);
+  } else {
+    now = endTime;
+  }
+  return (now.tv_sec - startTime.tv_sec) +
+         (now.tv_usec - startTime.tv_usec) * 1e-6;
+}
@@ -0,0 +1,43 @@
+//========================================================================
+//
+// GooTimer.h
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef GOOTIMER_H
+#define GOOTIMER_H
+
+#ifdef USE_GCC_PRAGMAS
+#pragma interface
+#endif
+
+#include "gtypes.h"
+#include <sys/time.h>
+
+//------------------------------------------------------------------------
+// GooTimer
+//------------------------------------------------------------------------
+
+// Wall clock stopwatch with microsecond resolution.
+class GooTimer {
+public:
+
+  // Create a running timer.
+  GooTimer();
+
+  void start();
+  void stop();
+
+  // Seconds since start(), up to stop() if the timer was stopped.
+  double getElapsed();
+
+private:
+
+  GBool active;
+  struct timeval startTime;
+  struct timeval endTime;
+};
+
+#endif
@@ -35,6 +35,7 @@ typedef struct _GMemHdr {
   unsigned int magic;
   int size;
   int index;
+  int tag;
   struct _GMemHdr *next, *prev;
 } GMemHdr;
 
@@ -60,8 +61,52 @@ static int gMemIndex = 0;
 static int gMemAlloc = 0;
 static int gMemInUse = 0;
 
+#if MULTITHREADED
+#include <pthread.h>
+// allocations can happen before any init code runs, so this is initialized
+// statically rather than with gInitMutex
+static pthread_mutex_t gMemMutex = PTHREAD_MUTEX_INITIALIZER;
+#  define lockGMem   pthread_mutex_lock(&gMemMutex)
+#  define unlockGMem pthread_mutex_unlock(&gMemMutex)
+#else
+#  define lockGMem
+#  define unlockGMem
+#endif
+
+#else /* DEBUG_MEM */
+
+#ifdef __APPLE__
+#include <malloc/malloc.h>
+#  define gMemBlockSize(p) malloc_size(p)
+#else
+#include <malloc.h>
+#  define gMemBlockSize(p) malloc_usable_size(p)
+#endif
+
+/*
+ * Each block asks malloc for one spare byte and keeps its tag in the
+ * last byte malloc actually gave it, which is usually slack from the
+ * rounding malloc does anyway. The counters use the block size that
+ * malloc reports, so no size has to be stored.
+ */
+#define gMemBlockTag(p, n) (((unsigned char *)(p))[(n) - 1])
+
 #endif /* DEBUG_MEM */
 
+/* allocation counters per tag */
+static size_t gMemAllocated[gMemNumTags];
+static size_t gMemLive[gMemNumTags];
+
+#if MULTITHREADED
+static __thread int gMemTag = gMemTagOther;
+#  define gMemAdd(var, n) __sync_fetch_and_add(&(var), (size_t)(n))
+#  define gMemSub(var, n) __sync_fetch_and_sub(&(var), (size_t)(n))
+#else
+static int gMemTag = gMemTagOther;
+#  define gMemAdd(var, n) ((var) += (size_t)(n))
+#  define gMemSub(var, n) ((var) -= (size_t)(n))
+#endif
+
 inline static void *gmalloc(size_t size, bool checkoverflow) {
 #ifdef DEBUG_MEM
   int size1;
@@ -84,6 +129,10 @@ inline static void *gmalloc(size_t size, bool checkoverflow) {
   trl = (unsigned long *)(mem + gMemHdrSize + size1);
   hdr->magic = gMemMagic;
   hdr->size = size;
+  hdr->tag = gMemTag;
+  gMemAdd(gMemAllocated[hdr->tag], size);
+  gMemAdd(gMemLive[hdr->tag], size);
+  lockGMem;
   hdr->index = gMemIndex++;
   if (gMemTail) {
     gMemTail->next = hdr;
@@ -96,21 +145,27 @@ inline static void *gmalloc(size_t size, bool checkoverflow) {
   hdr->next = NULL;
   ++gMemAlloc;
   gMemInUse += size;
+  unlockGMem;
   for (p = (unsigned long *)data; p <= trl; ++p) {
     *p = gMemDeadVal;
   }
   return data;
 #else
   void *p;
+  size_t n;
 
   if (size <= 0) {
     return NULL;
   }
-  if (!(p = malloc(size))) {
+  if (size == (size_t)-1 || !(p = malloc(size + 1))) {
     fprintf(stderr, "Out of memory\n");
     if (checkoverflow) return NULL;
     else exit(1);
   }
+  n = gMemBlockSize(p);
+  gMemBlockTag(p, n) = (unsigned char)gMemTag;
+  gMemAdd(gMemAllocated[gMemTag], n);
+  gMemAdd(gMemLive[gMemTag], n);
   return p;
 #endif
 }
@@ -127,7 +182,8 @@ inline static void *grealloc(void *p, size_t size, bool checkoverflow) {
 #ifdef DEBUG_MEM
   GMemHdr *hdr;
   void *q;
-  int oldSize;
+  size_t oldSize;
+  int oldTag;
 
   if (size <= 0) {
     if (p) {
@@ -137,8 +193,15 @@ inline static void *grealloc(void *p, size_t size, bool checkoverflow) {
   }
   if (p) {
     hdr = (GMemHdr *)((char *)p - gMemHdrSize);
-    oldSize = hdr->size;
+    oldSize = (size_t)hdr->size;
+    // the block keeps its tag, and only growth counts as allocated
+    oldTag = gMemSetTag(hdr->tag);
     q = gmalloc(size, checkoverflow);
+    gMemSetTag(oldTag);
+    if (!q) {
+      return NULL;
+    }
+    gMemSub(gMemAllocated[hdr->tag], size < oldSize ? size : oldSize);
     memcpy(q, p, size < oldSize ? size : oldSize);
     gfree(p);
   } else {
@@ -147,23 +210,39 @@ inline static void *grealloc(void *p, size_t size, bool checkoverflow) {
   return q;
 #else
   void *q;
+  size_t oldSize, n;
+  int tag;
 
   if (size <= 0) {
     if (p) {
-      free(p);
+      gfree(p);
     }
     return NULL;
   }
   if (p) {
-    q = realloc(p, size);
+    oldSize = gMemBlockSize(p);
+    tag = gMemBlockTag(p, oldSize);
+    if (tag >= gMemNumTags) {
+      tag = gMemTagOther;
+    }
   } else {
-    q = malloc(size);
+    oldSize = 0;
+    tag = gMemTag;
   }
-  if (!q) {
+  if (size == (size_t)-1 || !(q = realloc(p, size + 1))) {
     fprintf(stderr, "Out of memory\n");
     if (checkoverflow) return NULL;
     else exit(1);
   }
+  n = gMemBlockSize(q);
+  gMemBlockTag(q, n) = (unsigned char)tag;
+  // the block keeps its tag, and only growth counts as allocated
+  if (n > oldSize) {
+    gMemAdd(gMemAllocated[tag], n - oldSize);
+    gMemAdd(gMemLive[tag], n - oldSize);
+  } else {
+    gMemSub(gMemLive[tag], oldSize - n);
+  }
   return q;
 #endif
 }
@@ -255,6 +334,7 @@ void gfree(void *p) {
 
   if (p) {
     hdr = (GMemHdr *)((char *)p - gMemHdrSize);
+    lockGMem;
     if (hdr->magic == gMemMagic &&
 	((hdr->prev == NULL) == (hdr == gMemHead)) &&
 	((hdr->next == NULL) == (hdr == gMemTail))) {
@@ -270,6 +350,8 @@ void gfree(void *p) {
       }
       --gMemAlloc;
       gMemInUse -= hdr->size;
+      unlockGMem;
+      gMemSub(gMemLive[hdr->tag], hdr->size);
       size = gMemDataSize(hdr->size);
       trl = (unsigned long *)((char *)hdr + gMemHdrSize + size);
       if (*trl != gMemDeadVal) {
@@ -281,20 +363,51 @@ void gfree(void *p) {
       }
       free(hdr);
     } else {
+      unlockGMem;
       fprintf(stderr, "Attempted to free bad address %p\n", p);
     }
   }
 #else
+  size_t n;
+  int tag;
+
   if (p) {
+    n = gMemBlockSize(p);
+    tag = gMemBlockTag(p, n);
+    if (tag >= gMemNumTags) {
+      tag = gMemTagOther;
+    }
+    gMemSub(gMemLive[tag], n);
     free(p);
   }
 #endif
 }
 
+int gMemSetTag(int tag) {
+  int oldTag;
+
+  oldTag = gMemTag;
+  gMemTag = (tag >= 0 && tag < gMemNumTags) ? tag : gMemTagOther;
+  return oldTag;
+}
+
+void gMemGetCounters(int tag, size_t *allocated, size_t *live) {
+  if (tag < 0 || tag >= gMemNumTags) {
+    tag = gMemTagOther;
+  }
+  if (allocated) {
+    *allocated = gMemAllocated[tag];
+  }
+  if (live) {
+    *live = gMemLive[tag];
+  }
+}
+
 #ifdef DEBUG_MEM
 void gMemReport(FILE *f) {
   GMemHdr *p;
 
+  lockGMem;
   fprintf(f, "%d memory allocations in all\n", gMemIndex);
   if (gMemAlloc > 0) {
     fprintf(f, "%d memory blocks left allocated:\n", gMemAlloc);
@@ -306,6 +419,7 @@ void gMemReport(FILE *f) {
   } else {
     fprintf(f, "No memory blocks left allocated\n");
   }
+  unlockGMem;
 }
 #endif
 
@@ -74,6 +74,36 @@ extern void gMemReport(FILE *f);
 #define gMemReport(f)
 #endif
 
+/*
+ * Allocation counters. Each block from the functions above is charged
+ * to the subsystem tag that is current in the allocating thread, and
+ * credited back to the same tag when it is freed or shrunk. The tag
+ * takes one spare byte at the end of the block, and sizes are the ones
+ * malloc reports for the block, so the counts include malloc's
+ * rounding. In DEBUG_MEM builds the tag and size are kept in the debug
+ * block header instead. Memory from C++ new is counted only in
+ * DEBUG_MEM builds, where gmempp.cc routes it through gmalloc.
+ */
+enum {
+  gMemTagOther,			/* anything not tagged below */
+  gMemTagObjects,		/* object model: parser, xref, dicts, arrays */
+  gMemTagStreams,		/* stream filter and image decoder buffers */
+  gMemTagFonts,			/* fonts, CMaps and ToUnicode maps */
+  gMemTagText,			/* text layout */
+  gMemNumTags
+};
+
+/*
+ * Set the tag for this thread's allocations; returns the previous one.
+ */
+extern int gMemSetTag(int tag);
+
+/*
+ * Bytes ever allocated under <tag> (growth through grealloc included),
+ * and bytes currently live. Either pointer may be NULL.
+ */
+extern void gMemGetCounters(int tag, size_t *allocated, size_t *live);
+
 /*
  * Allocate memory and copy a string into it.
  */
@@ -86,6 +116,17 @@ extern char *gstrndup(const char *s, size_t n);
 
 #ifdef __cplusplus
 }
+
+/*
+ * Charge the allocations made while in scope to <tag>.
+ */
+class GMemScope {
+public:
+  GMemScope(int tag) { prevTag = gMemSetTag(tag); }
+  ~GMemScope() { gMemSetTag(prevTag); }
+private:
+  int prevTag;
+};
 #endif
 
 #endif
@@ -44,9 +44,15 @@ public:
   // Destructor.
   ~Array();
 
-  // Reference counting.
+  // Reference counting.  Objects fetched through the xref are shared
+  // between threads, so the count is atomic.
+#if MULTITHREADED
+  int incRef() { return __sync_add_and_fetch(&ref, 1); }
+  int decRef() { return __sync_sub_and_fetch(&ref, 1); }
+#else
   int incRef() { return ++ref; }
   int decRef() { return --ref; }
+#endif
 
   // Get number of elements.
   int getLength() { return length; }
@@ -16,7 +16,7 @@
 #include "gtypes.h"
 
 struct BuiltinFont;
-class BuiltinFontWidths;
+struct BuiltinFontWidths;
 
 //------------------------------------------------------------------------
 
@@ -34,22 +34,19 @@ struct BuiltinFont {
 struct BuiltinFontWidth {
   const char *name;
   Gushort width;
-  BuiltinFontWidth *next;
 };
 
-class BuiltinFontWidths {
-public:
+// The widths of a builtin font, in the order of a perfect hash over
+// the names (see PerfectHash.h).  The tables are generated with the
+// hash, so this is initialized statically.
+struct BuiltinFontWidths {
 
-  BuiltinFontWidths(BuiltinFontWidth *widths, int sizeA);
-  ~BuiltinFontWidths();
   GBool getWidth(const char *name, Gushort *width);
 
-private:
-
-  int hash(const char *name);
-
-  BuiltinFontWidth **tab;
+  const BuiltinFontWidth *tab;
   int size;
+  const Gushort *disp;
+  int nBuckets;
 };
 
 #endif
@@ -10,4236 +10,4427 @@
 #include "FontEncodingTables.h"
 #include "BuiltinFontTables.h"
 
-static BuiltinFontWidth courierWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "L",                                 600, NULL },
-  { "backslash",                         600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "equal",                             600, NULL },
-  { "question",                          600, NULL },
-  { "X",                                 600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "hyphen",                            600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "five",                              600, NULL },
-  { "nine",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "zero",                              600, NULL },
-  { "multiply",                          600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Racute",                            600, NULL },
-  { "Ograve",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "Oacute",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "ampersand",                         600, NULL },
-  { "Iacute",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "igrave",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "iacute",                            600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "seven",                             600, NULL },
-  { "Amacron",                           600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "braceright",                        600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierWidthsTab[] = {
+  { "J",                                  600 },
+  { "scedilla",                           600 },
+  { "Euro",                               600 },
+  { "plusminus",                          600 },
+  { "grave",                              600 },
+  { "b",                                  600 },
+  { "iogonek",                            600 },
+  { "Uhungarumlaut",                      600 },
+  { "bar",                                600 },
+  { "multiply",                           600 },
+  { "ccedilla",                           600 },
+  { "ecircumflex",                        600 },
+  { "n",                                  600 },
+  { "Atilde",                             600 },
+  { "tilde",                              600 },
+  { "Ecaron",                             600 },
+  { "Edotaccent",                         600 },
+  { "uacute",                             600 },
+  { "e",                                  600 },
+  { "registered",                         600 },
+  { "Icircumflex",                        600 },
+  { "fi",                                 600 },
+  { "Uacute",                             600 },
+  { "braceright",                         600 },
+  { "asciitilde",                         600 },
+  { "percent",                            600 },
+  { "Lcommaaccent",                       600 },
+  { "oslash",                             600 },
+  { "Dcroat",                             600 },
+  { "I",                                  600 },
+  { "z",                                  600 },
+  { "kcommaaccent",                       600 },
+  { "Racute",                             600 },
+  { "summation",                          600 },
+  { "greaterequal",                       600 },
+  { "ring",                               600 },
+  { "X",                                  600 },
+  { "Ntilde",                             600 },
+  { "dieresis",                           600 },
+  { "divide",                             600 },
+  { "Uring",                              600 },
+  { "Idotaccent",                         600 },
+  { "quotedbl",                           600 },
+  { "Scommaaccent",                       600 },
+  { "A",                                  600 },
+  { "scommaaccent",                       600 },
+  { "Amacron",                            600 },
+  { "C",                                  600 },
+  { "bracketleft",                        600 },
+  { "three",                              600 },
+  { "emacron",                            600 },
+  { "notequal",                           600 },
+  { "caron",                              600 },
+  { "acircumflex",                        600 },
+  { "lcaron",                             600 },
+  { "copyright",                          600 },
+  { "emdash",                             600 },
+  { "icircumflex",                        600 },
+  { "cent",                               600 },
+  { "Z",                                  600 },
+  { "quotedblbase",                       600 },
+  { "ncommaaccent",                       600 },
+  { "racute",                             600 },
+  { "k",                                  600 },
+  { "o",                                  600 },
+  { "ordmasculine",                       600 },
+  { "cedilla",                            600 },
+  { "greater",                            600 },
+  { "Aacute",                             600 },
+  { "Eth",                                600 },
+  { "colon",                              600 },
+  { "c",                                  600 },
+  { "lozenge",                            600 },
+  { "Agrave",                             600 },
+  { "Emacron",                            600 },
+  { "Zacute",                             600 },
+  { "macron",                             600 },
+  { "germandbls",                         600 },
+  { "s",                                  600 },
+  { "eight",                              600 },
+  { "P",                                  600 },
+  { "Q",                                  600 },
+  { "R",                                  600 },
+  { "ae",                                 600 },
+  { "one",                                600 },
+  { "U",                                  600 },
+  { "Edieresis",                          600 },
+  { "currency",                           600 },
+  { "K",                                  600 },
+  { "guilsinglleft",                      600 },
+  { "onehalf",                            600 },
+  { "hungarumlaut",                       600 },
+  { "Oslash",                             600 },
+  { "Dcaron",                             600 },
+  { "Aring",                              600 },
+  { "five",                               600 },
+  { "T",                                  600 },
+  { "endash",                             600 },
+  { "lacute",                             600 },
+  { "umacron",                            600 },
+  { "V",                                  600 },
+  { "Ncaron",                             600 },
+  { "Omacron",                            600 },
+  { "g",                                  600 },
+  { "p",                                  600 },
+  { "Rcaron",                             600 },
+  { "quoteright",                         600 },
+  { "O",                                  600 },
+  { "lcommaaccent",                       600 },
+  { "exclam",                             600 },
+  { "idieresis",                          600 },
+  { "zacute",                             600 },
+  { "gbreve",                             600 },
+  { "underscore",                         600 },
+  { "Sacute",                             600 },
+  { "aogonek",                            600 },
+  { "section",                            600 },
+  { "Cacute",                             600 },
+  { "florin",                             600 },
+  { "odieresis",                          600 },
+  { "gcommaaccent",                       600 },
+  { "nacute",                             600 },
+  { "Lslash",                             600 },
+  { "quoteleft",                          600 },
+  { "W",                                  600 },
+  { "plus",                               600 },
+  { "ampersand",                          600 },
+  { "ntilde",                             600 },
+  { "sterling",                           600 },
+  { "minus",                              600 },
+  { "imacron",                            600 },
+  { "ograve",                             600 },
+  { "AE",                                 600 },
+  { "space",                              600 },
+  { "atilde",                             600 },
+  { "udieresis",                          600 },
+  { "parenright",                         600 },
+  { "semicolon",                          600 },
+  { "trademark",                          600 },
+  { "adieresis",                          600 },
+  { "oacute",                             600 },
+  { "Ucircumflex",                        600 },
+  { "acute",                              600 },
+  { "yen",                                600 },
+  { "Scedilla",                           600 },
+  { "Zdotaccent",                         600 },
+  { "dcaron",                             600 },
+  { "mu",                                 600 },
+  { "a",                                  600 },
+  { "v",                                  600 },
+  { "at",                                 600 },
+  { "eogonek",                            600 },
+  { "j",                                  600 },
+  { "perthousand",                        600 },
+  { "Ograve",                             600 },
+  { "partialdiff",                        600 },
+  { "thorn",                              600 },
+  { "otilde",                             600 },
+  { "m",                                  600 },
+  { "dcroat",                             600 },
+  { "i",                                  600 },
+  { "asterisk",                           600 },
+  { "Idieresis",                          600 },
+  { "G",                                  600 },
+  { "Oacute",                             600 },
+  { "H",                                  600 },
+  { "scaron",                             600 },
+  { "quotesinglbase",                     600 },
+  { "Iacute",                             600 },
+  { "ugrave",                             600 },
+  { "Ugrave",                             600 },
+  { "questiondown",                       600 },
+  { "amacron",                            600 },
+  { "Ydieresis",                          600 },
+  { "less",                               600 },
+  { "Thorn",                              600 },
+  { "logicalnot",                         600 },
+  { "twosuperior",                        600 },
+  { "uring",                              600 },
+  { "guilsinglright",                     600 },
+  { "r",                                  600 },
+  { "bracketright",                       600 },
+  { "Yacute",                             600 },
+  { "Scaron",                             600 },
+  { "hyphen",                             600 },
+  { "t",                                  600 },
+  { "u",                                  600 },
+  { "B",                                  600 },
+  { "periodcentered",                     600 },
+  { "eth",                                600 },
+  { "Delta",                              600 },
+  { "parenleft",                          600 },
+  { "M",                                  600 },
+  { "guillemotleft",                      600 },
+  { "ocircumflex",                        600 },
+  { "ccaron",                             600 },
+  { "quotedblleft",                       600 },
+  { "Umacron",                            600 },
+  { "Ncommaaccent",                       600 },
+  { "x",                                  600 },
+  { "onesuperior",                        600 },
+  { "Nacute",                             600 },
+  { "lessequal",                          600 },
+  { "question",                           600 },
+  { "dollar",                             600 },
+  { "daggerdbl",                          600 },
+  { "Lcaron",                             600 },
+  { "omacron",                            600 },
+  { "Eacute",                             600 },
+  { "D",                                  600 },
+  { "sacute",                             600 },
+  { "ohungarumlaut",                      600 },
+  { "cacute",                             600 },
+  { "rcaron",                             600 },
+  { "zdotaccent",                         600 },
+  { "threesuperior",                      600 },
+  { "zero",                               600 },
+  { "guillemotright",                     600 },
+  { "asciicircum",                        600 },
+  { "backslash",                          600 },
+  { "lslash",                             600 },
+  { "onequarter",                         600 },
+  { "fraction",                           600 },
+  { "threequarters",                      600 },
+  { "quotedblright",                      600 },
+  { "period",                             600 },
+  { "ucircumflex",                        600 },
+  { "tcaron",                             600 },
+  { "Igrave",                             600 },
+  { "Rcommaaccent",                       600 },
+  { "dotlessi",                           600 },
+  { "dotaccent",                          600 },
+  { "igrave",                             600 },
+  { "L",                                  600 },
+  { "uhungarumlaut",                      600 },
+  { "numbersign",                         600 },
+  { "Y",                                  600 },
+  { "Tcaron",                             600 },
+  { "Gbreve",                             600 },
+  { "Eogonek",                            600 },
+  { "w",                                  600 },
+  { "ydieresis",                          600 },
+  { "aring",                              600 },
+  { "commaaccent",                        600 },
+  { "Lacute",                             600 },
+  { "seven",                              600 },
+  { "degree",                             600 },
+  { "Udieresis",                          600 },
+  { "quotesingle",                        600 },
+  { "four",                               600 },
+  { "Ocircumflex",                        600 },
+  { "oe",                                 600 },
+  { "brokenbar",                          600 },
+  { "l",                                  600 },
+  { "breve",                              600 },
+  { "comma",                              600 },
+  { "f",                                  600 },
+  { "aacute",                             600 },
+  { "radical",                            600 },
+  { "d",                                  600 },
+  { "ecaron",                             600 },
+  { "S",                                  600 },
+  { "rcommaaccent",                       600 },
+  { "slash",                              600 },
+  { "tcommaaccent",                       600 },
+  { "edieresis",                          600 },
+  { "equal",                              600 },
+  { "y",                                  600 },
+  { "ogonek",                             600 },
+  { "yacute",                             600 },
+  { "agrave",                             600 },
+  { "Tcommaaccent",                       600 },
+  { "six",                                600 },
+  { "Ccedilla",                           600 },
+  { "ordfeminine",                        600 },
+  { "exclamdown",                         600 },
+  { "Ohungarumlaut",                      600 },
+  { "nine",                               600 },
+  { "zcaron",                             600 },
+  { "Odieresis",                          600 },
+  { "Gcommaaccent",                       600 },
+  { "Iogonek",                            600 },
+  { "N",                                  600 },
+  { "Aogonek",                            600 },
+  { "Adieresis",                          600 },
+  { "braceleft",                          600 },
+  { "Abreve",                             600 },
+  { "uogonek",                            600 },
+  { "dagger",                             600 },
+  { "ellipsis",                           600 },
+  { "iacute",                             600 },
+  { "edotaccent",                         600 },
+  { "bullet",                             600 },
+  { "Imacron",                            600 },
+  { "egrave",                             600 },
+  { "paragraph",                          600 },
+  { "Otilde",                             600 },
+  { "Kcommaaccent",                       600 },
+  { "eacute",                             600 },
+  { "OE",                                 600 },
+  { "Acircumflex",                        600 },
+  { "two",                                600 },
+  { "Uogonek",                            600 },
+  { "Egrave",                             600 },
+  { "ncaron",                             600 },
+  { "h",                                  600 },
+  { "q",                                  600 },
+  { "circumflex",                         600 },
+  { "E",                                  600 },
+  { "Ccaron",                             600 },
+  { "fl",                                 600 },
+  { "F",                                  600 },
+  { "Ecircumflex",                        600 },
+  { "Zcaron",                             600 },
+  { "abreve",                             600 }
 };
 
-static BuiltinFontWidth courierBoldWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const Gushort courierWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
 };
 
-static BuiltinFontWidth courierBoldObliqueWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const BuiltinFontWidth courierBoldWidthsTab[] = {
+  { "J",                                  600 },
+  { "scedilla",                           600 },
+  { "Euro",                               600 },
+  { "plusminus",                          600 },
+  { "grave",                              600 },
+  { "b",                                  600 },
+  { "iogonek",                            600 },
+  { "Uhungarumlaut",                      600 },
+  { "bar",                                600 },
+  { "multiply",                           600 },
+  { "ccedilla",                           600 },
+  { "ecircumflex",                        600 },
+  { "n",                                  600 },
+  { "Atilde",                             600 },
+  { "tilde",                              600 },
+  { "Ecaron",                             600 },
+  { "Edotaccent",                         600 },
+  { "uacute",                             600 },
+  { "e",                                  600 },
+  { "registered",                         600 },
+  { "Icircumflex",                        600 },
+  { "fi",                                 600 },
+  { "Uacute",                             600 },
+  { "braceright",                         600 },
+  { "asciitilde",                         600 },
+  { "percent",                            600 },
+  { "Lcommaaccent",                       600 },
+  { "oslash",                             600 },
+  { "Dcroat",                             600 },
+  { "I",                                  600 },
+  { "z",                                  600 },
+  { "kcommaaccent",                       600 },
+  { "Racute",                             600 },
+  { "summation",                          600 },
+  { "greaterequal",                       600 },
+  { "ring",                               600 },
+  { "X",                                  600 },
+  { "Ntilde",                             600 },
+  { "dieresis",                           600 },
+  { "divide",                             600 },
+  { "Uring",                              600 },
+  { "Idotaccent",                         600 },
+  { "quotedbl",                           600 },
+  { "Scommaaccent",                       600 },
+  { "A",                                  600 },
+  { "scommaaccent",                       600 },
+  { "Amacron",                            600 },
+  { "C",                                  600 },
+  { "bracketleft",                        600 },
+  { "three",                              600 },
+  { "emacron",                            600 },
+  { "notequal",                           600 },
+  { "caron",                              600 },
+  { "acircumflex",                        600 },
+  { "lcaron",                             600 },
+  { "copyright",                          600 },
+  { "emdash",                             600 },
+  { "icircumflex",                        600 },
+  { "cent",                               600 },
+  { "Z",                                  600 },
+  { "quotedblbase",                       600 },
+  { "ncommaaccent",                       600 },
+  { "racute",                             600 },
+  { "k",                                  600 },
+  { "o",                                  600 },
+  { "ordmasculine",                       600 },
+  { "cedilla",                            600 },
+  { "greater",                            600 },
+  { "Aacute",                             600 },
+  { "Eth",                                600 },
+  { "colon",                              600 },
+  { "c",                                  600 },
+  { "lozenge",                            600 },
+  { "Agrave",                             600 },
+  { "Emacron",                            600 },
+  { "Zacute",                             600 },
+  { "macron",                             600 },
+  { "germandbls",                         600 },
+  { "s",                                  600 },
+  { "eight",                              600 },
+  { "P",                                  600 },
+  { "Q",                                  600 },
+  { "R",                                  600 },
+  { "ae",                                 600 },
+  { "one",                                600 },
+  { "U",                                  600 },
+  { "Edieresis",                          600 },
+  { "currency",                           600 },
+  { "K",                                  600 },
+  { "guilsinglleft",                      600 },
+  { "onehalf",                            600 },
+  { "hungarumlaut",                       600 },
+  { "Oslash",                             600 },
+  { "Dcaron",                             600 },
+  { "Aring",                              600 },
+  { "five",                               600 },
+  { "T",                                  600 },
+  { "endash",                             600 },
+  { "lacute",                             600 },
+  { "umacron",                            600 },
+  { "V",                                  600 },
+  { "Ncaron",                             600 },
+  { "Omacron",                            600 },
+  { "g",                                  600 },
+  { "p",                                  600 },
+  { "Rcaron",                             600 },
+  { "quoteright",                         600 },
+  { "O",                                  600 },
+  { "lcommaaccent",                       600 },
+  { "exclam",                             600 },
+  { "idieresis",                          600 },
+  { "zacute",                             600 },
+  { "gbreve",                             600 },
+  { "underscore",                         600 },
+  { "Sacute",                             600 },
+  { "aogonek",                            600 },
+  { "section",                            600 },
+  { "Cacute",                             600 },
+  { "florin",                             600 },
+  { "odieresis",                          600 },
+  { "gcommaaccent",                       600 },
+  { "nacute",                             600 },
+  { "Lslash",                             600 },
+  { "quoteleft",                          600 },
+  { "W",                                  600 },
+  { "plus",                               600 },
+  { "ampersand",                          600 },
+  { "ntilde",                             600 },
+  { "sterling",                           600 },
+  { "minus",                              600 },
+  { "imacron",                            600 },
+  { "ograve",                             600 },
+  { "AE",                                 600 },
+  { "space",                              600 },
+  { "atilde",                             600 },
+  { "udieresis",                          600 },
+  { "parenright",                         600 },
+  { "semicolon",                          600 },
+  { "trademark",                          600 },
+  { "adieresis",                          600 },
+  { "oacute",                             600 },
+  { "Ucircumflex",                        600 },
+  { "acute",                              600 },
+  { "yen",                                600 },
+  { "Scedilla",                           600 },
+  { "Zdotaccent",                         600 },
+  { "dcaron",                             600 },
+  { "mu",                                 600 },
+  { "a",                                  600 },
+  { "v",                                  600 },
+  { "at",                                 600 },
+  { "eogonek",                            600 },
+  { "j",                                  600 },
+  { "perthousand",                        600 },
+  { "Ograve",                             600 },
+  { "partialdiff",                        600 },
+  { "thorn",                              600 },
+  { "otilde",                             600 },
+  { "m",                                  600 },
+  { "dcroat",                             600 },
+  { "i",                                  600 },
+  { "asterisk",                           600 },
+  { "Idieresis",                          600 },
+  { "G",                                  600 },
+  { "Oacute",                             600 },
+  { "H",                                  600 },
+  { "scaron",                             600 },
+  { "quotesinglbase",                     600 },
+  { "Iacute",                             600 },
+  { "ugrave",                             600 },
+  { "Ugrave",                             600 },
+  { "questiondown",                       600 },
+  { "amacron",                            600 },
+  { "Ydieresis",                          600 },
+  { "less",                               600 },
+  { "Thorn",                              600 },
+  { "logicalnot",                         600 },
+  { "twosuperior",                        600 },
+  { "uring",                              600 },
+  { "guilsinglright",                     600 },
+  { "r",                                  600 },
+  { "bracketright",                       600 },
+  { "Yacute",                             600 },
+  { "Scaron",                             600 },
+  { "hyphen",                             600 },
+  { "t",                                  600 },
+  { "u",                                  600 },
+  { "B",                                  600 },
+  { "periodcentered",                     600 },
+  { "eth",                                600 },
+  { "Delta",                              600 },
+  { "parenleft",                          600 },
+  { "M",                                  600 },
+  { "guillemotleft",                      600 },
+  { "ocircumflex",                        600 },
+  { "ccaron",                             600 },
+  { "quotedblleft",                       600 },
+  { "Umacron",                            600 },
+  { "Ncommaaccent",                       600 },
+  { "x",                                  600 },
+  { "onesuperior",                        600 },
+  { "Nacute",                             600 },
+  { "lessequal",                          600 },
+  { "question",                           600 },
+  { "dollar",                             600 },
+  { "daggerdbl",                          600 },
+  { "Lcaron",                             600 },
+  { "omacron",                            600 },
+  { "Eacute",                             600 },
+  { "D",                                  600 },
+  { "sacute",                             600 },
+  { "ohungarumlaut",                      600 },
+  { "cacute",                             600 },
+  { "rcaron",                             600 },
+  { "zdotaccent",                         600 },
+  { "threesuperior",                      600 },
+  { "zero",                               600 },
+  { "guillemotright",                     600 },
+  { "asciicircum",                        600 },
+  { "backslash",                          600 },
+  { "lslash",                             600 },
+  { "onequarter",                         600 },
+  { "fraction",                           600 },
+  { "threequarters",                      600 },
+  { "quotedblright",                      600 },
+  { "period",                             600 },
+  { "ucircumflex",                        600 },
+  { "tcaron",                             600 },
+  { "Igrave",                             600 },
+  { "Rcommaaccent",                       600 },
+  { "dotlessi",                           600 },
+  { "dotaccent",                          600 },
+  { "igrave",                             600 },
+  { "L",                                  600 },
+  { "uhungarumlaut",                      600 },
+  { "numbersign",                         600 },
+  { "Y",                                  600 },
+  { "Tcaron",                             600 },
+  { "Gbreve",                             600 },
+  { "Eogonek",                            600 },
+  { "w",                                  600 },
+  { "ydieresis",                          600 },
+  { "aring",                              600 },
+  { "commaaccent",                        600 },
+  { "Lacute",                             600 },
+  { "seven",                              600 },
+  { "degree",                             600 },
+  { "Udieresis",                          600 },
+  { "quotesingle",                        600 },
+  { "four",                               600 },
+  { "Ocircumflex",                        600 },
+  { "oe",                                 600 },
+  { "brokenbar",                          600 },
+  { "l",                                  600 },
+  { "breve",                              600 },
+  { "comma",                              600 },
+  { "f",                                  600 },
+  { "aacute",                             600 },
+  { "radical",                            600 },
+  { "d",                                  600 },
+  { "ecaron",                             600 },
+  { "S",                                  600 },
+  { "rcommaaccent",                       600 },
+  { "slash",                              600 },
+  { "tcommaaccent",                       600 },
+  { "edieresis",                          600 },
+  { "equal",                              600 },
+  { "y",                                  600 },
+  { "ogonek",                             600 },
+  { "yacute",                             600 },
+  { "agrave",                             600 },
+  { "Tcommaaccent",                       600 },
+  { "six",                                600 },
+  { "Ccedilla",                           600 },
+  { "ordfeminine",                        600 },
+  { "exclamdown",                         600 },
+  { "Ohungarumlaut",                      600 },
+  { "nine",                               600 },
+  { "zcaron",                             600 },
+  { "Odieresis",                          600 },
+  { "Gcommaaccent",                       600 },
+  { "Iogonek",                            600 },
+  { "N",                                  600 },
+  { "Aogonek",                            600 },
+  { "Adieresis",                          600 },
+  { "braceleft",                          600 },
+  { "Abreve",                             600 },
+  { "uogonek",                            600 },
+  { "dagger",                             600 },
+  { "ellipsis",                           600 },
+  { "iacute",                             600 },
+  { "edotaccent",                         600 },
+  { "bullet",                             600 },
+  { "Imacron",                            600 },
+  { "egrave",                             600 },
+  { "paragraph",                          600 },
+  { "Otilde",                             600 },
+  { "Kcommaaccent",                       600 },
+  { "eacute",                             600 },
+  { "OE",                                 600 },
+  { "Acircumflex",                        600 },
+  { "two",                                600 },
+  { "Uogonek",                            600 },
+  { "Egrave",                             600 },
+  { "ncaron",                             600 },
+  { "h",                                  600 },
+  { "q",                                  600 },
+  { "circumflex",                         600 },
+  { "E",                                  600 },
+  { "Ccaron",                             600 },
+  { "fl",                                 600 },
+  { "F",                                  600 },
+  { "Ecircumflex",                        600 },
+  { "Zcaron",                             600 },
+  { "abreve",                             600 }
 };
 
-static BuiltinFontWidth courierObliqueWidthsTab[] = {
-  { "Ntilde",                            600, NULL },
-  { "rcaron",                            600, NULL },
-  { "kcommaaccent",                      600, NULL },
-  { "Ncommaaccent",                      600, NULL },
-  { "Zacute",                            600, NULL },
-  { "comma",                             600, NULL },
-  { "cedilla",                           600, NULL },
-  { "plusminus",                         600, NULL },
-  { "circumflex",                        600, NULL },
-  { "dotaccent",                         600, NULL },
-  { "edotaccent",                        600, NULL },
-  { "asciitilde",                        600, NULL },
-  { "colon",                             600, NULL },
-  { "onehalf",                           600, NULL },
-  { "dollar",                            600, NULL },
-  { "Lcaron",                            600, NULL },
-  { "ntilde",                            600, NULL },
-  { "Aogonek",                           600, NULL },
-  { "ncommaaccent",                      600, NULL },
-  { "minus",                             600, NULL },
-  { "Iogonek",                           600, NULL },
-  { "zacute",                            600, NULL },
-  { "yen",                               600, NULL },
-  { "space",                             600, NULL },
-  { "Omacron",                           600, NULL },
-  { "questiondown",                      600, NULL },
-  { "emdash",                            600, NULL },
-  { "Agrave",                            600, NULL },
-  { "three",                             600, NULL },
-  { "numbersign",                        600, NULL },
-  { "lcaron",                            600, NULL },
-  { "A",                                 600, NULL },
-  { "B",                                 600, NULL },
-  { "C",                                 600, NULL },
-  { "aogonek",                           600, NULL },
-  { "D",                                 600, NULL },
-  { "E",                                 600, NULL },
-  { "onequarter",                        600, NULL },
-  { "F",                                 600, NULL },
-  { "G",                                 600, NULL },
-  { "H",                                 600, NULL },
-  { "I",                                 600, NULL },
-  { "J",                                 600, NULL },
-  { "K",                                 600, NULL },
-  { "iogonek",                           600, NULL },
-  { "backslash",                         600, NULL },
-  { "L",                                 600, NULL },
-  { "periodcentered",                    600, NULL },
-  { "M",                                 600, NULL },
-  { "N",                                 600, NULL },
-  { "omacron",                           600, NULL },
-  { "Tcommaaccent",                      600, NULL },
-  { "O",                                 600, NULL },
-  { "P",                                 600, NULL },
-  { "Q",                                 600, NULL },
-  { "Uhungarumlaut",                     600, NULL },
-  { "R",                                 600, NULL },
-  { "Aacute",                            600, NULL },
-  { "caron",                             600, NULL },
-  { "S",                                 600, NULL },
-  { "T",                                 600, NULL },
-  { "U",                                 600, NULL },
-  { "agrave",                            600, NULL },
-  { "V",                                 600, NULL },
-  { "W",                                 600, NULL },
-  { "X",                                 600, NULL },
-  { "question",                          600, NULL },
-  { "equal",                             600, NULL },
-  { "Y",                                 600, NULL },
-  { "Z",                                 600, NULL },
-  { "four",                              600, NULL },
-  { "a",                                 600, NULL },
-  { "Gcommaaccent",                      600, NULL },
-  { "b",                                 600, NULL },
-  { "c",                                 600, NULL },
-  { "d",                                 600, NULL },
-  { "e",                                 600, NULL },
-  { "f",                                 600, NULL },
-  { "g",                                 600, NULL },
-  { "bullet",                            600, NULL },
-  { "h",                                 600, NULL },
-  { "i",                                 600, NULL },
-  { "Oslash",                            600, NULL },
-  { "dagger",                            600, NULL },
-  { "j",                                 600, NULL },
-  { "k",                                 600, NULL },
-  { "l",                                 600, NULL },
-  { "m",                                 600, NULL },
-  { "n",                                 600, NULL },
-  { "tcommaaccent",                      600, NULL },
-  { "o",                                 600, NULL },
-  { "ordfeminine",                       600, NULL },
-  { "ring",                              600, NULL },
-  { "p",                                 600, NULL },
-  { "q",                                 600, NULL },
-  { "uhungarumlaut",                     600, NULL },
-  { "r",                                 600, NULL },
-  { "twosuperior",                       600, NULL },
-  { "aacute",                            600, NULL },
-  { "s",                                 600, NULL },
-  { "OE",                                600, NULL },
-  { "t",                                 600, NULL },
-  { "divide",                            600, NULL },
-  { "u",                                 600, NULL },
-  { "Ccaron",                            600, NULL },
-  { "v",                                 600, NULL },
-  { "w",                                 600, NULL },
-  { "x",                                 600, NULL },
-  { "y",                                 600, NULL },
-  { "z",                                 600, NULL },
-  { "Gbreve",                            600, NULL },
-  { "commaaccent",                       600, NULL },
-  { "hungarumlaut",                      600, NULL },
-  { "Idotaccent",                        600, NULL },
-  { "Nacute",                            600, NULL },
-  { "quotedbl",                          600, NULL },
-  { "gcommaaccent",                      600, NULL },
-  { "mu",                                600, NULL },
-  { "greaterequal",                      600, NULL },
-  { "Scaron",                            600, NULL },
-  { "Lslash",                            600, NULL },
-  { "semicolon",                         600, NULL },
-  { "oslash",                            600, NULL },
-  { "lessequal",                         600, NULL },
-  { "lozenge",                           600, NULL },
-  { "parenright",                        600, NULL },
-  { "ccaron",                            600, NULL },
-  { "Ecircumflex",                       600, NULL },
-  { "gbreve",                            600, NULL },
-  { "trademark",                         600, NULL },
-  { "daggerdbl",                         600, NULL },
-  { "nacute",                            600, NULL },
-  { "macron",                            600, NULL },
-  { "Otilde",                            600, NULL },
-  { "Emacron",                           600, NULL },
-  { "ellipsis",                          600, NULL },
-  { "scaron",                            600, NULL },
-  { "AE",                                600, NULL },
-  { "Ucircumflex",                       600, NULL },
-  { "lslash",                            600, NULL },
-  { "quotedblleft",                      600, NULL },
-  { "guilsinglright",                    600, NULL },
-  { "hyphen",                            600, NULL },
-  { "quotesingle",                       600, NULL },
-  { "eight",                             600, NULL },
-  { "exclamdown",                        600, NULL },
-  { "endash",                            600, NULL },
-  { "oe",                                600, NULL },
-  { "Abreve",                            600, NULL },
-  { "Umacron",                           600, NULL },
-  { "ecircumflex",                       600, NULL },
-  { "Adieresis",                         600, NULL },
-  { "copyright",                         600, NULL },
-  { "Egrave",                            600, NULL },
-  { "slash",                             600, NULL },
-  { "Edieresis",                         600, NULL },
-  { "otilde",                            600, NULL },
-  { "Idieresis",                         600, NULL },
-  { "parenleft",                         600, NULL },
-  { "one",                               600, NULL },
-  { "emacron",                           600, NULL },
-  { "Odieresis",                         600, NULL },
-  { "ucircumflex",                       600, NULL },
-  { "bracketleft",                       600, NULL },
-  { "Ugrave",                            600, NULL },
-  { "quoteright",                        600, NULL },
-  { "Udieresis",                         600, NULL },
-  { "perthousand",                       600, NULL },
-  { "Ydieresis",                         600, NULL },
-  { "umacron",                           600, NULL },
-  { "abreve",                            600, NULL },
-  { "Eacute",                            600, NULL },
-  { "adieresis",                         600, NULL },
-  { "egrave",                            600, NULL },
-  { "edieresis",                         600, NULL },
-  { "idieresis",                         600, NULL },
-  { "Eth",                               600, NULL },
-  { "ae",                                600, NULL },
-  { "asterisk",                          600, NULL },
-  { "odieresis",                         600, NULL },
-  { "Uacute",                            600, NULL },
-  { "ugrave",                            600, NULL },
-  { "nine",                              600, NULL },
-  { "five",                              600, NULL },
-  { "udieresis",                         600, NULL },
-  { "Zcaron",                            600, NULL },
-  { "Scommaaccent",                      600, NULL },
-  { "threequarters",                     600, NULL },
-  { "guillemotright",                    600, NULL },
-  { "Ccedilla",                          600, NULL },
-  { "ydieresis",                         600, NULL },
-  { "tilde",                             600, NULL },
-  { "at",                                600, NULL },
-  { "eacute",                            600, NULL },
-  { "underscore",                        600, NULL },
-  { "Euro",                              600, NULL },
-  { "Dcroat",                            600, NULL },
-  { "multiply",                          600, NULL },
-  { "zero",                              600, NULL },
-  { "eth",                               600, NULL },
-  { "Scedilla",                          600, NULL },
-  { "Ograve",                            600, NULL },
-  { "Racute",                            600, NULL },
-  { "partialdiff",                       600, NULL },
-  { "uacute",                            600, NULL },
-  { "braceleft",                         600, NULL },
-  { "Thorn",                             600, NULL },
-  { "zcaron",                            600, NULL },
-  { "scommaaccent",                      600, NULL },
-  { "ccedilla",                          600, NULL },
-  { "Dcaron",                            600, NULL },
-  { "dcroat",                            600, NULL },
-  { "Ocircumflex",                       600, NULL },
-  { "Oacute",                            600, NULL },
-  { "scedilla",                          600, NULL },
-  { "ogonek",                            600, NULL },
-  { "ograve",                            600, NULL },
-  { "racute",                            600, NULL },
-  { "Tcaron",                            600, NULL },
-  { "Eogonek",                           600, NULL },
-  { "thorn",                             600, NULL },
-  { "degree",                            600, NULL },
-  { "registered",                        600, NULL },
-  { "radical",                           600, NULL },
-  { "Aring",                             600, NULL },
-  { "percent",                           600, NULL },
-  { "six",                               600, NULL },
-  { "paragraph",                         600, NULL },
-  { "dcaron",                            600, NULL },
-  { "Uogonek",                           600, NULL },
-  { "two",                               600, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            600, NULL },
-  { "Lacute",                            600, NULL },
-  { "ocircumflex",                       600, NULL },
-  { "oacute",                            600, NULL },
-  { "Uring",                             600, NULL },
-  { "Lcommaaccent",                      600, NULL },
-  { "tcaron",                            600, NULL },
-  { "eogonek",                           600, NULL },
-  { "Delta",                             600, NULL },
-  { "Ohungarumlaut",                     600, NULL },
-  { "asciicircum",                       600, NULL },
-  { "aring",                             600, NULL },
-  { "grave",                             600, NULL },
-  { "uogonek",                           600, NULL },
-  { "bracketright",                      600, NULL },
-  { "Iacute",                            600, NULL },
-  { "ampersand",                         600, NULL },
-  { "igrave",                            600, NULL },
-  { "lacute",                            600, NULL },
-  { "Ncaron",                            600, NULL },
-  { "plus",                              600, NULL },
-  { "uring",                             600, NULL },
-  { "quotesinglbase",                    600, NULL },
-  { "lcommaaccent",                      600, NULL },
-  { "Yacute",                            600, NULL },
-  { "ohungarumlaut",                     600, NULL },
-  { "threesuperior",                     600, NULL },
-  { "acute",                             600, NULL },
-  { "section",                           600, NULL },
-  { "dieresis",                          600, NULL },
-  { "iacute",                            600, NULL },
-  { "quotedblbase",                      600, NULL },
-  { "ncaron",                            600, NULL },
-  { "florin",                            600, NULL },
-  { "yacute",                            600, NULL },
-  { "Rcommaaccent",                      600, NULL },
-  { "fi",                                600, NULL },
-  { "fl",                                600, NULL },
-  { "Acircumflex",                       600, NULL },
-  { "Cacute",                            600, NULL },
-  { "Icircumflex",                       600, NULL },
-  { "guillemotleft",                     600, NULL },
-  { "germandbls",                        600, NULL },
-  { "Amacron",                           600, NULL },
-  { "seven",                             600, NULL },
-  { "Sacute",                            600, NULL },
-  { "ordmasculine",                      600, NULL },
-  { "dotlessi",                          600, NULL },
-  { "sterling",                          600, NULL },
-  { "notequal",                          600, NULL },
-  { "Imacron",                           600, NULL },
-  { "rcommaaccent",                      600, NULL },
-  { "Zdotaccent",                        600, NULL },
-  { "acircumflex",                       600, NULL },
-  { "cacute",                            600, NULL },
-  { "Ecaron",                            600, NULL },
-  { "icircumflex",                       600, NULL },
-  { "braceright",                        600, NULL },
-  { "quotedblright",                     600, NULL },
-  { "amacron",                           600, NULL },
-  { "sacute",                            600, NULL },
-  { "imacron",                           600, NULL },
-  { "cent",                              600, NULL },
-  { "currency",                          600, NULL },
-  { "logicalnot",                        600, NULL },
-  { "zdotaccent",                        600, NULL },
-  { "Atilde",                            600, NULL },
-  { "breve",                             600, NULL },
-  { "bar",                               600, NULL },
-  { "fraction",                          600, NULL },
-  { "less",                              600, NULL },
-  { "ecaron",                            600, NULL },
-  { "guilsinglleft",                     600, NULL },
-  { "exclam",                            600, NULL },
-  { "period",                            600, NULL },
-  { "Rcaron",                            600, NULL },
-  { "Kcommaaccent",                      600, NULL },
-  { "greater",                           600, NULL },
-  { "atilde",                            600, NULL },
-  { "brokenbar",                         600, NULL },
-  { "quoteleft",                         600, NULL },
-  { "Edotaccent",                        600, NULL },
-  { "onesuperior",                       600, NULL }
+static const Gushort courierBoldWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
 };
 
-static BuiltinFontWidth helveticaWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            556, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            299, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           222, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           556, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          556, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 500, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 556, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 222, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 222, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 222, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 556, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 500, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          355, NULL },
-  { "gcommaaccent",                      556, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            500, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            556, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            500, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            222, NULL },
-  { "quotedblleft",                      333, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       191, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            556, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       278, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        222, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         556, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                               1015, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               556, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         334, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      500, NULL },
-  { "ccedilla",                          500, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          500, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            556, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         537, NULL },
-  { "dcaron",                            643, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       556, NULL },
-  { "oacute",                            556, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            317, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      278, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         667, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            222, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    222, NULL },
-  { "lcommaaccent",                      222, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     556, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      333, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            500, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        334, NULL },
-  { "quotedblright",                     333, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            500, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               260, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            278, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         260, NULL },
-  { "quoteleft",                         222, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth courierBoldObliqueWidthsTab[] = {
+  { "J",                                  600 },
+  { "scedilla",                           600 },
+  { "Euro",                               600 },
+  { "plusminus",                          600 },
+  { "grave",                              600 },
+  { "b",                                  600 },
+  { "iogonek",                            600 },
+  { "Uhungarumlaut",                      600 },
+  { "bar",                                600 },
+  { "multiply",                           600 },
+  { "ccedilla",                           600 },
+  { "ecircumflex",                        600 },
+  { "n",                                  600 },
+  { "Atilde",                             600 },
+  { "tilde",                              600 },
+  { "Ecaron",                             600 },
+  { "Edotaccent",                         600 },
+  { "uacute",                             600 },
+  { "e",                                  600 },
+  { "registered",                         600 },
+  { "Icircumflex",                        600 },
+  { "fi",                                 600 },
+  { "Uacute",                             600 },
+  { "braceright",                         600 },
+  { "asciitilde",                         600 },
+  { "percent",                            600 },
+  { "Lcommaaccent",                       600 },
+  { "oslash",                             600 },
+  { "Dcroat",                             600 },
+  { "I",                                  600 },
+  { "z",                                  600 },
+  { "kcommaaccent",                       600 },
+  { "Racute",                             600 },
+  { "summation",                          600 },
+  { "greaterequal",                       600 },
+  { "ring",                               600 },
+  { "X",                                  600 },
+  { "Ntilde",                             600 },
+  { "dieresis",                           600 },
+  { "divide",                             600 },
+  { "Uring",                              600 },
+  { "Idotaccent",                         600 },
+  { "quotedbl",                           600 },
+  { "Scommaaccent",                       600 },
+  { "A",                                  600 },
+  { "scommaaccent",                       600 },
+  { "Amacron",                            600 },
+  { "C",                                  600 },
+  { "bracketleft",                        600 },
+  { "three",                              600 },
+  { "emacron",                            600 },
+  { "notequal",                           600 },
+  { "caron",                              600 },
+  { "acircumflex",                        600 },
+  { "lcaron",                             600 },
+  { "copyright",                          600 },
+  { "emdash",                             600 },
+  { "icircumflex",                        600 },
+  { "cent",                               600 },
+  { "Z",                                  600 },
+  { "quotedblbase",                       600 },
+  { "ncommaaccent",                       600 },
+  { "racute",                             600 },
+  { "k",                                  600 },
+  { "o",                                  600 },
+  { "ordmasculine",                       600 },
+  { "cedilla",                            600 },
+  { "greater",                            600 },
+  { "Aacute",                             600 },
+  { "Eth",                                600 },
+  { "colon",                              600 },
+  { "c",                                  600 },
+  { "lozenge",                            600 },
+  { "Agrave",                             600 },
+  { "Emacron",                            600 },
+  { "Zacute",                             600 },
+  { "macron",                             600 },
+  { "germandbls",                         600 },
+  { "s",                                  600 },
+  { "eight",                              600 },
+  { "P",                                  600 },
+  { "Q",                                  600 },
+  { "R",                                  600 },
+  { "ae",                                 600 },
+  { "one",                                600 },
+  { "U",                                  600 },
+  { "Edieresis",                          600 },
+  { "currency",                           600 },
+  { "K",                                  600 },
+  { "guilsinglleft",                      600 },
+  { "onehalf",                            600 },
+  { "hungarumlaut",                       600 },
+  { "Oslash",                             600 },
+  { "Dcaron",                             600 },
+  { "Aring",                              600 },
+  { "five",                               600 },
+  { "T",                                  600 },
+  { "endash",                             600 },
+  { "lacute",                             600 },
+  { "umacron",                            600 },
+  { "V",                                  600 },
+  { "Ncaron",                             600 },
+  { "Omacron",                            600 },
+  { "g",                                  600 },
+  { "p",                                  600 },
+  { "Rcaron",                             600 },
+  { "quoteright",                         600 },
+  { "O",                                  600 },
+  { "lcommaaccent",                       600 },
+  { "exclam",                             600 },
+  { "idieresis",                          600 },
+  { "zacute",                             600 },
+  { "gbreve",                             600 },
+  { "underscore",                         600 },
+  { "Sacute",                             600 },
+  { "aogonek",                            600 },
+  { "section",                            600 },
+  { "Cacute",                             600 },
+  { "florin",                             600 },
+  { "odieresis",                          600 },
+  { "gcommaaccent",                       600 },
+  { "nacute",                             600 },
+  { "Lslash",                             600 },
+  { "quoteleft",                          600 },
+  { "W",                                  600 },
+  { "plus",                               600 },
+  { "ampersand",                          600 },
+  { "ntilde",                             600 },
+  { "sterling",                           600 },
+  { "minus",                              600 },
+  { "imacron",                            600 },
+  { "ograve",                             600 },
+  { "AE",                                 600 },
+  { "space",                              600 },
+  { "atilde",                             600 },
+  { "udieresis",                          600 },
+  { "parenright",                         600 },
+  { "semicolon",                          600 },
+  { "trademark",                          600 },
+  { "adieresis",                          600 },
+  { "oacute",                             600 },
+  { "Ucircumflex",                        600 },
+  { "acute",                              600 },
+  { "yen",                                600 },
+  { "Scedilla",                           600 },
+  { "Zdotaccent",                         600 },
+  { "dcaron",                             600 },
+  { "mu",                                 600 },
+  { "a",                                  600 },
+  { "v",                                  600 },
+  { "at",                                 600 },
+  { "eogonek",                            600 },
+  { "j",                                  600 },
+  { "perthousand",                        600 },
+  { "Ograve",                             600 },
+  { "partialdiff",                        600 },
+  { "thorn",                              600 },
+  { "otilde",                             600 },
+  { "m",                                  600 },
+  { "dcroat",                             600 },
+  { "i",                                  600 },
+  { "asterisk",                           600 },
+  { "Idieresis",                          600 },
+  { "G",                                  600 },
+  { "Oacute",                             600 },
+  { "H",                                  600 },
+  { "scaron",                             600 },
+  { "quotesinglbase",                     600 },
+  { "Iacute",                             600 },
+  { "ugrave",                             600 },
+  { "Ugrave",                             600 },
+  { "questiondown",                       600 },
+  { "amacron",                            600 },
+  { "Ydieresis",                          600 },
+  { "less",                               600 },
+  { "Thorn",                              600 },
+  { "logicalnot",                         600 },
+  { "twosuperior",                        600 },
+  { "uring",                              600 },
+  { "guilsinglright",                     600 },
+  { "r",                                  600 },
+  { "bracketright",                       600 },
+  { "Yacute",                             600 },
+  { "Scaron",                             600 },
+  { "hyphen",                             600 },
+  { "t",                                  600 },
+  { "u",                                  600 },
+  { "B",                                  600 },
+  { "periodcentered",                     600 },
+  { "eth",                                600 },
+  { "Delta",                              600 },
+  { "parenleft",                          600 },
+  { "M",                                  600 },
+  { "guillemotleft",                      600 },
+  { "ocircumflex",                        600 },
+  { "ccaron",                             600 },
+  { "quotedblleft",                       600 },
+  { "Umacron",                            600 },
+  { "Ncommaaccent",                       600 },
+  { "x",                                  600 },
+  { "onesuperior",                        600 },
+  { "Nacute",                             600 },
+  { "lessequal",                          600 },
+  { "question",                           600 },
+  { "dollar",                             600 },
+  { "daggerdbl",                          600 },
+  { "Lcaron",                             600 },
+  { "omacron",                            600 },
+  { "Eacute",                             600 },
+  { "D",                                  600 },
+  { "sacute",                             600 },
+  { "ohungarumlaut",                      600 },
+  { "cacute",                             600 },
+  { "rcaron",                             600 },
+  { "zdotaccent",                         600 },
+  { "threesuperior",                      600 },
+  { "zero",                               600 },
+  { "guillemotright",                     600 },
+  { "asciicircum",                        600 },
+  { "backslash",                          600 },
+  { "lslash",                             600 },
+  { "onequarter",                         600 },
+  { "fraction",                           600 },
+  { "threequarters",                      600 },
+  { "quotedblright",                      600 },
+  { "period",                             600 },
+  { "ucircumflex",                        600 },
+  { "tcaron",                             600 },
+  { "Igrave",                             600 },
+  { "Rcommaaccent",                       600 },
+  { "dotlessi",                           600 },
+  { "dotaccent",                          600 },
+  { "igrave",                             600 },
+  { "L",                                  600 },
+  { "uhungarumlaut",                      600 },
+  { "numbersign",                         600 },
+  { "Y",                                  600 },
+  { "Tcaron",                             600 },
+  { "Gbreve",                             600 },
+  { "Eogonek",                            600 },
+  { "w",                                  600 },
+  { "ydieresis",                          600 },
+  { "aring",                              600 },
+  { "commaaccent",                        600 },
+  { "Lacute",                             600 },
+  { "seven",                              600 },
+  { "degree",                             600 },
+  { "Udieresis",                          600 },
+  { "quotesingle",                        600 },
+  { "four",                               600 },
+  { "Ocircumflex",                        600 },
+  { "oe",                                 600 },
+  { "brokenbar",                          600 },
+  { "l",                                  600 },
+  { "breve",                              600 },
+  { "comma",                              600 },
+  { "f",                                  600 },
+  { "aacute",                             600 },
+  { "radical",                            600 },
+  { "d",                                  600 },
+  { "ecaron",                             600 },
+  { "S",                                  600 },
+  { "rcommaaccent",                       600 },
+  { "slash",                              600 },
+  { "tcommaaccent",                       600 },
+  { "edieresis",                          600 },
+  { "equal",                              600 },
+  { "y",                                  600 },
+  { "ogonek",                             600 },
+  { "yacute",                             600 },
+  { "agrave",                             600 },
+  { "Tcommaaccent",                       600 },
+  { "six",                                600 },
+  { "Ccedilla",                           600 },
+  { "ordfeminine",                        600 },
+  { "exclamdown",                         600 },
+  { "Ohungarumlaut",                      600 },
+  { "nine",                               600 },
+  { "zcaron",                             600 },
+  { "Odieresis",                          600 },
+  { "Gcommaaccent",                       600 },
+  { "Iogonek",                            600 },
+  { "N",                                  600 },
+  { "Aogonek",                            600 },
+  { "Adieresis",                          600 },
+  { "braceleft",                          600 },
+  { "Abreve",                             600 },
+  { "uogonek",                            600 },
+  { "dagger",                             600 },
+  { "ellipsis",                           600 },
+  { "iacute",                             600 },
+  { "edotaccent",                         600 },
+  { "bullet",                             600 },
+  { "Imacron",                            600 },
+  { "egrave",                             600 },
+  { "paragraph",                          600 },
+  { "Otilde",                             600 },
+  { "Kcommaaccent",                       600 },
+  { "eacute",                             600 },
+  { "OE",                                 600 },
+  { "Acircumflex",                        600 },
+  { "two",                                600 },
+  { "Uogonek",                            600 },
+  { "Egrave",                             600 },
+  { "ncaron",                             600 },
+  { "h",                                  600 },
+  { "q",                                  600 },
+  { "circumflex",                         600 },
+  { "E",                                  600 },
+  { "Ccaron",                             600 },
+  { "fl",                                 600 },
+  { "F",                                  600 },
+  { "Ecircumflex",                        600 },
+  { "Zcaron",                             600 },
+  { "abreve",                             600 }
 };
 
-static BuiltinFontWidth helveticaBoldWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            611, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      611, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            400, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 722, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 556, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           611, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          611, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 611, NULL },
-  { "c",                                 556, NULL },
-  { "d",                                 611, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 611, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 611, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 889, NULL },
-  { "n",                                 611, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 611, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 611, NULL },
-  { "q",                                 611, NULL },
-  { "uhungarumlaut",                     611, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 556, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 611, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 556, NULL },
-  { "w",                                 778, NULL },
-  { "x",                                 556, NULL },
-  { "y",                                 556, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          474, NULL },
-  { "gcommaaccent",                      611, NULL },
-  { "mu",                                611, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            556, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            611, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            611, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            556, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       238, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            611, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       611, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        278, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           611, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         611, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            611, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         611, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         556, NULL },
-  { "tilde",                             333, NULL },
-  { "dbldaggerumlaut",                   556, NULL },
-  { "at",                                975, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               611, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            611, NULL },
-  { "braceleft",                         389, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      556, NULL },
-  { "ccedilla",                          556, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            611, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          556, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            611, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             611, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         556, NULL },
-  { "dcaron",                            743, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       611, NULL },
-  { "oacute",                            611, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            389, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       584, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           611, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         722, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             611, NULL },
-  { "quotesinglbase",                    278, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     611, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            611, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            556, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                611, NULL },
-  { "fl",                                611, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            556, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        389, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            556, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               280, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         280, NULL },
-  { "quoteleft",                         278, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const Gushort courierBoldObliqueWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
 };
 
-static BuiltinFontWidth helveticaBoldObliqueWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            611, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      611, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            400, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 722, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 556, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           611, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          611, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 611, NULL },
-  { "c",                                 556, NULL },
-  { "d",                                 611, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 611, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 611, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 889, NULL },
-  { "n",                                 611, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 611, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 611, NULL },
-  { "q",                                 611, NULL },
-  { "uhungarumlaut",                     611, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 556, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 611, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 556, NULL },
-  { "w",                                 778, NULL },
-  { "x",                                 556, NULL },
-  { "y",                                 556, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          474, NULL },
-  { "gcommaaccent",                      611, NULL },
-  { "mu",                                611, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            556, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            611, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            611, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            556, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       238, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            611, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       611, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        278, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           611, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         611, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            611, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         611, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         556, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                975, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               611, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            611, NULL },
-  { "braceleft",                         389, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      556, NULL },
-  { "ccedilla",                          556, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            611, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          556, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            611, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             611, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         556, NULL },
-  { "dcaron",                            743, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       611, NULL },
-  { "oacute",                            611, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            389, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       584, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           611, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         722, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             611, NULL },
-  { "quotesinglbase",                    278, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     611, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            611, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            556, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                611, NULL },
-  { "fl",                                611, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            556, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        389, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            556, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               280, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         280, NULL },
-  { "quoteleft",                         278, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const BuiltinFontWidth courierObliqueWidthsTab[] = {
+  { "J",                                  600 },
+  { "scedilla",                           600 },
+  { "Euro",                               600 },
+  { "plusminus",                          600 },
+  { "grave",                              600 },
+  { "b",                                  600 },
+  { "iogonek",                            600 },
+  { "Uhungarumlaut",                      600 },
+  { "bar",                                600 },
+  { "multiply",                           600 },
+  { "ccedilla",                           600 },
+  { "ecircumflex",                        600 },
+  { "n",                                  600 },
+  { "Atilde",                             600 },
+  { "tilde",                              600 },
+  { "Ecaron",                             600 },
+  { "Edotaccent",                         600 },
+  { "uacute",                             600 },
+  { "e",                                  600 },
+  { "registered",                         600 },
+  { "Icircumflex",                        600 },
+  { "fi",                                 600 },
+  { "Uacute",                             600 },
+  { "braceright",                         600 },
+  { "asciitilde",                         600 },
+  { "percent",                            600 },
+  { "Lcommaaccent",                       600 },
+  { "oslash",                             600 },
+  { "Dcroat",                             600 },
+  { "I",                                  600 },
+  { "z",                                  600 },
+  { "kcommaaccent",                       600 },
+  { "Racute",                             600 },
+  { "summation",                          600 },
+  { "greaterequal",                       600 },
+  { "ring",                               600 },
+  { "X",                                  600 },
+  { "Ntilde",                             600 },
+  { "dieresis",                           600 },
+  { "divide",                             600 },
+  { "Uring",                              600 },
+  { "Idotaccent",                         600 },
+  { "quotedbl",                           600 },
+  { "Scommaaccent",                       600 },
+  { "A",                                  600 },
+  { "scommaaccent",                       600 },
+  { "Amacron",                            600 },
+  { "C",                                  600 },
+  { "bracketleft",                        600 },
+  { "three",                              600 },
+  { "emacron",                            600 },
+  { "notequal",                           600 },
+  { "caron",                              600 },
+  { "acircumflex",                        600 },
+  { "lcaron",                             600 },
+  { "copyright",                          600 },
+  { "emdash",                             600 },
+  { "icircumflex",                        600 },
+  { "cent",                               600 },
+  { "Z",                                  600 },
+  { "quotedblbase",                       600 },
+  { "ncommaaccent",                       600 },
+  { "racute",                             600 },
+  { "k",                                  600 },
+  { "o",                                  600 },
+  { "ordmasculine",                       600 },
+  { "cedilla",                            600 },
+  { "greater",                            600 },
+  { "Aacute",                             600 },
+  { "Eth",                                600 },
+  { "colon",                              600 },
+  { "c",                                  600 },
+  { "lozenge",                            600 },
+  { "Agrave",                             600 },
+  { "Emacron",                            600 },
+  { "Zacute",                             600 },
+  { "macron",                             600 },
+  { "germandbls",                         600 },
+  { "s",                                  600 },
+  { "eight",                              600 },
+  { "P",                                  600 },
+  { "Q",                                  600 },
+  { "R",                                  600 },
+  { "ae",                                 600 },
+  { "one",                                600 },
+  { "U",                                  600 },
+  { "Edieresis",                          600 },
+  { "currency",                           600 },
+  { "K",                                  600 },
+  { "guilsinglleft",                      600 },
+  { "onehalf",                            600 },
+  { "hungarumlaut",                       600 },
+  { "Oslash",                             600 },
+  { "Dcaron",                             600 },
+  { "Aring",                              600 },
+  { "five",                               600 },
+  { "T",                                  600 },
+  { "endash",                             600 },
+  { "lacute",                             600 },
+  { "umacron",                            600 },
+  { "V",                                  600 },
+  { "Ncaron",                             600 },
+  { "Omacron",                            600 },
+  { "g",                                  600 },
+  { "p",                                  600 },
+  { "Rcaron",                             600 },
+  { "quoteright",                         600 },
+  { "O",                                  600 },
+  { "lcommaaccent",                       600 },
+  { "exclam",                             600 },
+  { "idieresis",                          600 },
+  { "zacute",                             600 },
+  { "gbreve",                             600 },
+  { "underscore",                         600 },
+  { "Sacute",                             600 },
+  { "aogonek",                            600 },
+  { "section",                            600 },
+  { "Cacute",                             600 },
+  { "florin",                             600 },
+  { "odieresis",                          600 },
+  { "gcommaaccent",                       600 },
+  { "nacute",                             600 },
+  { "Lslash",                             600 },
+  { "quoteleft",                          600 },
+  { "W",                                  600 },
+  { "plus",                               600 },
+  { "ampersand",                          600 },
+  { "ntilde",                             600 },
+  { "sterling",                           600 },
+  { "minus",                              600 },
+  { "imacron",                            600 },
+  { "ograve",                             600 },
+  { "AE",                                 600 },
+  { "space",                              600 },
+  { "atilde",                             600 },
+  { "udieresis",                          600 },
+  { "parenright",                         600 },
+  { "semicolon",                          600 },
+  { "trademark",                          600 },
+  { "adieresis",                          600 },
+  { "oacute",                             600 },
+  { "Ucircumflex",                        600 },
+  { "acute",                              600 },
+  { "yen",                                600 },
+  { "Scedilla",                           600 },
+  { "Zdotaccent",                         600 },
+  { "dcaron",                             600 },
+  { "mu",                                 600 },
+  { "a",                                  600 },
+  { "v",                                  600 },
+  { "at",                                 600 },
+  { "eogonek",                            600 },
+  { "j",                                  600 },
+  { "perthousand",                        600 },
+  { "Ograve",                             600 },
+  { "partialdiff",                        600 },
+  { "thorn",                              600 },
+  { "otilde",                             600 },
+  { "m",                                  600 },
+  { "dcroat",                             600 },
+  { "i",                                  600 },
+  { "asterisk",                           600 },
+  { "Idieresis",                          600 },
+  { "G",                                  600 },
+  { "Oacute",                             600 },
+  { "H",                                  600 },
+  { "scaron",                             600 },
+  { "quotesinglbase",                     600 },
+  { "Iacute",                             600 },
+  { "ugrave",                             600 },
+  { "Ugrave",                             600 },
+  { "questiondown",                       600 },
+  { "amacron",                            600 },
+  { "Ydieresis",                          600 },
+  { "less",                               600 },
+  { "Thorn",                              600 },
+  { "logicalnot",                         600 },
+  { "twosuperior",                        600 },
+  { "uring",                              600 },
+  { "guilsinglright",                     600 },
+  { "r",                                  600 },
+  { "bracketright",                       600 },
+  { "Yacute",                             600 },
+  { "Scaron",                             600 },
+  { "hyphen",                             600 },
+  { "t",                                  600 },
+  { "u",                                  600 },
+  { "B",                                  600 },
+  { "periodcentered",                     600 },
+  { "eth",                                600 },
+  { "Delta",                              600 },
+  { "parenleft",                          600 },
+  { "M",                                  600 },
+  { "guillemotleft",                      600 },
+  { "ocircumflex",                        600 },
+  { "ccaron",                             600 },
+  { "quotedblleft",                       600 },
+  { "Umacron",                            600 },
+  { "Ncommaaccent",                       600 },
+  { "x",                                  600 },
+  { "onesuperior",                        600 },
+  { "Nacute",                             600 },
+  { "lessequal",                          600 },
+  { "question",                           600 },
+  { "dollar",                             600 },
+  { "daggerdbl",                          600 },
+  { "Lcaron",                             600 },
+  { "omacron",                            600 },
+  { "Eacute",                             600 },
+  { "D",                                  600 },
+  { "sacute",                             600 },
+  { "ohungarumlaut",                      600 },
+  { "cacute",                             600 },
+  { "rcaron",                             600 },
+  { "zdotaccent",                         600 },
+  { "threesuperior",                      600 },
+  { "zero",                               600 },
+  { "guillemotright",                     600 },
+  { "asciicircum",                        600 },
+  { "backslash",                          600 },
+  { "lslash",                             600 },
+  { "onequarter",                         600 },
+  { "fraction",                           600 },
+  { "threequarters",                      600 },
+  { "quotedblright",                      600 },
+  { "period",                             600 },
+  { "ucircumflex",                        600 },
+  { "tcaron",                             600 },
+  { "Igrave",                             600 },
+  { "Rcommaaccent",                       600 },
+  { "dotlessi",                           600 },
+  { "dotaccent",                          600 },
+  { "igrave",                             600 },
+  { "L",                                  600 },
+  { "uhungarumlaut",                      600 },
+  { "numbersign",                         600 },
+  { "Y",                                  600 },
+  { "Tcaron",                             600 },
+  { "Gbreve",                             600 },
+  { "Eogonek",                            600 },
+  { "w",                                  600 },
+  { "ydieresis",                          600 },
+  { "aring",                              600 },
+  { "commaaccent",                        600 },
+  { "Lacute",                             600 },
+  { "seven",                              600 },
+  { "degree",                             600 },
+  { "Udieresis",                          600 },
+  { "quotesingle",                        600 },
+  { "four",                               600 },
+  { "Ocircumflex",                        600 },
+  { "oe",                                 600 },
+  { "brokenbar",                          600 },
+  { "l",                                  600 },
+  { "breve",                              600 },
+  { "comma",                              600 },
+  { "f",                                  600 },
+  { "aacute",                             600 },
+  { "radical",                            600 },
+  { "d",                                  600 },
+  { "ecaron",                             600 },
+  { "S",                                  600 },
+  { "rcommaaccent",                       600 },
+  { "slash",                              600 },
+  { "tcommaaccent",                       600 },
+  { "edieresis",                          600 },
+  { "equal",                              600 },
+  { "y",                                  600 },
+  { "ogonek",                             600 },
+  { "yacute",                             600 },
+  { "agrave",                             600 },
+  { "Tcommaaccent",                       600 },
+  { "six",                                600 },
+  { "Ccedilla",                           600 },
+  { "ordfeminine",                        600 },
+  { "exclamdown",                         600 },
+  { "Ohungarumlaut",                      600 },
+  { "nine",                               600 },
+  { "zcaron",                             600 },
+  { "Odieresis",                          600 },
+  { "Gcommaaccent",                       600 },
+  { "Iogonek",                            600 },
+  { "N",                                  600 },
+  { "Aogonek",                            600 },
+  { "Adieresis",                          600 },
+  { "braceleft",                          600 },
+  { "Abreve",                             600 },
+  { "uogonek",                            600 },
+  { "dagger",                             600 },
+  { "ellipsis",                           600 },
+  { "iacute",                             600 },
+  { "edotaccent",                         600 },
+  { "bullet",                             600 },
+  { "Imacron",                            600 },
+  { "egrave",                             600 },
+  { "paragraph",                          600 },
+  { "Otilde",                             600 },
+  { "Kcommaaccent",                       600 },
+  { "eacute",                             600 },
+  { "OE",                                 600 },
+  { "Acircumflex",                        600 },
+  { "two",                                600 },
+  { "Uogonek",                            600 },
+  { "Egrave",                             600 },
+  { "ncaron",                             600 },
+  { "h",                                  600 },
+  { "q",                                  600 },
+  { "circumflex",                         600 },
+  { "E",                                  600 },
+  { "Ccaron",                             600 },
+  { "fl",                                 600 },
+  { "F",                                  600 },
+  { "Ecircumflex",                        600 },
+  { "Zcaron",                             600 },
+  { "abreve",                             600 }
 };
 
-static BuiltinFontWidth helveticaObliqueWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             278, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         584, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        556, NULL },
-  { "asciitilde",                        584, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           834, NULL },
-  { "dollar",                            556, NULL },
-  { "Lcaron",                            556, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             584, NULL },
-  { "Iogonek",                           278, NULL },
-  { "zacute",                            500, NULL },
-  { "yen",                               556, NULL },
-  { "space",                             278, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      611, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             556, NULL },
-  { "numbersign",                        556, NULL },
-  { "lcaron",                            299, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           556, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        834, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 278, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           222, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    278, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           556, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 667, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 667, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            556, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          556, NULL },
-  { "equal",                             584, NULL },
-  { "Y",                                 667, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              556, NULL },
-  { "a",                                 556, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 500, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 556, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 556, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 222, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            556, NULL },
-  { "j",                                 222, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 222, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 556, NULL },
-  { "ordfeminine",                       370, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       333, NULL },
-  { "aacute",                            556, NULL },
-  { "s",                                 500, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            584, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 500, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        278, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          355, NULL },
-  { "gcommaaccent",                      556, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            667, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            611, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            500, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            556, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         556, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            500, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            222, NULL },
-  { "quotedblleft",                      333, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       191, NULL },
-  { "eight",                             556, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            556, NULL },
-  { "oe",                                944, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       556, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         737, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            556, NULL },
-  { "Idieresis",                         278, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               556, NULL },
-  { "emacron",                           556, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       278, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        222, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         667, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            556, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         556, NULL },
-  { "egrave",                            556, NULL },
-  { "edieresis",                         556, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                889, NULL },
-  { "asterisk",                          389, NULL },
-  { "odieresis",                         556, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              556, NULL },
-  { "five",                              556, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      667, NULL },
-  { "threequarters",                     834, NULL },
-  { "guillemotright",                    556, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                               1015, NULL },
-  { "eacute",                            556, NULL },
-  { "underscore",                        556, NULL },
-  { "Euro",                              556, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          584, NULL },
-  { "zero",                              556, NULL },
-  { "eth",                               556, NULL },
-  { "Scedilla",                          667, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         334, NULL },
-  { "Thorn",                             667, NULL },
-  { "zcaron",                            500, NULL },
-  { "scommaaccent",                      500, NULL },
-  { "ccedilla",                          500, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          500, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            556, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        737, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           889, NULL },
-  { "six",                               556, NULL },
-  { "paragraph",                         537, NULL },
-  { "dcaron",                            643, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               556, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            278, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       556, NULL },
-  { "oacute",                            556, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            317, NULL },
-  { "eogonek",                           556, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             556, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      278, NULL },
-  { "Iacute",                            278, NULL },
-  { "ampersand",                         667, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            222, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              584, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    222, NULL },
-  { "lcommaaccent",                      222, NULL },
-  { "Yacute",                            667, NULL },
-  { "ohungarumlaut",                     556, NULL },
-  { "threesuperior",                     333, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           556, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      333, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            556, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       278, NULL },
-  { "guillemotleft",                     556, NULL },
-  { "germandbls",                        611, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             556, NULL },
-  { "Sacute",                            667, NULL },
-  { "ordmasculine",                      365, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          556, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           278, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       556, NULL },
-  { "cacute",                            500, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        334, NULL },
-  { "quotedblright",                     333, NULL },
-  { "amacron",                           556, NULL },
-  { "sacute",                            500, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              556, NULL },
-  { "currency",                          556, NULL },
-  { "logicalnot",                        584, NULL },
-  { "zdotaccent",                        500, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               260, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              584, NULL },
-  { "ecaron",                            556, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            278, NULL },
-  { "period",                            278, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           584, NULL },
-  { "atilde",                            556, NULL },
-  { "brokenbar",                         260, NULL },
-  { "quoteleft",                         222, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       333, NULL }
+static const Gushort courierObliqueWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
 };
 
-static BuiltinFontWidth symbolWidthsTab[] = {
-  { "bracketleftex",                     384, NULL },
-  { "alpha",                             631, NULL },
-  { "union",                             768, NULL },
-  { "infinity",                          713, NULL },
-  { "comma",                             250, NULL },
-  { "copyrightsans",                     790, NULL },
-  { "plusminus",                         549, NULL },
-  { "arrowup",                           603, NULL },
-  { "apple",                             790, NULL },
-  { "parenleftbt",                       384, NULL },
-  { "notelement",                        713, NULL },
-  { "colon",                             278, NULL },
-  { "beta",                              549, NULL },
-  { "braceleftbt",                       494, NULL },
-  { "Lambda",                            686, NULL },
-  { "Phi",                               763, NULL },
-  { "minus",                             549, NULL },
-  { "space",                             250, NULL },
-  { "Sigma",                             592, NULL },
-  { "approxequal",                       549, NULL },
-  { "minute",                            247, NULL },
-  { "circleplus",                        768, NULL },
-  { "Omicron",                           722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lambda",                            549, NULL },
-  { "phi",                               521, NULL },
-  { "aleph",                             823, NULL },
-  { "Tau",                               611, NULL },
-  { "spade",                             753, NULL },
-  { "logicaland",                        603, NULL },
-  { "sigma",                             603, NULL },
-  { "propersuperset",                    713, NULL },
-  { "omicron",                           549, NULL },
-  { "question",                          444, NULL },
-  { "equal",                             549, NULL },
-  { "Epsilon",                           611, NULL },
-  { "emptyset",                          823, NULL },
-  { "diamond",                           753, NULL },
-  { "four",                              500, NULL },
-  { "Mu",                                889, NULL },
-  { "parenlefttp",                       384, NULL },
-  { "club",                              753, NULL },
-  { "bullet",                            460, NULL },
-  { "Omega",                             768, NULL },
-  { "tau",                               439, NULL },
-  { "Upsilon",                           690, NULL },
-  { "bracelefttp",                       494, NULL },
-  { "heart",                             753, NULL },
-  { "divide",                            549, NULL },
-  { "epsilon",                           439, NULL },
-  { "logicalor",                         603, NULL },
-  { "parenleftex",                       384, NULL },
-  { "greaterequal",                      549, NULL },
-  { "mu",                                576, NULL },
-  { "Nu",                                722, NULL },
-  { "therefore",                         863, NULL },
-  { "notsubset",                         713, NULL },
-  { "omega",                             686, NULL },
-  { "semicolon",                         278, NULL },
-  { "element",                           713, NULL },
-  { "upsilon",                           576, NULL },
-  { "existential",                       549, NULL },
-  { "integralbt",                        686, NULL },
-  { "lessequal",                         549, NULL },
-  { "phi1",                              603, NULL },
-  { "lozenge",                           494, NULL },
-  { "trademarkserif",                    890, NULL },
-  { "parenright",                        333, NULL },
-  { "reflexsuperset",                    713, NULL },
-  { "sigma1",                            439, NULL },
-  { "nu",                                521, NULL },
-  { "Gamma",                             603, NULL },
-  { "angleright",                        329, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "Rho",                               556, NULL },
-  { "parenrightbt",                      384, NULL },
-  { "radicalex",                         500, NULL },
-  { "eight",                             500, NULL },
-  { "angleleft",                         329, NULL },
-  { "arrowdbldown",                      603, NULL },
-  { "congruent",                         549, NULL },
-  { "Theta",                             741, NULL },
-  { "intersection",                      768, NULL },
-  { "Pi",                                768, NULL },
-  { "slash",                             278, NULL },
-  { "registerserif",                     790, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "gamma",                             411, NULL },
-  { "bracketleft",                       333, NULL },
-  { "rho",                               549, NULL },
-  { "circlemultiply",                    768, NULL },
-  { "Chi",                               722, NULL },
-  { "theta",                             521, NULL },
-  { "pi",                                549, NULL },
-  { "integraltp",                        686, NULL },
-  { "Eta",                               722, NULL },
-  { "product",                           823, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "propersubset",                      713, NULL },
-  { "bracketrightbt",                    384, NULL },
-  { "trademarksans",                     786, NULL },
-  { "dotmath",                           250, NULL },
-  { "integralex",                        686, NULL },
-  { "chi",                               549, NULL },
-  { "parenrighttp",                      384, NULL },
-  { "eta",                               603, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              750, NULL },
-  { "multiply",                          549, NULL },
-  { "zero",                              500, NULL },
-  { "partialdiff",                       494, NULL },
-  { "angle",                             768, NULL },
-  { "arrowdblleft",                      987, NULL },
-  { "braceleft",                         480, NULL },
-  { "parenrightex",                      384, NULL },
-  { "Rfraktur",                          795, NULL },
-  { "Zeta",                              611, NULL },
-  { "braceex",                           494, NULL },
-  { "arrowdblup",                        603, NULL },
-  { "arrowdown",                         603, NULL },
-  { "Ifraktur",                          686, NULL },
-  { "degree",                            400, NULL },
-  { "Iota",                              333, NULL },
-  { "perpendicular",                     658, NULL },
-  { "radical",                           549, NULL },
-  { "asteriskmath",                      500, NULL },
-  { "percent",                           833, NULL },
-  { "zeta",                              494, NULL },
-  { "six",                               500, NULL },
-  { "two",                               500, NULL },
-  { "weierstrass",                       987, NULL },
-  { "summation",                         713, NULL },
-  { "bracketrighttp",                    384, NULL },
-  { "carriagereturn",                    658, NULL },
-  { "suchthat",                          439, NULL },
-  { "arrowvertex",                       603, NULL },
-  { "Delta",                             612, NULL },
-  { "iota",                              329, NULL },
-  { "arrowhorizex",                     1000, NULL },
-  { "bracketrightex",                    384, NULL },
-  { "bracketright",                      333, NULL },
-  { "ampersand",                         778, NULL },
-  { "plus",                              549, NULL },
-  { "proportional",                      713, NULL },
-  { "delta",                             494, NULL },
-  { "copyrightserif",                    790, NULL },
-  { "bracerightmid",                     494, NULL },
-  { "arrowleft",                         987, NULL },
-  { "second",                            411, NULL },
-  { "arrowdblboth",                     1042, NULL },
-  { "florin",                            500, NULL },
-  { "Psi",                               795, NULL },
-  { "bracerightbt",                      494, NULL },
-  { "bracketleftbt",                     384, NULL },
-  { "seven",                             500, NULL },
-  { "braceleftmid",                      494, NULL },
-  { "notequal",                          549, NULL },
-  { "psi",                               686, NULL },
-  { "equivalence",                       549, NULL },
-  { "universal",                         713, NULL },
-  { "arrowdblright",                     987, NULL },
-  { "braceright",                        480, NULL },
-  { "reflexsubset",                      713, NULL },
-  { "Xi",                                645, NULL },
-  { "theta1",                            631, NULL },
-  { "logicalnot",                        713, NULL },
-  { "Kappa",                             722, NULL },
-  { "similar",                           549, NULL },
-  { "bar",                               200, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              549, NULL },
-  { "registersans",                      790, NULL },
-  { "omega1",                            713, NULL },
-  { "exclam",                            333, NULL },
-  { "Upsilon1",                          620, NULL },
-  { "bracerighttp",                      494, NULL },
-  { "xi",                                493, NULL },
-  { "period",                            250, NULL },
-  { "Alpha",                             722, NULL },
-  { "arrowright",                        987, NULL },
-  { "greater",                           549, NULL },
-  { "bracketlefttp",                     384, NULL },
-  { "kappa",                             549, NULL },
-  { "gradient",                          713, NULL },
-  { "integral",                          274, NULL },
-  { "arrowboth",                        1042, NULL },
-  { "Beta",                              667, NULL }
+static const BuiltinFontWidth helveticaWidthsTab[] = {
+  { "J",                                  500 },
+  { "scedilla",                           500 },
+  { "Euro",                               556 },
+  { "plusminus",                          584 },
+  { "grave",                              333 },
+  { "b",                                  556 },
+  { "iogonek",                            222 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                260 },
+  { "multiply",                           584 },
+  { "ccedilla",                           500 },
+  { "ecircumflex",                        556 },
+  { "n",                                  556 },
+  { "Atilde",                             667 },
+  { "tilde",                              333 },
+  { "Ecaron",                             667 },
+  { "Edotaccent",                         667 },
+  { "uacute",                             556 },
+  { "e",                                  556 },
+  { "registered",                         737 },
+  { "Icircumflex",                        278 },
+  { "fi",                                 500 },
+  { "Uacute",                             722 },
+  { "braceright",                         334 },
+  { "asciitilde",                         584 },
+  { "percent",                            889 },
+  { "Lcommaaccent",                       556 },
+  { "oslash",                             611 },
+  { "Dcroat",                             722 },
+  { "I",                                  278 },
+  { "z",                                  500 },
+  { "kcommaaccent",                       500 },
+  { "Racute",                             722 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  667 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             584 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         278 },
+  { "quotedbl",                           355 },
+  { "Scommaaccent",                       667 },
+  { "A",                                  667 },
+  { "scommaaccent",                       500 },
+  { "Amacron",                            667 },
+  { "C",                                  722 },
+  { "bracketleft",                        278 },
+  { "three",                              556 },
+  { "emacron",                            556 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        556 },
+  { "lcaron",                             299 },
+  { "copyright",                          737 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               556 },
+  { "Z",                                  611 },
+  { "quotedblbase",                       333 },
+  { "ncommaaccent",                       556 },
+  { "racute",                             333 },
+  { "k",                                  500 },
+  { "o",                                  556 },
+  { "ordmasculine",                       365 },
+  { "cedilla",                            333 },
+  { "greater",                            584 },
+  { "Aacute",                             667 },
+  { "Eth",                                722 },
+  { "colon",                              278 },
+  { "c",                                  500 },
+  { "lozenge",                            471 },
+  { "Agrave",                             667 },
+  { "Emacron",                            667 },
+  { "Zacute",                             611 },
+  { "macron",                             333 },
+  { "germandbls",                         611 },
+  { "s",                                  500 },
+  { "eight",                              556 },
+  { "P",                                  667 },
+  { "Q",                                  778 },
+  { "R",                                  722 },
+  { "ae",                                 889 },
+  { "one",                                556 },
+  { "U",                                  722 },
+  { "Edieresis",                          667 },
+  { "currency",                           556 },
+  { "K",                                  667 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            834 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             778 },
+  { "Dcaron",                             722 },
+  { "Aring",                              667 },
+  { "five",                               556 },
+  { "T",                                  611 },
+  { "endash",                             556 },
+  { "lacute",                             222 },
+  { "umacron",                            556 },
+  { "V",                                  667 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            778 },
+  { "g",                                  556 },
+  { "p",                                  556 },
+  { "Rcaron",                             722 },
+  { "quoteright",                         222 },
+  { "O",                                  778 },
+  { "lcommaaccent",                       222 },
+  { "exclam",                             278 },
+  { "idieresis",                          278 },
+  { "zacute",                             500 },
+  { "gbreve",                             556 },
+  { "underscore",                         556 },
+  { "Sacute",                             667 },
+  { "aogonek",                            556 },
+  { "section",                            556 },
+  { "Cacute",                             722 },
+  { "florin",                             556 },
+  { "odieresis",                          556 },
+  { "gcommaaccent",                       556 },
+  { "nacute",                             556 },
+  { "Lslash",                             556 },
+  { "quoteleft",                          222 },
+  { "W",                                  944 },
+  { "plus",                               584 },
+  { "ampersand",                          667 },
+  { "ntilde",                             556 },
+  { "sterling",                           556 },
+  { "minus",                              584 },
+  { "imacron",                            278 },
+  { "ograve",                             556 },
+  { "AE",                                1000 },
+  { "space",                              278 },
+  { "atilde",                             556 },
+  { "udieresis",                          556 },
+  { "parenright",                         333 },
+  { "semicolon",                          278 },
+  { "trademark",                         1000 },
+  { "adieresis",                          556 },
+  { "oacute",                             556 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                556 },
+  { "Scedilla",                           667 },
+  { "Zdotaccent",                         611 },
+  { "dcaron",                             643 },
+  { "mu",                                 556 },
+  { "a",                                  556 },
+  { "v",                                  500 },
+  { "at",                                1015 },
+  { "eogonek",                            556 },
+  { "j",                                  222 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             778 },
+  { "partialdiff",                        476 },
+  { "thorn",                              556 },
+  { "otilde",                             556 },
+  { "m",                                  833 },
+  { "dcroat",                             556 },
+  { "i",                                  222 },
+  { "asterisk",                           389 },
+  { "Idieresis",                          278 },
+  { "G",                                  778 },
+  { "Oacute",                             778 },
+  { "H",                                  722 },
+  { "scaron",                             500 },
+  { "quotesinglbase",                     222 },
+  { "Iacute",                             278 },
+  { "ugrave",                             556 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       611 },
+  { "amacron",                            556 },
+  { "Ydieresis",                          667 },
+  { "less",                               584 },
+  { "Thorn",                              667 },
+  { "logicalnot",                         584 },
+  { "twosuperior",                        333 },
+  { "uring",                              556 },
+  { "guilsinglright",                     333 },
+  { "r",                                  333 },
+  { "bracketright",                       278 },
+  { "Yacute",                             667 },
+  { "Scaron",                             667 },
+  { "hyphen",                             333 },
+  { "t",                                  278 },
+  { "u",                                  556 },
+  { "B",                                  667 },
+  { "periodcentered",                     278 },
+  { "eth",                                556 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  833 },
+  { "guillemotleft",                      556 },
+  { "ocircumflex",                        556 },
+  { "ccaron",                             500 },
+  { "quotedblleft",                       333 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  500 },
+  { "onesuperior",                        333 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           556 },
+  { "dollar",                             556 },
+  { "daggerdbl",                          556 },
+  { "Lcaron",                             556 },
+  { "omacron",                            556 },
+  { "Eacute",                             667 },
+  { "D",                                  722 },
+  { "sacute",                             500 },
+  { "ohungarumlaut",                      556 },
+  { "cacute",                             500 },
+  { "rcaron",                             333 },
+  { "zdotaccent",                         500 },
+  { "threesuperior",                      333 },
+  { "zero",                               556 },
+  { "guillemotright",                     556 },
+  { "asciicircum",                        469 },
+  { "backslash",                          278 },
+  { "lslash",                             222 },
+  { "onequarter",                         834 },
+  { "fraction",                           167 },
+  { "threequarters",                      834 },
+  { "quotedblright",                      333 },
+  { "period",                             278 },
+  { "ucircumflex",                        556 },
+  { "tcaron",                             317 },
+  { "Igrave",                             278 },
+  { "Rcommaaccent",                       722 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  556 },
+  { "uhungarumlaut",                      556 },
+  { "numbersign",                         556 },
+  { "Y",                                  667 },
+  { "Tcaron",                             611 },
+  { "Gbreve",                             778 },
+  { "Eogonek",                            667 },
+  { "w",                                  722 },
+  { "ydieresis",                          500 },
+  { "aring",                              556 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             556 },
+  { "seven",                              556 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        191 },
+  { "four",                               556 },
+  { "Ocircumflex",                        778 },
+  { "oe",                                 944 },
+  { "brokenbar",                          260 },
+  { "l",                                  222 },
+  { "breve",                              333 },
+  { "comma",                              278 },
+  { "f",                                  278 },
+  { "aacute",                             556 },
+  { "radical",                            453 },
+  { "d",                                  556 },
+  { "ecaron",                             556 },
+  { "S",                                  667 },
+  { "rcommaaccent",                       333 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       278 },
+  { "edieresis",                          556 },
+  { "equal",                              584 },
+  { "y",                                  500 },
+  { "ogonek",                             333 },
+  { "yacute",                             500 },
+  { "agrave",                             556 },
+  { "Tcommaaccent",                       611 },
+  { "six",                                556 },
+  { "Ccedilla",                           722 },
+  { "ordfeminine",                        370 },
+  { "exclamdown",                         333 },
+  { "Ohungarumlaut",                      778 },
+  { "nine",                               556 },
+  { "zcaron",                             500 },
+  { "Odieresis",                          778 },
+  { "Gcommaaccent",                       778 },
+  { "Iogonek",                            278 },
+  { "N",                                  722 },
+  { "Aogonek",                            667 },
+  { "Adieresis",                          667 },
+  { "braceleft",                          334 },
+  { "Abreve",                             667 },
+  { "uogonek",                            556 },
+  { "dagger",                             556 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         556 },
+  { "bullet",                             350 },
+  { "Imacron",                            278 },
+  { "egrave",                             556 },
+  { "paragraph",                          537 },
+  { "Otilde",                             778 },
+  { "Kcommaaccent",                       667 },
+  { "eacute",                             556 },
+  { "OE",                                1000 },
+  { "Acircumflex",                        667 },
+  { "two",                                556 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             667 },
+  { "ncaron",                             556 },
+  { "h",                                  556 },
+  { "q",                                  556 },
+  { "circumflex",                         333 },
+  { "E",                                  667 },
+  { "Ccaron",                             722 },
+  { "fl",                                 500 },
+  { "F",                                  611 },
+  { "Ecircumflex",                        667 },
+  { "Zcaron",                             611 },
+  { "abreve",                             556 }
 };
 
-static BuiltinFontWidth timesBoldWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            444, NULL },
-  { "kcommaaccent",                      556, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            667, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         570, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        520, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            667, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             570, NULL },
-  { "Iogonek",                           389, NULL },
-  { "zacute",                            444, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           778, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            394, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 722, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 778, NULL },
-  { "H",                                 778, NULL },
-  { "I",                                 389, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 778, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 667, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 944, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      667, NULL },
-  { "O",                                 778, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 778, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 722, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 667, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 722, NULL },
-  { "W",                                1000, NULL },
-  { "X",                                 722, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             570, NULL },
-  { "Y",                                 722, NULL },
-  { "Z",                                 667, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      778, NULL },
-  { "b",                                 556, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 556, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            778, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 333, NULL },
-  { "k",                                 556, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 833, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      333, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       300, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 556, NULL },
-  { "q",                                 556, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 444, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                               1000, NULL },
-  { "t",                                 333, NULL },
-  { "divide",                            570, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            722, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 444, NULL },
-  { "Gbreve",                            778, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        389, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          555, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                556, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            667, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            778, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                               1000, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       278, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         747, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         389, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         778, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         722, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                722, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            667, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          722, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                930, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          570, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            778, NULL },
-  { "Racute",                            722, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         394, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            444, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            556, NULL },
-  { "Ocircumflex",                       778, NULL },
-  { "Oacute",                            778, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            444, NULL },
-  { "Tcaron",                            667, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             556, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        747, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                          1000, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         540, NULL },
-  { "dcaron",                            672, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            389, NULL },
-  { "Lacute",                            667, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      667, NULL },
-  { "tcaron",                            416, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     778, NULL },
-  { "asciicircum",                       581, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            389, NULL },
-  { "ampersand",                         833, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              570, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            722, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      722, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            722, NULL },
-  { "Icircumflex",                       389, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        556, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      330, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           389, NULL },
-  { "rcommaaccent",                      444, NULL },
-  { "Zdotaccent",                        667, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        394, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        570, NULL },
-  { "zdotaccent",                        444, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               220, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              570, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            722, NULL },
-  { "Kcommaaccent",                      778, NULL },
-  { "greater",                           570, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         220, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       300, NULL }
+static const Gushort helveticaWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
 };
 
-static BuiltinFontWidth timesBoldItalicWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         570, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        570, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            556, NULL },
-  { "Aogonek",                           667, NULL },
-  { "ncommaaccent",                      556, NULL },
-  { "minus",                             606, NULL },
-  { "Iogonek",                           389, NULL },
-  { "zacute",                            389, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            667, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            382, NULL },
-  { "A",                                 667, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 667, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 667, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 778, NULL },
-  { "I",                                 389, NULL },
-  { "J",                                 500, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 889, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 667, NULL },
-  { "Aacute",                            667, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 667, NULL },
-  { "W",                                 889, NULL },
-  { "X",                                 667, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             570, NULL },
-  { "Y",                                 611, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 556, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 778, NULL },
-  { "n",                                 556, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       266, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     556, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                944, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            570, NULL },
-  { "u",                                 556, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 444, NULL },
-  { "w",                                 667, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 444, NULL },
-  { "z",                                 389, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        389, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          555, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                576, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           494, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       667, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                        1000, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            556, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           667, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                944, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      500, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       278, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        389, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            667, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         667, NULL },
-  { "copyright",                         747, NULL },
-  { "Egrave",                            667, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         667, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         389, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       556, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         611, NULL },
-  { "umacron",                           556, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            667, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                722, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            556, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         556, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         444, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                832, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          570, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            667, NULL },
-  { "partialdiff",                       494, NULL },
-  { "uacute",                            556, NULL },
-  { "braceleft",                         348, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            389, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           667, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        747, NULL },
-  { "radical",                           549, NULL },
-  { "Aring",                             667, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         500, NULL },
-  { "dcaron",                            608, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            389, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            366, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       570, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           556, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            389, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              570, NULL },
-  { "uring",                             556, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            611, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      500, NULL },
-  { "ncaron",                            556, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            444, NULL },
-  { "Rcommaaccent",                      667, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       667, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       389, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           667, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      300, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           389, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            667, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        348, NULL },
-  { "quotedblright",                     500, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        606, NULL },
-  { "zdotaccent",                        389, NULL },
-  { "Atilde",                            667, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               220, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              570, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            389, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            667, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           570, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         220, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        667, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth helveticaBoldWidthsTab[] = {
+  { "Agrave",                             722 },
+  { "Ncaron",                             722 },
+  { "colon",                              333 },
+  { "Zcaron",                             611 },
+  { "onehalf",                            834 },
+  { "dollar",                             556 },
+  { "t",                                  333 },
+  { "abreve",                             556 },
+  { "h",                                  611 },
+  { "ecircumflex",                        556 },
+  { "ae",                                 889 },
+  { "G",                                  778 },
+  { "OE",                                1000 },
+  { "Scedilla",                           667 },
+  { "yacute",                             556 },
+  { "bracketleft",                        333 },
+  { "copyright",                          737 },
+  { "Icircumflex",                        278 },
+  { "lacute",                             278 },
+  { "eogonek",                            556 },
+  { "four",                               556 },
+  { "v",                                  556 },
+  { "guillemotleft",                      556 },
+  { "Scommaaccent",                       667 },
+  { "scedilla",                           556 },
+  { "B",                                  722 },
+  { "circumflex",                         333 },
+  { "less",                               584 },
+  { "threesuperior",                      333 },
+  { "quotedblright",                      500 },
+  { "thorn",                              611 },
+  { "uhungarumlaut",                      611 },
+  { "quotedbl",                           474 },
+  { "C",                                  722 },
+  { "onequarter",                         834 },
+  { "greater",                            584 },
+  { "ugrave",                             611 },
+  { "Egrave",                             667 },
+  { "Eth",                                722 },
+  { "X",                                  667 },
+  { "omacron",                            611 },
+  { "udieresis",                          611 },
+  { "igrave",                             278 },
+  { "period",                             278 },
+  { "ccedilla",                           556 },
+  { "Gcommaaccent",                       778 },
+  { "degree",                             400 },
+  { "Dcaron",                             722 },
+  { "paragraph",                          556 },
+  { "lcaron",                             400 },
+  { "parenleft",                          333 },
+  { "Dcroat",                             722 },
+  { "ccaron",                             556 },
+  { "logicalnot",                         584 },
+  { "scaron",                             556 },
+  { "Tcommaaccent",                       611 },
+  { "dagger",                             556 },
+  { "W",                                  944 },
+  { "ring",                               333 },
+  { "u",                                  611 },
+  { "Uhungarumlaut",                      722 },
+  { "Eacute",                             667 },
+  { "Ocircumflex",                        778 },
+  { "ncaron",                             611 },
+  { "Zdotaccent",                         611 },
+  { "uogonek",                            611 },
+  { "lcommaaccent",                       278 },
+  { "Oslash",                             778 },
+  { "cent",                               556 },
+  { "endash",                             556 },
+  { "f",                                  333 },
+  { "Odieresis",                          778 },
+  { "racute",                             389 },
+  { "emacron",                            556 },
+  { "yen",                                556 },
+  { "fi",                                 611 },
+  { "parenright",                         333 },
+  { "Omacron",                            778 },
+  { "quotesinglbase",                     278 },
+  { "ntilde",                             611 },
+  { "iogonek",                            278 },
+  { "Q",                                  778 },
+  { "Ecircumflex",                        667 },
+  { "aring",                              556 },
+  { "T",                                  611 },
+  { "Umacron",                            722 },
+  { "egrave",                             556 },
+  { "at",                                 975 },
+  { "grave",                              333 },
+  { "Oacute",                             778 },
+  { "radical",                            549 },
+  { "section",                            556 },
+  { "quoteright",                         278 },
+  { "tcommaaccent",                       333 },
+  { "question",                           611 },
+  { "U",                                  722 },
+  { "Lslash",                             611 },
+  { "multiply",                           584 },
+  { "semicolon",                          333 },
+  { "V",                                  667 },
+  { "aacute",                             556 },
+  { "questiondown",                       611 },
+  { "oslash",                             611 },
+  { "g",                                  611 },
+  { "guillemotright",                     556 },
+  { "agrave",                             556 },
+  { "braceleft",                          389 },
+  { "florin",                             556 },
+  { "ncommaaccent",                       611 },
+  { "m",                                  889 },
+  { "P",                                  667 },
+  { "p",                                  611 },
+  { "e",                                  556 },
+  { "eth",                                611 },
+  { "perthousand",                       1000 },
+  { "breve",                              333 },
+  { "Idotaccent",                         278 },
+  { "r",                                  389 },
+  { "D",                                  722 },
+  { "ecaron",                             556 },
+  { "ellipsis",                          1000 },
+  { "gcommaaccent",                       611 },
+  { "l",                                  278 },
+  { "cedilla",                            333 },
+  { "Edieresis",                          667 },
+  { "uacute",                             611 },
+  { "q",                                  611 },
+  { "oacute",                             611 },
+  { "umacron",                            611 },
+  { "x",                                  556 },
+  { "commaaccent",                        250 },
+  { "amacron",                            556 },
+  { "Ucircumflex",                        722 },
+  { "N",                                  722 },
+  { "dbldaggerumlaut",                    556 },
+  { "n",                                  611 },
+  { "brokenbar",                          280 },
+  { "tcaron",                             389 },
+  { "macron",                             333 },
+  { "plusminus",                          584 },
+  { "three",                              556 },
+  { "Cacute",                             722 },
+  { "mu",                                 611 },
+  { "sacute",                             556 },
+  { "w",                                  778 },
+  { "E",                                  667 },
+  { "J",                                  556 },
+  { "fl",                                 611 },
+  { "Atilde",                             722 },
+  { "y",                                  556 },
+  { "hungarumlaut",                       333 },
+  { "iacute",                             278 },
+  { "ucircumflex",                        611 },
+  { "eacute",                             556 },
+  { "fraction",                           167 },
+  { "Emacron",                            667 },
+  { "M",                                  833 },
+  { "ydieresis",                          556 },
+  { "j",                                  278 },
+  { "Ccaron",                             722 },
+  { "bracketright",                       333 },
+  { "dcroat",                             611 },
+  { "Ccedilla",                           722 },
+  { "Eogonek",                            667 },
+  { "edotaccent",                         556 },
+  { "Iacute",                             278 },
+  { "backslash",                          278 },
+  { "d",                                  611 },
+  { "caron",                              333 },
+  { "quoteleft",                          278 },
+  { "zcaron",                             500 },
+  { "Edotaccent",                         667 },
+  { "asciitilde",                         584 },
+  { "trademark",                         1000 },
+  { "nacute",                             611 },
+  { "Ncommaaccent",                       722 },
+  { "Kcommaaccent",                       722 },
+  { "Delta",                              612 },
+  { "kcommaaccent",                       556 },
+  { "Igrave",                             278 },
+  { "Z",                                  611 },
+  { "nine",                               556 },
+  { "rcaron",                             389 },
+  { "numbersign",                         556 },
+  { "Yacute",                             667 },
+  { "c",                                  556 },
+  { "Idieresis",                          278 },
+  { "twosuperior",                        333 },
+  { "hyphen",                             333 },
+  { "ocircumflex",                        611 },
+  { "Uring",                              722 },
+  { "percent",                            889 },
+  { "z",                                  500 },
+  { "onesuperior",                        333 },
+  { "ordfeminine",                        370 },
+  { "Otilde",                             778 },
+  { "F",                                  611 },
+  { "ampersand",                          722 },
+  { "zacute",                             500 },
+  { "equal",                              584 },
+  { "Ntilde",                             722 },
+  { "greaterequal",                       549 },
+  { "plus",                               584 },
+  { "cacute",                             556 },
+  { "Scaron",                             667 },
+  { "braceright",                         389 },
+  { "underscore",                         556 },
+  { "Thorn",                              667 },
+  { "Lacute",                             611 },
+  { "Ugrave",                             722 },
+  { "Zacute",                             611 },
+  { "divide",                             584 },
+  { "Euro",                               556 },
+  { "sterling",                           556 },
+  { "one",                                556 },
+  { "S",                                  667 },
+  { "dieresis",                           333 },
+  { "rcommaaccent",                       389 },
+  { "H",                                  722 },
+  { "uring",                              611 },
+  { "Ohungarumlaut",                      778 },
+  { "ogonek",                             333 },
+  { "dotlessi",                           278 },
+  { "o",                                  611 },
+  { "five",                               556 },
+  { "Sacute",                             667 },
+  { "lslash",                             278 },
+  { "R",                                  722 },
+  { "quotedblleft",                       500 },
+  { "exclamdown",                         333 },
+  { "Y",                                  667 },
+  { "eight",                              556 },
+  { "Adieresis",                          722 },
+  { "asterisk",                           389 },
+  { "adieresis",                          556 },
+  { "scommaaccent",                       556 },
+  { "daggerdbl",                          556 },
+  { "atilde",                             556 },
+  { "bullet",                             350 },
+  { "Uogonek",                            722 },
+  { "lozenge",                            494 },
+  { "zero",                               556 },
+  { "periodcentered",                     278 },
+  { "currency",                           556 },
+  { "K",                                  722 },
+  { "Uacute",                             722 },
+  { "Tcaron",                             611 },
+  { "guilsinglleft",                      333 },
+  { "emdash",                            1000 },
+  { "notequal",                           549 },
+  { "Ecaron",                             667 },
+  { "L",                                  611 },
+  { "two",                                556 },
+  { "otilde",                             611 },
+  { "a",                                  556 },
+  { "oe",                                 944 },
+  { "acircumflex",                        556 },
+  { "minus",                              584 },
+  { "gbreve",                             611 },
+  { "odieresis",                          611 },
+  { "Udieresis",                          722 },
+  { "dotaccent",                          333 },
+  { "Aacute",                             722 },
+  { "Aring",                              722 },
+  { "partialdiff",                        494 },
+  { "slash",                              278 },
+  { "O",                                  778 },
+  { "Imacron",                            278 },
+  { "edieresis",                          556 },
+  { "aogonek",                            556 },
+  { "Lcaron",                             611 },
+  { "Aogonek",                            722 },
+  { "ograve",                             611 },
+  { "I",                                  278 },
+  { "Rcaron",                             722 },
+  { "A",                                  722 },
+  { "Racute",                             722 },
+  { "Iogonek",                            278 },
+  { "registered",                         737 },
+  { "Amacron",                            722 },
+  { "imacron",                            278 },
+  { "Acircumflex",                        722 },
+  { "space",                              278 },
+  { "Lcommaaccent",                       611 },
+  { "zdotaccent",                         500 },
+  { "exclam",                             333 },
+  { "i",                                  278 },
+  { "Nacute",                             722 },
+  { "quotedblbase",                       500 },
+  { "Abreve",                             722 },
+  { "icircumflex",                        278 },
+  { "asciicircum",                        584 },
+  { "seven",                              556 },
+  { "Ydieresis",                          667 },
+  { "six",                                556 },
+  { "ohungarumlaut",                      611 },
+  { "b",                                  611 },
+  { "Rcommaaccent",                       722 },
+  { "tilde",                              333 },
+  { "ordmasculine",                       365 },
+  { "idieresis",                          278 },
+  { "s",                                  556 },
+  { "AE",                                1000 },
+  { "Ograve",                             778 },
+  { "bar",                                280 },
+  { "Gbreve",                             778 },
+  { "dcaron",                             743 },
+  { "threequarters",                      834 },
+  { "germandbls",                         611 },
+  { "summation",                          600 },
+  { "guilsinglright",                     333 },
+  { "lessequal",                          549 },
+  { "acute",                              333 },
+  { "comma",                              278 },
+  { "quotesingle",                        238 },
+  { "k",                                  556 }
 };
 
-static BuiltinFontWidth timesItalicWidthsTab[] = {
-  { "Ntilde",                            667, NULL },
-  { "rcaron",                            389, NULL },
-  { "kcommaaccent",                      444, NULL },
-  { "Ncommaaccent",                      667, NULL },
-  { "Zacute",                            556, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         675, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        541, NULL },
-  { "colon",                             333, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            500, NULL },
-  { "Aogonek",                           611, NULL },
-  { "ncommaaccent",                      500, NULL },
-  { "minus",                             675, NULL },
-  { "Iogonek",                           333, NULL },
-  { "zacute",                            389, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      500, NULL },
-  { "emdash",                            889, NULL },
-  { "Agrave",                            611, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            300, NULL },
-  { "A",                                 611, NULL },
-  { "B",                                 611, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           500, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 611, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 611, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 333, NULL },
-  { "J",                                 444, NULL },
-  { "K",                                 667, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 556, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 833, NULL },
-  { "N",                                 667, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      556, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 611, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 611, NULL },
-  { "Aacute",                            611, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 500, NULL },
-  { "T",                                 556, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            500, NULL },
-  { "V",                                 611, NULL },
-  { "W",                                 833, NULL },
-  { "X",                                 611, NULL },
-  { "question",                          500, NULL },
-  { "equal",                             675, NULL },
-  { "Y",                                 556, NULL },
-  { "Z",                                 556, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 500, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 278, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 500, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 444, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 722, NULL },
-  { "n",                                 500, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       276, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     500, NULL },
-  { "r",                                 389, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            500, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                944, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            675, NULL },
-  { "u",                                 500, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 444, NULL },
-  { "w",                                 667, NULL },
-  { "x",                                 444, NULL },
-  { "y",                                 444, NULL },
-  { "z",                                 389, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        333, NULL },
-  { "Nacute",                            667, NULL },
-  { "quotedbl",                          420, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                500, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            500, NULL },
-  { "Lslash",                            556, NULL },
-  { "semicolon",                         333, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       611, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                         980, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            500, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           611, NULL },
-  { "ellipsis",                          889, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                889, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      556, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       214, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        389, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                667, NULL },
-  { "Abreve",                            611, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         611, NULL },
-  { "copyright",                         760, NULL },
-  { "Egrave",                            611, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         611, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         333, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       500, NULL },
-  { "bracketleft",                       389, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         556, NULL },
-  { "umacron",                           500, NULL },
-  { "abreve",                            500, NULL },
-  { "Eacute",                            611, NULL },
-  { "adieresis",                         500, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                667, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            500, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         500, NULL },
-  { "Zcaron",                            556, NULL },
-  { "Scommaaccent",                      500, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         444, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                920, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          675, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          500, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            611, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            500, NULL },
-  { "braceleft",                         400, NULL },
-  { "Thorn",                             611, NULL },
-  { "zcaron",                            389, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            389, NULL },
-  { "Tcaron",                            556, NULL },
-  { "Eogonek",                           611, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        760, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             611, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         523, NULL },
-  { "dcaron",                            544, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            333, NULL },
-  { "Lacute",                            556, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      556, NULL },
-  { "tcaron",                            300, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       422, NULL },
-  { "aring",                             500, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           500, NULL },
-  { "bracketright",                      389, NULL },
-  { "Iacute",                            333, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            667, NULL },
-  { "plus",                              675, NULL },
-  { "uring",                             500, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            556, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      556, NULL },
-  { "ncaron",                            500, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            444, NULL },
-  { "Rcommaaccent",                      611, NULL },
-  { "fi",                                500, NULL },
-  { "fl",                                500, NULL },
-  { "Acircumflex",                       611, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       333, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           611, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            500, NULL },
-  { "ordmasculine",                      310, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           333, NULL },
-  { "rcommaaccent",                      389, NULL },
-  { "Zdotaccent",                        556, NULL },
-  { "acircumflex",                       500, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            611, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        400, NULL },
-  { "quotedblright",                     556, NULL },
-  { "amacron",                           500, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        675, NULL },
-  { "zdotaccent",                        389, NULL },
-  { "Atilde",                            611, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               275, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              675, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            611, NULL },
-  { "Kcommaaccent",                      667, NULL },
-  { "greater",                           675, NULL },
-  { "atilde",                            500, NULL },
-  { "brokenbar",                         275, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        611, NULL },
-  { "onesuperior",                       300, NULL }
+static const Gushort helveticaBoldWidthsDisp[] = {
+  0, 196, 24, 16, 67, 0, 5, 20, 92, 30, 54, 5,
+  303, 28, 79, 298, 166, 22, 90, 21, 3, 5, 122, 0,
+  4, 1, 25, 52, 6, 2, 1, 40, 7, 14, 24, 104,
+  9, 134, 2, 10, 10, 119, 49, 0, 73, 6, 8, 18,
+  91, 10, 617, 449, 39, 180, 0, 6, 15, 15, 111, 19,
+  93, 0, 39, 38, 37, 205, 1, 1545, 174, 101, 200, 269,
+  328, 356, 2, 167, 105, 3331, 26
 };
 
-static BuiltinFontWidth timesRomanWidthsTab[] = {
-  { "Ntilde",                            722, NULL },
-  { "rcaron",                            333, NULL },
-  { "kcommaaccent",                      500, NULL },
-  { "Ncommaaccent",                      722, NULL },
-  { "Zacute",                            611, NULL },
-  { "comma",                             250, NULL },
-  { "cedilla",                           333, NULL },
-  { "plusminus",                         564, NULL },
-  { "circumflex",                        333, NULL },
-  { "dotaccent",                         333, NULL },
-  { "edotaccent",                        444, NULL },
-  { "asciitilde",                        541, NULL },
-  { "colon",                             278, NULL },
-  { "onehalf",                           750, NULL },
-  { "dollar",                            500, NULL },
-  { "Lcaron",                            611, NULL },
-  { "ntilde",                            500, NULL },
-  { "Aogonek",                           722, NULL },
-  { "ncommaaccent",                      500, NULL },
-  { "minus",                             564, NULL },
-  { "Iogonek",                           333, NULL },
-  { "zacute",                            444, NULL },
-  { "yen",                               500, NULL },
-  { "space",                             250, NULL },
-  { "Omacron",                           722, NULL },
-  { "questiondown",                      444, NULL },
-  { "emdash",                           1000, NULL },
-  { "Agrave",                            722, NULL },
-  { "three",                             500, NULL },
-  { "numbersign",                        500, NULL },
-  { "lcaron",                            344, NULL },
-  { "A",                                 722, NULL },
-  { "B",                                 667, NULL },
-  { "C",                                 667, NULL },
-  { "aogonek",                           444, NULL },
-  { "D",                                 722, NULL },
-  { "E",                                 611, NULL },
-  { "onequarter",                        750, NULL },
-  { "F",                                 556, NULL },
-  { "G",                                 722, NULL },
-  { "H",                                 722, NULL },
-  { "I",                                 333, NULL },
-  { "J",                                 389, NULL },
-  { "K",                                 722, NULL },
-  { "iogonek",                           278, NULL },
-  { "backslash",                         278, NULL },
-  { "L",                                 611, NULL },
-  { "periodcentered",                    250, NULL },
-  { "M",                                 889, NULL },
-  { "N",                                 722, NULL },
-  { "omacron",                           500, NULL },
-  { "Tcommaaccent",                      611, NULL },
-  { "O",                                 722, NULL },
-  { "P",                                 556, NULL },
-  { "Q",                                 722, NULL },
-  { "Uhungarumlaut",                     722, NULL },
-  { "R",                                 667, NULL },
-  { "Aacute",                            722, NULL },
-  { "caron",                             333, NULL },
-  { "S",                                 556, NULL },
-  { "T",                                 611, NULL },
-  { "U",                                 722, NULL },
-  { "agrave",                            444, NULL },
-  { "V",                                 722, NULL },
-  { "W",                                 944, NULL },
-  { "X",                                 722, NULL },
-  { "question",                          444, NULL },
-  { "equal",                             564, NULL },
-  { "Y",                                 722, NULL },
-  { "Z",                                 611, NULL },
-  { "four",                              500, NULL },
-  { "a",                                 444, NULL },
-  { "Gcommaaccent",                      722, NULL },
-  { "b",                                 500, NULL },
-  { "c",                                 444, NULL },
-  { "d",                                 500, NULL },
-  { "e",                                 444, NULL },
-  { "f",                                 333, NULL },
-  { "g",                                 500, NULL },
-  { "bullet",                            350, NULL },
-  { "h",                                 500, NULL },
-  { "i",                                 278, NULL },
-  { "Oslash",                            722, NULL },
-  { "dagger",                            500, NULL },
-  { "j",                                 278, NULL },
-  { "k",                                 500, NULL },
-  { "l",                                 278, NULL },
-  { "m",                                 778, NULL },
-  { "n",                                 500, NULL },
-  { "tcommaaccent",                      278, NULL },
-  { "o",                                 500, NULL },
-  { "ordfeminine",                       276, NULL },
-  { "ring",                              333, NULL },
-  { "p",                                 500, NULL },
-  { "q",                                 500, NULL },
-  { "uhungarumlaut",                     500, NULL },
-  { "r",                                 333, NULL },
-  { "twosuperior",                       300, NULL },
-  { "aacute",                            444, NULL },
-  { "s",                                 389, NULL },
-  { "OE",                                889, NULL },
-  { "t",                                 278, NULL },
-  { "divide",                            564, NULL },
-  { "u",                                 500, NULL },
-  { "Ccaron",                            667, NULL },
-  { "v",                                 500, NULL },
-  { "w",                                 722, NULL },
-  { "x",                                 500, NULL },
-  { "y",                                 500, NULL },
-  { "z",                                 444, NULL },
-  { "Gbreve",                            722, NULL },
-  { "commaaccent",                       250, NULL },
-  { "hungarumlaut",                      333, NULL },
-  { "Idotaccent",                        333, NULL },
-  { "Nacute",                            722, NULL },
-  { "quotedbl",                          408, NULL },
-  { "gcommaaccent",                      500, NULL },
-  { "mu",                                500, NULL },
-  { "greaterequal",                      549, NULL },
-  { "Scaron",                            556, NULL },
-  { "Lslash",                            611, NULL },
-  { "semicolon",                         278, NULL },
-  { "oslash",                            500, NULL },
-  { "lessequal",                         549, NULL },
-  { "lozenge",                           471, NULL },
-  { "parenright",                        333, NULL },
-  { "ccaron",                            444, NULL },
-  { "Ecircumflex",                       611, NULL },
-  { "gbreve",                            500, NULL },
-  { "trademark",                         980, NULL },
-  { "daggerdbl",                         500, NULL },
-  { "nacute",                            500, NULL },
-  { "macron",                            333, NULL },
-  { "Otilde",                            722, NULL },
-  { "Emacron",                           611, NULL },
-  { "ellipsis",                         1000, NULL },
-  { "scaron",                            389, NULL },
-  { "AE",                                889, NULL },
-  { "Ucircumflex",                       722, NULL },
-  { "lslash",                            278, NULL },
-  { "quotedblleft",                      444, NULL },
-  { "guilsinglright",                    333, NULL },
-  { "hyphen",                            333, NULL },
-  { "quotesingle",                       180, NULL },
-  { "eight",                             500, NULL },
-  { "exclamdown",                        333, NULL },
-  { "endash",                            500, NULL },
-  { "oe",                                722, NULL },
-  { "Abreve",                            722, NULL },
-  { "Umacron",                           722, NULL },
-  { "ecircumflex",                       444, NULL },
-  { "Adieresis",                         722, NULL },
-  { "copyright",                         760, NULL },
-  { "Egrave",                            611, NULL },
-  { "slash",                             278, NULL },
-  { "Edieresis",                         611, NULL },
-  { "otilde",                            500, NULL },
-  { "Idieresis",                         333, NULL },
-  { "parenleft",                         333, NULL },
-  { "one",                               500, NULL },
-  { "emacron",                           444, NULL },
-  { "Odieresis",                         722, NULL },
-  { "ucircumflex",                       500, NULL },
-  { "bracketleft",                       333, NULL },
-  { "Ugrave",                            722, NULL },
-  { "quoteright",                        333, NULL },
-  { "Udieresis",                         722, NULL },
-  { "perthousand",                      1000, NULL },
-  { "Ydieresis",                         722, NULL },
-  { "umacron",                           500, NULL },
-  { "abreve",                            444, NULL },
-  { "Eacute",                            611, NULL },
-  { "adieresis",                         444, NULL },
-  { "egrave",                            444, NULL },
-  { "edieresis",                         444, NULL },
-  { "idieresis",                         278, NULL },
-  { "Eth",                               722, NULL },
-  { "ae",                                667, NULL },
-  { "asterisk",                          500, NULL },
-  { "odieresis",                         500, NULL },
-  { "Uacute",                            722, NULL },
-  { "ugrave",                            500, NULL },
-  { "nine",                              500, NULL },
-  { "five",                              500, NULL },
-  { "udieresis",                         500, NULL },
-  { "Zcaron",                            611, NULL },
-  { "Scommaaccent",                      556, NULL },
-  { "threequarters",                     750, NULL },
-  { "guillemotright",                    500, NULL },
-  { "Ccedilla",                          667, NULL },
-  { "ydieresis",                         500, NULL },
-  { "tilde",                             333, NULL },
-  { "at",                                921, NULL },
-  { "eacute",                            444, NULL },
-  { "underscore",                        500, NULL },
-  { "Euro",                              500, NULL },
-  { "Dcroat",                            722, NULL },
-  { "multiply",                          564, NULL },
-  { "zero",                              500, NULL },
-  { "eth",                               500, NULL },
-  { "Scedilla",                          556, NULL },
-  { "Ograve",                            722, NULL },
-  { "Racute",                            667, NULL },
-  { "partialdiff",                       476, NULL },
-  { "uacute",                            500, NULL },
-  { "braceleft",                         480, NULL },
-  { "Thorn",                             556, NULL },
-  { "zcaron",                            444, NULL },
-  { "scommaaccent",                      389, NULL },
-  { "ccedilla",                          444, NULL },
-  { "Dcaron",                            722, NULL },
-  { "dcroat",                            500, NULL },
-  { "Ocircumflex",                       722, NULL },
-  { "Oacute",                            722, NULL },
-  { "scedilla",                          389, NULL },
-  { "ogonek",                            333, NULL },
-  { "ograve",                            500, NULL },
-  { "racute",                            333, NULL },
-  { "Tcaron",                            611, NULL },
-  { "Eogonek",                           611, NULL },
-  { "thorn",                             500, NULL },
-  { "degree",                            400, NULL },
-  { "registered",                        760, NULL },
-  { "radical",                           453, NULL },
-  { "Aring",                             722, NULL },
-  { "percent",                           833, NULL },
-  { "six",                               500, NULL },
-  { "paragraph",                         453, NULL },
-  { "dcaron",                            588, NULL },
-  { "Uogonek",                           722, NULL },
-  { "two",                               500, NULL },
-  { "summation",                         600, NULL },
-  { "Igrave",                            333, NULL },
-  { "Lacute",                            611, NULL },
-  { "ocircumflex",                       500, NULL },
-  { "oacute",                            500, NULL },
-  { "Uring",                             722, NULL },
-  { "Lcommaaccent",                      611, NULL },
-  { "tcaron",                            326, NULL },
-  { "eogonek",                           444, NULL },
-  { "Delta",                             612, NULL },
-  { "Ohungarumlaut",                     722, NULL },
-  { "asciicircum",                       469, NULL },
-  { "aring",                             444, NULL },
-  { "grave",                             333, NULL },
-  { "uogonek",                           500, NULL },
-  { "bracketright",                      333, NULL },
-  { "Iacute",                            333, NULL },
-  { "ampersand",                         778, NULL },
-  { "igrave",                            278, NULL },
-  { "lacute",                            278, NULL },
-  { "Ncaron",                            722, NULL },
-  { "plus",                              564, NULL },
-  { "uring",                             500, NULL },
-  { "quotesinglbase",                    333, NULL },
-  { "lcommaaccent",                      278, NULL },
-  { "Yacute",                            722, NULL },
-  { "ohungarumlaut",                     500, NULL },
-  { "threesuperior",                     300, NULL },
-  { "acute",                             333, NULL },
-  { "section",                           500, NULL },
-  { "dieresis",                          333, NULL },
-  { "iacute",                            278, NULL },
-  { "quotedblbase",                      444, NULL },
-  { "ncaron",                            500, NULL },
-  { "florin",                            500, NULL },
-  { "yacute",                            500, NULL },
-  { "Rcommaaccent",                      667, NULL },
-  { "fi",                                556, NULL },
-  { "fl",                                556, NULL },
-  { "Acircumflex",                       722, NULL },
-  { "Cacute",                            667, NULL },
-  { "Icircumflex",                       333, NULL },
-  { "guillemotleft",                     500, NULL },
-  { "germandbls",                        500, NULL },
-  { "Amacron",                           722, NULL },
-  { "seven",                             500, NULL },
-  { "Sacute",                            556, NULL },
-  { "ordmasculine",                      310, NULL },
-  { "dotlessi",                          278, NULL },
-  { "sterling",                          500, NULL },
-  { "notequal",                          549, NULL },
-  { "Imacron",                           333, NULL },
-  { "rcommaaccent",                      333, NULL },
-  { "Zdotaccent",                        611, NULL },
-  { "acircumflex",                       444, NULL },
-  { "cacute",                            444, NULL },
-  { "Ecaron",                            611, NULL },
-  { "icircumflex",                       278, NULL },
-  { "braceright",                        480, NULL },
-  { "quotedblright",                     444, NULL },
-  { "amacron",                           444, NULL },
-  { "sacute",                            389, NULL },
-  { "imacron",                           278, NULL },
-  { "cent",                              500, NULL },
-  { "currency",                          500, NULL },
-  { "logicalnot",                        564, NULL },
-  { "zdotaccent",                        444, NULL },
-  { "Atilde",                            722, NULL },
-  { "breve",                             333, NULL },
-  { "bar",                               200, NULL },
-  { "fraction",                          167, NULL },
-  { "less",                              564, NULL },
-  { "ecaron",                            444, NULL },
-  { "guilsinglleft",                     333, NULL },
-  { "exclam",                            333, NULL },
-  { "period",                            250, NULL },
-  { "Rcaron",                            667, NULL },
-  { "Kcommaaccent",                      722, NULL },
-  { "greater",                           564, NULL },
-  { "atilde",                            444, NULL },
-  { "brokenbar",                         200, NULL },
-  { "quoteleft",                         333, NULL },
-  { "Edotaccent",                        611, NULL },
-  { "onesuperior",                       300, NULL }
+static const BuiltinFontWidth helveticaBoldObliqueWidthsTab[] = {
+  { "J",                                  556 },
+  { "scedilla",                           556 },
+  { "Euro",                               556 },
+  { "plusminus",                          584 },
+  { "grave",                              333 },
+  { "b",                                  611 },
+  { "iogonek",                            278 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                280 },
+  { "multiply",                           584 },
+  { "ccedilla",                           556 },
+  { "ecircumflex",                        556 },
+  { "n",                                  611 },
+  { "Atilde",                             722 },
+  { "tilde",                              333 },
+  { "Ecaron",                             667 },
+  { "Edotaccent",                         667 },
+  { "uacute",                             611 },
+  { "e",                                  556 },
+  { "registered",                         737 },
+  { "Icircumflex",                        278 },
+  { "fi",                                 611 },
+  { "Uacute",                             722 },
+  { "braceright",                         389 },
+  { "asciitilde",                         584 },
+  { "percent",                            889 },
+  { "Lcommaaccent",                       611 },
+  { "oslash",                             611 },
+  { "Dcroat",                             722 },
+  { "I",                                  278 },
+  { "z",                                  500 },
+  { "kcommaaccent",                       556 },
+  { "Racute",                             722 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  667 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             584 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         278 },
+  { "quotedbl",                           474 },
+  { "Scommaaccent",                       667 },
+  { "A",                                  722 },
+  { "scommaaccent",                       556 },
+  { "Amacron",                            722 },
+  { "C",                                  722 },
+  { "bracketleft",                        333 },
+  { "three",                              556 },
+  { "emacron",                            556 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        556 },
+  { "lcaron",                             400 },
+  { "copyright",                          737 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               556 },
+  { "Z",                                  611 },
+  { "quotedblbase",                       500 },
+  { "ncommaaccent",                       611 },
+  { "racute",                             389 },
+  { "k",                                  556 },
+  { "o",                                  611 },
+  { "ordmasculine",                       365 },
+  { "cedilla",                            333 },
+  { "greater",                            584 },
+  { "Aacute",                             722 },
+  { "Eth",                                722 },
+  { "colon",                              333 },
+  { "c",                                  556 },
+  { "lozenge",                            494 },
+  { "Agrave",                             722 },
+  { "Emacron",                            667 },
+  { "Zacute",                             611 },
+  { "macron",                             333 },
+  { "germandbls",                         611 },
+  { "s",                                  556 },
+  { "eight",                              556 },
+  { "P",                                  667 },
+  { "Q",                                  778 },
+  { "R",                                  722 },
+  { "ae",                                 889 },
+  { "one",                                556 },
+  { "U",                                  722 },
+  { "Edieresis",                          667 },
+  { "currency",                           556 },
+  { "K",                                  722 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            834 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             778 },
+  { "Dcaron",                             722 },
+  { "Aring",                              722 },
+  { "five",                               556 },
+  { "T",                                  611 },
+  { "endash",                             556 },
+  { "lacute",                             278 },
+  { "umacron",                            611 },
+  { "V",                                  667 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            778 },
+  { "g",                                  611 },
+  { "p",                                  611 },
+  { "Rcaron",                             722 },
+  { "quoteright",                         278 },
+  { "O",                                  778 },
+  { "lcommaaccent",                       278 },
+  { "exclam",                             333 },
+  { "idieresis",                          278 },
+  { "zacute",                             500 },
+  { "gbreve",                             611 },
+  { "underscore",                         556 },
+  { "Sacute",                             667 },
+  { "aogonek",                            556 },
+  { "section",                            556 },
+  { "Cacute",                             722 },
+  { "florin",                             556 },
+  { "odieresis",                          611 },
+  { "gcommaaccent",                       611 },
+  { "nacute",                             611 },
+  { "Lslash",                             611 },
+  { "quoteleft",                          278 },
+  { "W",                                  944 },
+  { "plus",                               584 },
+  { "ampersand",                          722 },
+  { "ntilde",                             611 },
+  { "sterling",                           556 },
+  { "minus",                              584 },
+  { "imacron",                            278 },
+  { "ograve",                             611 },
+  { "AE",                                1000 },
+  { "space",                              278 },
+  { "atilde",                             556 },
+  { "udieresis",                          611 },
+  { "parenright",                         333 },
+  { "semicolon",                          333 },
+  { "trademark",                         1000 },
+  { "adieresis",                          556 },
+  { "oacute",                             611 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                556 },
+  { "Scedilla",                           667 },
+  { "Zdotaccent",                         611 },
+  { "dcaron",                             743 },
+  { "mu",                                 611 },
+  { "a",                                  556 },
+  { "v",                                  556 },
+  { "at",                                 975 },
+  { "eogonek",                            556 },
+  { "j",                                  278 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             778 },
+  { "partialdiff",                        494 },
+  { "thorn",                              611 },
+  { "otilde",                             611 },
+  { "m",                                  889 },
+  { "dcroat",                             611 },
+  { "i",                                  278 },
+  { "asterisk",                           389 },
+  { "Idieresis",                          278 },
+  { "G",                                  778 },
+  { "Oacute",                             778 },
+  { "H",                                  722 },
+  { "scaron",                             556 },
+  { "quotesinglbase",                     278 },
+  { "Iacute",                             278 },
+  { "ugrave",                             611 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       611 },
+  { "amacron",                            556 },
+  { "Ydieresis",                          667 },
+  { "less",                               584 },
+  { "Thorn",                              667 },
+  { "logicalnot",                         584 },
+  { "twosuperior",                        333 },
+  { "uring",                              611 },
+  { "guilsinglright",                     333 },
+  { "r",                                  389 },
+  { "bracketright",                       333 },
+  { "Yacute",                             667 },
+  { "Scaron",                             667 },
+  { "hyphen",                             333 },
+  { "t",                                  333 },
+  { "u",                                  611 },
+  { "B",                                  722 },
+  { "periodcentered",                     278 },
+  { "eth",                                611 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  833 },
+  { "guillemotleft",                      556 },
+  { "ocircumflex",                        611 },
+  { "ccaron",                             556 },
+  { "quotedblleft",                       500 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  556 },
+  { "onesuperior",                        333 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           611 },
+  { "dollar",                             556 },
+  { "daggerdbl",                          556 },
+  { "Lcaron",                             611 },
+  { "omacron",                            611 },
+  { "Eacute",                             667 },
+  { "D",                                  722 },
+  { "sacute",                             556 },
+  { "ohungarumlaut",                      611 },
+  { "cacute",                             556 },
+  { "rcaron",                             389 },
+  { "zdotaccent",                         500 },
+  { "threesuperior",                      333 },
+  { "zero",                               556 },
+  { "guillemotright",                     556 },
+  { "asciicircum",                        584 },
+  { "backslash",                          278 },
+  { "lslash",                             278 },
+  { "onequarter",                         834 },
+  { "fraction",                           167 },
+  { "threequarters",                      834 },
+  { "quotedblright",                      500 },
+  { "period",                             278 },
+  { "ucircumflex",                        611 },
+  { "tcaron",                             389 },
+  { "Igrave",                             278 },
+  { "Rcommaaccent",                       722 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  611 },
+  { "uhungarumlaut",                      611 },
+  { "numbersign",                         556 },
+  { "Y",                                  667 },
+  { "Tcaron",                             611 },
+  { "Gbreve",                             778 },
+  { "Eogonek",                            667 },
+  { "w",                                  778 },
+  { "ydieresis",                          556 },
+  { "aring",                              556 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             611 },
+  { "seven",                              556 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        238 },
+  { "four",                               556 },
+  { "Ocircumflex",                        778 },
+  { "oe",                                 944 },
+  { "brokenbar",                          280 },
+  { "l",                                  278 },
+  { "breve",                              333 },
+  { "comma",                              278 },
+  { "f",                                  333 },
+  { "aacute",                             556 },
+  { "radical",                            549 },
+  { "d",                                  611 },
+  { "ecaron",                             556 },
+  { "S",                                  667 },
+  { "rcommaaccent",                       389 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       333 },
+  { "edieresis",                          556 },
+  { "equal",                              584 },
+  { "y",                                  556 },
+  { "ogonek",                             333 },
+  { "yacute",                             556 },
+  { "agrave",                             556 },
+  { "Tcommaaccent",                       611 },
+  { "six",                                556 },
+  { "Ccedilla",                           722 },
+  { "ordfeminine",                        370 },
+  { "exclamdown",                         333 },
+  { "Ohungarumlaut",                      778 },
+  { "nine",                               556 },
+  { "zcaron",                             500 },
+  { "Odieresis",                          778 },
+  { "Gcommaaccent",                       778 },
+  { "Iogonek",                            278 },
+  { "N",                                  722 },
+  { "Aogonek",                            722 },
+  { "Adieresis",                          722 },
+  { "braceleft",                          389 },
+  { "Abreve",                             722 },
+  { "uogonek",                            611 },
+  { "dagger",                             556 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         556 },
+  { "bullet",                             350 },
+  { "Imacron",                            278 },
+  { "egrave",                             556 },
+  { "paragraph",                          556 },
+  { "Otilde",                             778 },
+  { "Kcommaaccent",                       722 },
+  { "eacute",                             556 },
+  { "OE",                                1000 },
+  { "Acircumflex",                        722 },
+  { "two",                                556 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             667 },
+  { "ncaron",                             611 },
+  { "h",                                  611 },
+  { "q",                                  611 },
+  { "circumflex",                         333 },
+  { "E",                                  667 },
+  { "Ccaron",                             722 },
+  { "fl",                                 611 },
+  { "F",                                  611 },
+  { "Ecircumflex",                        667 },
+  { "Zcaron",                             611 },
+  { "abreve",                             556 }
 };
 
-static BuiltinFontWidth zapfDingbatsWidthsTab[] = {
-  { "a81",                               438, NULL },
-  { "a82",                               138, NULL },
-  { "a83",                               277, NULL },
-  { "a84",                               415, NULL },
-  { "a85",                               509, NULL },
-  { "a86",                               410, NULL },
-  { "a87",                               234, NULL },
-  { "a88",                               234, NULL },
-  { "a89",                               390, NULL },
-  { "a140",                              788, NULL },
-  { "a141",                              788, NULL },
-  { "a142",                              788, NULL },
-  { "a143",                              788, NULL },
-  { "a144",                              788, NULL },
-  { "a145",                              788, NULL },
-  { "a146",                              788, NULL },
-  { "a147",                              788, NULL },
-  { "a148",                              788, NULL },
-  { "a149",                              788, NULL },
-  { "a90",                               390, NULL },
-  { "a91",                               276, NULL },
-  { "a92",                               276, NULL },
-  { "space",                             278, NULL },
-  { "a93",                               317, NULL },
-  { "a94",                               317, NULL },
-  { "a95",                               334, NULL },
-  { "a96",                               334, NULL },
-  { "a97",                               392, NULL },
-  { "a98",                               392, NULL },
-  { "a99",                               668, NULL },
-  { "a150",                              788, NULL },
-  { "a151",                              788, NULL },
-  { "a152",                              788, NULL },
-  { "a153",                              788, NULL },
-  { "a154",                              788, NULL },
-  { "a155",                              788, NULL },
-  { "a156",                              788, NULL },
-  { "a157",                              788, NULL },
-  { "a158",                              788, NULL },
-  { "a159",                              788, NULL },
-  { "a160",                              894, NULL },
-  { "a161",                              838, NULL },
-  { "a162",                              924, NULL },
-  { "a163",                             1016, NULL },
-  { "a164",                              458, NULL },
-  { "a165",                              924, NULL },
-  { "a166",                              918, NULL },
-  { "a167",                              927, NULL },
-  { "a168",                              928, NULL },
-  { "a169",                              928, NULL },
-  { "a170",                              834, NULL },
-  { "a171",                              873, NULL },
-  { "a172",                              828, NULL },
-  { "a173",                              924, NULL },
-  { "a174",                              917, NULL },
-  { "a175",                              930, NULL },
-  { "a176",                              931, NULL },
-  { "a177",                              463, NULL },
-  { "a178",                              883, NULL },
-  { "a179",                              836, NULL },
-  { "a180",                              867, NULL },
-  { "a181",                              696, NULL },
-  { "a182",                              874, NULL },
-  { "a183",                              760, NULL },
-  { "a184",                              946, NULL },
-  { "a185",                              865, NULL },
-  { "a186",                              967, NULL },
-  { "a187",                              831, NULL },
-  { "a188",                              873, NULL },
-  { "a189",                              927, NULL },
-  { "a1",                                974, NULL },
-  { "a2",                                961, NULL },
-  { "a3",                                980, NULL },
-  { "a4",                                719, NULL },
-  { "a5",                                789, NULL },
-  { "a6",                                494, NULL },
-  { "a7",                                552, NULL },
-  { "a8",                                537, NULL },
-  { "a9",                                577, NULL },
-  { "a190",                              970, NULL },
-  { "a191",                              918, NULL },
-  { "a192",                              748, NULL },
-  { "a193",                              836, NULL },
-  { "a194",                              771, NULL },
-  { "a195",                              888, NULL },
-  { "a196",                              748, NULL },
-  { "a197",                              771, NULL },
-  { "a198",                              888, NULL },
-  { "a199",                              867, NULL },
-  { "a10",                               692, NULL },
-  { "a11",                               960, NULL },
-  { "a12",                               939, NULL },
-  { "a13",                               549, NULL },
-  { "a14",                               855, NULL },
-  { "a15",                               911, NULL },
-  { "a16",                               933, NULL },
-  { "a17",                               945, NULL },
-  { "a18",                               974, NULL },
-  { "a19",                               755, NULL },
-  { "a20",                               846, NULL },
-  { "a21",                               762, NULL },
-  { "a22",                               761, NULL },
-  { "a23",                               571, NULL },
-  { "a24",                               677, NULL },
-  { "a25",                               763, NULL },
-  { "a26",                               760, NULL },
-  { "a27",                               759, NULL },
-  { "a28",                               754, NULL },
-  { "a29",                               786, NULL },
-  { "a30",                               788, NULL },
-  { "a31",                               788, NULL },
-  { "a32",                               790, NULL },
-  { "a33",                               793, NULL },
-  { "a34",                               794, NULL },
-  { "a35",                               816, NULL },
-  { "a36",                               823, NULL },
-  { "a37",                               789, NULL },
-  { "a38",                               841, NULL },
-  { "a39",                               823, NULL },
-  { "a40",                               833, NULL },
-  { "a41",                               816, NULL },
-  { "a42",                               831, NULL },
-  { "a43",                               923, NULL },
-  { "a44",                               744, NULL },
-  { "a45",                               723, NULL },
-  { "a46",                               749, NULL },
-  { "a47",                               790, NULL },
-  { "a48",                               792, NULL },
-  { "a49",                               695, NULL },
-  { "a100",                              668, NULL },
-  { "a101",                              732, NULL },
-  { "a102",                              544, NULL },
-  { "a103",                              544, NULL },
-  { "a104",                              910, NULL },
-  { "a105",                              911, NULL },
-  { "a106",                              667, NULL },
-  { "a107",                              760, NULL },
-  { "a108",                              760, NULL },
-  { "a109",                              626, NULL },
-  { "a50",                               776, NULL },
-  { "a51",                               768, NULL },
-  { "a52",                               792, NULL },
-  { "a53",                               759, NULL },
-  { "a54",                               707, NULL },
-  { "a55",                               708, NULL },
-  { "a56",                               682, NULL },
-  { "a57",                               701, NULL },
-  { "a58",                               826, NULL },
-  { "a59",                               815, NULL },
-  { "a110",                              694, NULL },
-  { "a111",                              595, NULL },
-  { "a112",                              776, NULL },
-  { "a117",                              690, NULL },
-  { "a118",                              791, NULL },
-  { "a119",                              790, NULL },
-  { "a60",                               789, NULL },
-  { "a61",                               789, NULL },
-  { "a62",                               707, NULL },
-  { "a63",                               687, NULL },
-  { "a64",                               696, NULL },
-  { "a65",                               689, NULL },
-  { "a66",                               786, NULL },
-  { "a67",                               787, NULL },
-  { "a68",                               713, NULL },
-  { "a69",                               791, NULL },
-  { "a200",                              696, NULL },
-  { "a201",                              874, NULL },
-  { "a120",                              788, NULL },
-  { "a121",                              788, NULL },
-  { "a202",                              974, NULL },
-  { "a122",                              788, NULL },
-  { "a203",                              762, NULL },
-  { "a123",                              788, NULL },
-  { "a204",                              759, NULL },
-  { "a124",                              788, NULL },
-  { "a205",                              509, NULL },
-  { "a125",                              788, NULL },
-  { "a206",                              410, NULL },
-  { "a126",                              788, NULL },
-  { "a127",                              788, NULL },
-  { "a128",                              788, NULL },
-  { "a129",                              788, NULL },
-  { "a70",                               785, NULL },
-  { "a71",                               791, NULL },
-  { "a72",                               873, NULL },
-  { "a73",                               761, NULL },
-  { "a74",                               762, NULL },
-  { "a75",                               759, NULL },
-  { "a76",                               892, NULL },
-  { "a77",                               892, NULL },
-  { "a78",                               788, NULL },
-  { "a79",                               784, NULL },
-  { "a130",                              788, NULL },
-  { "a131",                              788, NULL },
-  { "a132",                              788, NULL },
-  { "a133",                              788, NULL },
-  { "a134",                              788, NULL },
-  { "a135",                              788, NULL },
-  { "a136",                              788, NULL },
-  { "a137",                              788, NULL },
-  { "a138",                              788, NULL },
-  { "a139",                              788, NULL }
+static const Gushort helveticaBoldObliqueWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth helveticaObliqueWidthsTab[] = {
+  { "J",                                  500 },
+  { "scedilla",                           500 },
+  { "Euro",                               556 },
+  { "plusminus",                          584 },
+  { "grave",                              333 },
+  { "b",                                  556 },
+  { "iogonek",                            222 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                260 },
+  { "multiply",                           584 },
+  { "ccedilla",                           500 },
+  { "ecircumflex",                        556 },
+  { "n",                                  556 },
+  { "Atilde",                             667 },
+  { "tilde",                              333 },
+  { "Ecaron",                             667 },
+  { "Edotaccent",                         667 },
+  { "uacute",                             556 },
+  { "e",                                  556 },
+  { "registered",                         737 },
+  { "Icircumflex",                        278 },
+  { "fi",                                 500 },
+  { "Uacute",                             722 },
+  { "braceright",                         334 },
+  { "asciitilde",                         584 },
+  { "percent",                            889 },
+  { "Lcommaaccent",                       556 },
+  { "oslash",                             611 },
+  { "Dcroat",                             722 },
+  { "I",                                  278 },
+  { "z",                                  500 },
+  { "kcommaaccent",                       500 },
+  { "Racute",                             722 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  667 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             584 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         278 },
+  { "quotedbl",                           355 },
+  { "Scommaaccent",                       667 },
+  { "A",                                  667 },
+  { "scommaaccent",                       500 },
+  { "Amacron",                            667 },
+  { "C",                                  722 },
+  { "bracketleft",                        278 },
+  { "three",                              556 },
+  { "emacron",                            556 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        556 },
+  { "lcaron",                             299 },
+  { "copyright",                          737 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               556 },
+  { "Z",                                  611 },
+  { "quotedblbase",                       333 },
+  { "ncommaaccent",                       556 },
+  { "racute",                             333 },
+  { "k",                                  500 },
+  { "o",                                  556 },
+  { "ordmasculine",                       365 },
+  { "cedilla",                            333 },
+  { "greater",                            584 },
+  { "Aacute",                             667 },
+  { "Eth",                                722 },
+  { "colon",                              278 },
+  { "c",                                  500 },
+  { "lozenge",                            471 },
+  { "Agrave",                             667 },
+  { "Emacron",                            667 },
+  { "Zacute",                             611 },
+  { "macron",                             333 },
+  { "germandbls",                         611 },
+  { "s",                                  500 },
+  { "eight",                              556 },
+  { "P",                                  667 },
+  { "Q",                                  778 },
+  { "R",                                  722 },
+  { "ae",                                 889 },
+  { "one",                                556 },
+  { "U",                                  722 },
+  { "Edieresis",                          667 },
+  { "currency",                           556 },
+  { "K",                                  667 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            834 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             778 },
+  { "Dcaron",                             722 },
+  { "Aring",                              667 },
+  { "five",                               556 },
+  { "T",                                  611 },
+  { "endash",                             556 },
+  { "lacute",                             222 },
+  { "umacron",                            556 },
+  { "V",                                  667 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            778 },
+  { "g",                                  556 },
+  { "p",                                  556 },
+  { "Rcaron",                             722 },
+  { "quoteright",                         222 },
+  { "O",                                  778 },
+  { "lcommaaccent",                       222 },
+  { "exclam",                             278 },
+  { "idieresis",                          278 },
+  { "zacute",                             500 },
+  { "gbreve",                             556 },
+  { "underscore",                         556 },
+  { "Sacute",                             667 },
+  { "aogonek",                            556 },
+  { "section",                            556 },
+  { "Cacute",                             722 },
+  { "florin",                             556 },
+  { "odieresis",                          556 },
+  { "gcommaaccent",                       556 },
+  { "nacute",                             556 },
+  { "Lslash",                             556 },
+  { "quoteleft",                          222 },
+  { "W",                                  944 },
+  { "plus",                               584 },
+  { "ampersand",                          667 },
+  { "ntilde",                             556 },
+  { "sterling",                           556 },
+  { "minus",                              584 },
+  { "imacron",                            278 },
+  { "ograve",                             556 },
+  { "AE",                                1000 },
+  { "space",                              278 },
+  { "atilde",                             556 },
+  { "udieresis",                          556 },
+  { "parenright",                         333 },
+  { "semicolon",                          278 },
+  { "trademark",                         1000 },
+  { "adieresis",                          556 },
+  { "oacute",                             556 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                556 },
+  { "Scedilla",                           667 },
+  { "Zdotaccent",                         611 },
+  { "dcaron",                             643 },
+  { "mu",                                 556 },
+  { "a",                                  556 },
+  { "v",                                  500 },
+  { "at",                                1015 },
+  { "eogonek",                            556 },
+  { "j",                                  222 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             778 },
+  { "partialdiff",                        476 },
+  { "thorn",                              556 },
+  { "otilde",                             556 },
+  { "m",                                  833 },
+  { "dcroat",                             556 },
+  { "i",                                  222 },
+  { "asterisk",                           389 },
+  { "Idieresis",                          278 },
+  { "G",                                  778 },
+  { "Oacute",                             778 },
+  { "H",                                  722 },
+  { "scaron",                             500 },
+  { "quotesinglbase",                     222 },
+  { "Iacute",                             278 },
+  { "ugrave",                             556 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       611 },
+  { "amacron",                            556 },
+  { "Ydieresis",                          667 },
+  { "less",                               584 },
+  { "Thorn",                              667 },
+  { "logicalnot",                         584 },
+  { "twosuperior",                        333 },
+  { "uring",                              556 },
+  { "guilsinglright",                     333 },
+  { "r",                                  333 },
+  { "bracketright",                       278 },
+  { "Yacute",                             667 },
+  { "Scaron",                             667 },
+  { "hyphen",                             333 },
+  { "t",                                  278 },
+  { "u",                                  556 },
+  { "B",                                  667 },
+  { "periodcentered",                     278 },
+  { "eth",                                556 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  833 },
+  { "guillemotleft",                      556 },
+  { "ocircumflex",                        556 },
+  { "ccaron",                             500 },
+  { "quotedblleft",                       333 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  500 },
+  { "onesuperior",                        333 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           556 },
+  { "dollar",                             556 },
+  { "daggerdbl",                          556 },
+  { "Lcaron",                             556 },
+  { "omacron",                            556 },
+  { "Eacute",                             667 },
+  { "D",                                  722 },
+  { "sacute",                             500 },
+  { "ohungarumlaut",                      556 },
+  { "cacute",                             500 },
+  { "rcaron",                             333 },
+  { "zdotaccent",                         500 },
+  { "threesuperior",                      333 },
+  { "zero",                               556 },
+  { "guillemotright",                     556 },
+  { "asciicircum",                        469 },
+  { "backslash",                          278 },
+  { "lslash",                             222 },
+  { "onequarter",                         834 },
+  { "fraction",                           167 },
+  { "threequarters",                      834 },
+  { "quotedblright",                      333 },
+  { "period",                             278 },
+  { "ucircumflex",                        556 },
+  { "tcaron",                             317 },
+  { "Igrave",                             278 },
+  { "Rcommaaccent",                       722 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  556 },
+  { "uhungarumlaut",                      556 },
+  { "numbersign",                         556 },
+  { "Y",                                  667 },
+  { "Tcaron",                             611 },
+  { "Gbreve",                             778 },
+  { "Eogonek",                            667 },
+  { "w",                                  722 },
+  { "ydieresis",                          500 },
+  { "aring",                              556 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             556 },
+  { "seven",                              556 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        191 },
+  { "four",                               556 },
+  { "Ocircumflex",                        778 },
+  { "oe",                                 944 },
+  { "brokenbar",                          260 },
+  { "l",                                  222 },
+  { "breve",                              333 },
+  { "comma",                              278 },
+  { "f",                                  278 },
+  { "aacute",                             556 },
+  { "radical",                            453 },
+  { "d",                                  556 },
+  { "ecaron",                             556 },
+  { "S",                                  667 },
+  { "rcommaaccent",                       333 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       278 },
+  { "edieresis",                          556 },
+  { "equal",                              584 },
+  { "y",                                  500 },
+  { "ogonek",                             333 },
+  { "yacute",                             500 },
+  { "agrave",                             556 },
+  { "Tcommaaccent",                       611 },
+  { "six",                                556 },
+  { "Ccedilla",                           722 },
+  { "ordfeminine",                        370 },
+  { "exclamdown",                         333 },
+  { "Ohungarumlaut",                      778 },
+  { "nine",                               556 },
+  { "zcaron",                             500 },
+  { "Odieresis",                          778 },
+  { "Gcommaaccent",                       778 },
+  { "Iogonek",                            278 },
+  { "N",                                  722 },
+  { "Aogonek",                            667 },
+  { "Adieresis",                          667 },
+  { "braceleft",                          334 },
+  { "Abreve",                             667 },
+  { "uogonek",                            556 },
+  { "dagger",                             556 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         556 },
+  { "bullet",                             350 },
+  { "Imacron",                            278 },
+  { "egrave",                             556 },
+  { "paragraph",                          537 },
+  { "Otilde",                             778 },
+  { "Kcommaaccent",                       667 },
+  { "eacute",                             556 },
+  { "OE",                                1000 },
+  { "Acircumflex",                        667 },
+  { "two",                                556 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             667 },
+  { "ncaron",                             556 },
+  { "h",                                  556 },
+  { "q",                                  556 },
+  { "circumflex",                         333 },
+  { "E",                                  667 },
+  { "Ccaron",                             722 },
+  { "fl",                                 500 },
+  { "F",                                  611 },
+  { "Ecircumflex",                        667 },
+  { "Zcaron",                             611 },
+  { "abreve",                             556 }
+};
+
+static const Gushort helveticaObliqueWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth symbolWidthsTab[] = {
+  { "club",                               753 },
+  { "bracketrightbt",                     384 },
+  { "arrowdblboth",                      1042 },
+  { "emptyset",                           823 },
+  { "psi",                                686 },
+  { "ampersand",                          778 },
+  { "Kappa",                              722 },
+  { "greater",                            549 },
+  { "radical",                            549 },
+  { "lambda",                             549 },
+  { "numbersign",                         500 },
+  { "circleplus",                         768 },
+  { "bracketrightex",                     384 },
+  { "Alpha",                              722 },
+  { "underscore",                         500 },
+  { "second",                             411 },
+  { "parenlefttp",                        384 },
+  { "period",                             250 },
+  { "ellipsis",                          1000 },
+  { "bar",                                200 },
+  { "five",                               500 },
+  { "theta1",                             631 },
+  { "less",                               549 },
+  { "arrowdblright",                      987 },
+  { "equivalence",                        549 },
+  { "xi",                                 493 },
+  { "braceright",                         480 },
+  { "Omega",                              768 },
+  { "gamma",                              411 },
+  { "sigma",                              603 },
+  { "tau",                                439 },
+  { "parenrightex",                       384 },
+  { "bracketlefttp",                      384 },
+  { "aleph",                              823 },
+  { "iota",                               329 },
+  { "universal",                          713 },
+  { "comma",                              250 },
+  { "eta",                                603 },
+  { "parenrighttp",                       384 },
+  { "parenleftbt",                        384 },
+  { "Iota",                               333 },
+  { "epsilon",                            439 },
+  { "omega1",                             713 },
+  { "Phi",                                763 },
+  { "space",                              250 },
+  { "partialdiff",                        494 },
+  { "arrowup",                            603 },
+  { "Delta",                              612 },
+  { "fraction",                           167 },
+  { "exclam",                             333 },
+  { "spade",                              753 },
+  { "Upsilon1",                           620 },
+  { "question",                           444 },
+  { "arrowvertex",                        603 },
+  { "Psi",                                795 },
+  { "parenleft",                          333 },
+  { "equal",                              549 },
+  { "Lambda",                             686 },
+  { "angleleft",                          329 },
+  { "Sigma",                              592 },
+  { "perpendicular",                      658 },
+  { "summation",                          713 },
+  { "slash",                              278 },
+  { "lozenge",                            494 },
+  { "registersans",                       790 },
+  { "trademarksans",                      786 },
+  { "parenright",                         333 },
+  { "arrowright",                         987 },
+  { "infinity",                           713 },
+  { "arrowdblup",                         603 },
+  { "angle",                              768 },
+  { "trademarkserif",                     890 },
+  { "similar",                            549 },
+  { "registerserif",                      790 },
+  { "percent",                            833 },
+  { "Omicron",                            722 },
+  { "theta",                              521 },
+  { "Nu",                                 722 },
+  { "minute",                             247 },
+  { "propersubset",                       713 },
+  { "phi1",                               603 },
+  { "plusminus",                          549 },
+  { "greaterequal",                       549 },
+  { "braceleft",                          480 },
+  { "mu",                                 576 },
+  { "two",                                500 },
+  { "arrowdblleft",                       987 },
+  { "delta",                              494 },
+  { "Rho",                                556 },
+  { "bullet",                             460 },
+  { "bracerighttp",                       494 },
+  { "bracketrighttp",                     384 },
+  { "alpha",                              631 },
+  { "nine",                               500 },
+  { "eight",                              500 },
+  { "integraltp",                         686 },
+  { "bracketleft",                        333 },
+  { "parenleftex",                        384 },
+  { "logicalnot",                         713 },
+  { "Pi",                                 768 },
+  { "divide",                             549 },
+  { "minus",                              549 },
+  { "logicalor",                          603 },
+  { "bracketleftbt",                      384 },
+  { "beta",                               549 },
+  { "omega",                              686 },
+  { "approxequal",                        549 },
+  { "multiply",                           549 },
+  { "lessequal",                          549 },
+  { "arrowdown",                          603 },
+  { "weierstrass",                        987 },
+  { "bracelefttp",                        494 },
+  { "integral",                           274 },
+  { "Euro",                               750 },
+  { "three",                              500 },
+  { "florin",                             500 },
+  { "heart",                              753 },
+  { "bracerightbt",                       494 },
+  { "carriagereturn",                     658 },
+  { "seven",                              500 },
+  { "notsubset",                          713 },
+  { "Tau",                                611 },
+  { "arrowhorizex",                      1000 },
+  { "Ifraktur",                           686 },
+  { "integralbt",                         686 },
+  { "notelement",                         713 },
+  { "upsilon",                            576 },
+  { "arrowboth",                         1042 },
+  { "pi",                                 549 },
+  { "braceex",                            494 },
+  { "Theta",                              741 },
+  { "zeta",                               494 },
+  { "rho",                                549 },
+  { "Eta",                                722 },
+  { "colon",                              278 },
+  { "reflexsubset",                       713 },
+  { "zero",                               500 },
+  { "apple",                              790 },
+  { "six",                                500 },
+  { "nu",                                 521 },
+  { "bracketright",                       333 },
+  { "gradient",                           713 },
+  { "radicalex",                          500 },
+  { "phi",                                521 },
+  { "omicron",                            549 },
+  { "arrowdbldown",                       603 },
+  { "propersuperset",                     713 },
+  { "chi",                                549 },
+  { "Gamma",                              603 },
+  { "bracketleftex",                      384 },
+  { "bracerightmid",                      494 },
+  { "degree",                             400 },
+  { "proportional",                       713 },
+  { "Mu",                                 889 },
+  { "Beta",                               667 },
+  { "Zeta",                               611 },
+  { "existential",                        549 },
+  { "four",                               500 },
+  { "diamond",                            753 },
+  { "Upsilon",                            690 },
+  { "parenrightbt",                       384 },
+  { "kappa",                              549 },
+  { "suchthat",                           439 },
+  { "congruent",                          549 },
+  { "plus",                               549 },
+  { "copyrightserif",                     790 },
+  { "angleright",                         329 },
+  { "sigma1",                             439 },
+  { "asteriskmath",                       500 },
+  { "braceleftmid",                       494 },
+  { "element",                            713 },
+  { "copyrightsans",                      790 },
+  { "one",                                500 },
+  { "Xi",                                 645 },
+  { "logicaland",                         603 },
+  { "braceleftbt",                        494 },
+  { "arrowleft",                          987 },
+  { "integralex",                         686 },
+  { "dotmath",                            250 },
+  { "circlemultiply",                     768 },
+  { "Epsilon",                            611 },
+  { "Chi",                                722 },
+  { "therefore",                          863 },
+  { "union",                              768 },
+  { "semicolon",                          278 },
+  { "intersection",                       768 },
+  { "reflexsuperset",                     713 },
+  { "product",                            823 },
+  { "notequal",                           549 },
+  { "Rfraktur",                           795 }
+};
+
+static const Gushort symbolWidthsDisp[] = {
+  26, 1, 37, 64, 30, 143, 3, 5, 16, 177, 3, 8,
+  312, 3, 107, 0, 111, 91, 12, 42, 6, 2, 8, 20,
+  309, 15, 0, 551, 163, 2, 5, 71, 141, 524, 947, 646,
+  18, 7, 0, 6, 339, 0, 21, 106, 12, 1385, 302, 81
+};
+
+static const BuiltinFontWidth timesBoldWidthsTab[] = {
+  { "J",                                  500 },
+  { "scedilla",                           389 },
+  { "Euro",                               500 },
+  { "plusminus",                          570 },
+  { "grave",                              333 },
+  { "b",                                  556 },
+  { "iogonek",                            278 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                220 },
+  { "multiply",                           570 },
+  { "ccedilla",                           444 },
+  { "ecircumflex",                        444 },
+  { "n",                                  556 },
+  { "Atilde",                             722 },
+  { "tilde",                              333 },
+  { "Ecaron",                             667 },
+  { "Edotaccent",                         667 },
+  { "uacute",                             556 },
+  { "e",                                  444 },
+  { "registered",                         747 },
+  { "Icircumflex",                        389 },
+  { "fi",                                 556 },
+  { "Uacute",                             722 },
+  { "braceright",                         394 },
+  { "asciitilde",                         520 },
+  { "percent",                           1000 },
+  { "Lcommaaccent",                       667 },
+  { "oslash",                             500 },
+  { "Dcroat",                             722 },
+  { "I",                                  389 },
+  { "z",                                  444 },
+  { "kcommaaccent",                       556 },
+  { "Racute",                             722 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  722 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             570 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         389 },
+  { "quotedbl",                           555 },
+  { "Scommaaccent",                       556 },
+  { "A",                                  722 },
+  { "scommaaccent",                       389 },
+  { "Amacron",                            722 },
+  { "C",                                  722 },
+  { "bracketleft",                        333 },
+  { "three",                              500 },
+  { "emacron",                            444 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        500 },
+  { "lcaron",                             394 },
+  { "copyright",                          747 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               500 },
+  { "Z",                                  667 },
+  { "quotedblbase",                       500 },
+  { "ncommaaccent",                       556 },
+  { "racute",                             444 },
+  { "k",                                  556 },
+  { "o",                                  500 },
+  { "ordmasculine",                       330 },
+  { "cedilla",                            333 },
+  { "greater",                            570 },
+  { "Aacute",                             722 },
+  { "Eth",                                722 },
+  { "colon",                              333 },
+  { "c",                                  444 },
+  { "lozenge",                            494 },
+  { "Agrave",                             722 },
+  { "Emacron",                            667 },
+  { "Zacute",                             667 },
+  { "macron",                             333 },
+  { "germandbls",                         556 },
+  { "s",                                  389 },
+  { "eight",                              500 },
+  { "P",                                  611 },
+  { "Q",                                  778 },
+  { "R",                                  722 },
+  { "ae",                                 722 },
+  { "one",                                500 },
+  { "U",                                  722 },
+  { "Edieresis",                          667 },
+  { "currency",                           500 },
+  { "K",                                  778 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            750 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             778 },
+  { "Dcaron",                             722 },
+  { "Aring",                              722 },
+  { "five",                               500 },
+  { "T",                                  667 },
+  { "endash",                             500 },
+  { "lacute",                             278 },
+  { "umacron",                            556 },
+  { "V",                                  722 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            778 },
+  { "g",                                  500 },
+  { "p",                                  556 },
+  { "Rcaron",                             722 },
+  { "quoteright",                         333 },
+  { "O",                                  778 },
+  { "lcommaaccent",                       278 },
+  { "exclam",                             333 },
+  { "idieresis",                          278 },
+  { "zacute",                             444 },
+  { "gbreve",                             500 },
+  { "underscore",                         500 },
+  { "Sacute",                             556 },
+  { "aogonek",                            500 },
+  { "section",                            500 },
+  { "Cacute",                             722 },
+  { "florin",                             500 },
+  { "odieresis",                          500 },
+  { "gcommaaccent",                       500 },
+  { "nacute",                             556 },
+  { "Lslash",                             667 },
+  { "quoteleft",                          333 },
+  { "W",                                 1000 },
+  { "plus",                               570 },
+  { "ampersand",                          833 },
+  { "ntilde",                             556 },
+  { "sterling",                           500 },
+  { "minus",                              570 },
+  { "imacron",                            278 },
+  { "ograve",                             500 },
+  { "AE",                                1000 },
+  { "space",                              250 },
+  { "atilde",                             500 },
+  { "udieresis",                          556 },
+  { "parenright",                         333 },
+  { "semicolon",                          333 },
+  { "trademark",                         1000 },
+  { "adieresis",                          500 },
+  { "oacute",                             500 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                500 },
+  { "Scedilla",                           556 },
+  { "Zdotaccent",                         667 },
+  { "dcaron",                             672 },
+  { "mu",                                 556 },
+  { "a",                                  500 },
+  { "v",                                  500 },
+  { "at",                                 930 },
+  { "eogonek",                            444 },
+  { "j",                                  333 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             778 },
+  { "partialdiff",                        494 },
+  { "thorn",                              556 },
+  { "otilde",                             500 },
+  { "m",                                  833 },
+  { "dcroat",                             556 },
+  { "i",                                  278 },
+  { "asterisk",                           500 },
+  { "Idieresis",                          389 },
+  { "G",                                  778 },
+  { "Oacute",                             778 },
+  { "H",                                  778 },
+  { "scaron",                             389 },
+  { "quotesinglbase",                     333 },
+  { "Iacute",                             389 },
+  { "ugrave",                             556 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       500 },
+  { "amacron",                            500 },
+  { "Ydieresis",                          722 },
+  { "less",                               570 },
+  { "Thorn",                              611 },
+  { "logicalnot",                         570 },
+  { "twosuperior",                        300 },
+  { "uring",                              556 },
+  { "guilsinglright",                     333 },
+  { "r",                                  444 },
+  { "bracketright",                       333 },
+  { "Yacute",                             722 },
+  { "Scaron",                             556 },
+  { "hyphen",                             333 },
+  { "t",                                  333 },
+  { "u",                                  556 },
+  { "B",                                  667 },
+  { "periodcentered",                     250 },
+  { "eth",                                500 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  944 },
+  { "guillemotleft",                      500 },
+  { "ocircumflex",                        500 },
+  { "ccaron",                             444 },
+  { "quotedblleft",                       500 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  500 },
+  { "onesuperior",                        300 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           500 },
+  { "dollar",                             500 },
+  { "daggerdbl",                          500 },
+  { "Lcaron",                             667 },
+  { "omacron",                            500 },
+  { "Eacute",                             667 },
+  { "D",                                  722 },
+  { "sacute",                             389 },
+  { "ohungarumlaut",                      500 },
+  { "cacute",                             444 },
+  { "rcaron",                             444 },
+  { "zdotaccent",                         444 },
+  { "threesuperior",                      300 },
+  { "zero",                               500 },
+  { "guillemotright",                     500 },
+  { "asciicircum",                        581 },
+  { "backslash",                          278 },
+  { "lslash",                             278 },
+  { "onequarter",                         750 },
+  { "fraction",                           167 },
+  { "threequarters",                      750 },
+  { "quotedblright",                      500 },
+  { "period",                             250 },
+  { "ucircumflex",                        556 },
+  { "tcaron",                             416 },
+  { "Igrave",                             389 },
+  { "Rcommaaccent",                       722 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  667 },
+  { "uhungarumlaut",                      556 },
+  { "numbersign",                         500 },
+  { "Y",                                  722 },
+  { "Tcaron",                             667 },
+  { "Gbreve",                             778 },
+  { "Eogonek",                            667 },
+  { "w",                                  722 },
+  { "ydieresis",                          500 },
+  { "aring",                              500 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             667 },
+  { "seven",                              500 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        278 },
+  { "four",                               500 },
+  { "Ocircumflex",                        778 },
+  { "oe",                                 722 },
+  { "brokenbar",                          220 },
+  { "l",                                  278 },
+  { "breve",                              333 },
+  { "comma",                              250 },
+  { "f",                                  333 },
+  { "aacute",                             500 },
+  { "radical",                            549 },
+  { "d",                                  556 },
+  { "ecaron",                             444 },
+  { "S",                                  556 },
+  { "rcommaaccent",                       444 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       333 },
+  { "edieresis",                          444 },
+  { "equal",                              570 },
+  { "y",                                  500 },
+  { "ogonek",                             333 },
+  { "yacute",                             500 },
+  { "agrave",                             500 },
+  { "Tcommaaccent",                       667 },
+  { "six",                                500 },
+  { "Ccedilla",                           722 },
+  { "ordfeminine",                        300 },
+  { "exclamdown",                         333 },
+  { "Ohungarumlaut",                      778 },
+  { "nine",                               500 },
+  { "zcaron",                             444 },
+  { "Odieresis",                          778 },
+  { "Gcommaaccent",                       778 },
+  { "Iogonek",                            389 },
+  { "N",                                  722 },
+  { "Aogonek",                            722 },
+  { "Adieresis",                          722 },
+  { "braceleft",                          394 },
+  { "Abreve",                             722 },
+  { "uogonek",                            556 },
+  { "dagger",                             500 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         444 },
+  { "bullet",                             350 },
+  { "Imacron",                            389 },
+  { "egrave",                             444 },
+  { "paragraph",                          540 },
+  { "Otilde",                             778 },
+  { "Kcommaaccent",                       778 },
+  { "eacute",                             444 },
+  { "OE",                                1000 },
+  { "Acircumflex",                        722 },
+  { "two",                                500 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             667 },
+  { "ncaron",                             556 },
+  { "h",                                  556 },
+  { "q",                                  556 },
+  { "circumflex",                         333 },
+  { "E",                                  667 },
+  { "Ccaron",                             722 },
+  { "fl",                                 556 },
+  { "F",                                  611 },
+  { "Ecircumflex",                        667 },
+  { "Zcaron",                             667 },
+  { "abreve",                             500 }
+};
+
+static const Gushort timesBoldWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth timesBoldItalicWidthsTab[] = {
+  { "J",                                  500 },
+  { "scedilla",                           389 },
+  { "Euro",                               500 },
+  { "plusminus",                          570 },
+  { "grave",                              333 },
+  { "b",                                  500 },
+  { "iogonek",                            278 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                220 },
+  { "multiply",                           570 },
+  { "ccedilla",                           444 },
+  { "ecircumflex",                        444 },
+  { "n",                                  556 },
+  { "Atilde",                             667 },
+  { "tilde",                              333 },
+  { "Ecaron",                             667 },
+  { "Edotaccent",                         667 },
+  { "uacute",                             556 },
+  { "e",                                  444 },
+  { "registered",                         747 },
+  { "Icircumflex",                        389 },
+  { "fi",                                 556 },
+  { "Uacute",                             722 },
+  { "braceright",                         348 },
+  { "asciitilde",                         570 },
+  { "percent",                            833 },
+  { "Lcommaaccent",                       611 },
+  { "oslash",                             500 },
+  { "Dcroat",                             722 },
+  { "I",                                  389 },
+  { "z",                                  389 },
+  { "kcommaaccent",                       500 },
+  { "Racute",                             667 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  667 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             570 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         389 },
+  { "quotedbl",                           555 },
+  { "Scommaaccent",                       556 },
+  { "A",                                  667 },
+  { "scommaaccent",                       389 },
+  { "Amacron",                            667 },
+  { "C",                                  667 },
+  { "bracketleft",                        333 },
+  { "three",                              500 },
+  { "emacron",                            444 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        500 },
+  { "lcaron",                             382 },
+  { "copyright",                          747 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               500 },
+  { "Z",                                  611 },
+  { "quotedblbase",                       500 },
+  { "ncommaaccent",                       556 },
+  { "racute",                             389 },
+  { "k",                                  500 },
+  { "o",                                  500 },
+  { "ordmasculine",                       300 },
+  { "cedilla",                            333 },
+  { "greater",                            570 },
+  { "Aacute",                             667 },
+  { "Eth",                                722 },
+  { "colon",                              333 },
+  { "c",                                  444 },
+  { "lozenge",                            494 },
+  { "Agrave",                             667 },
+  { "Emacron",                            667 },
+  { "Zacute",                             611 },
+  { "macron",                             333 },
+  { "germandbls",                         500 },
+  { "s",                                  389 },
+  { "eight",                              500 },
+  { "P",                                  611 },
+  { "Q",                                  722 },
+  { "R",                                  667 },
+  { "ae",                                 722 },
+  { "one",                                500 },
+  { "U",                                  722 },
+  { "Edieresis",                          667 },
+  { "currency",                           500 },
+  { "K",                                  667 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            750 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             722 },
+  { "Dcaron",                             722 },
+  { "Aring",                              667 },
+  { "five",                               500 },
+  { "T",                                  611 },
+  { "endash",                             500 },
+  { "lacute",                             278 },
+  { "umacron",                            556 },
+  { "V",                                  667 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            722 },
+  { "g",                                  500 },
+  { "p",                                  500 },
+  { "Rcaron",                             667 },
+  { "quoteright",                         333 },
+  { "O",                                  722 },
+  { "lcommaaccent",                       278 },
+  { "exclam",                             389 },
+  { "idieresis",                          278 },
+  { "zacute",                             389 },
+  { "gbreve",                             500 },
+  { "underscore",                         500 },
+  { "Sacute",                             556 },
+  { "aogonek",                            500 },
+  { "section",                            500 },
+  { "Cacute",                             667 },
+  { "florin",                             500 },
+  { "odieresis",                          500 },
+  { "gcommaaccent",                       500 },
+  { "nacute",                             556 },
+  { "Lslash",                             611 },
+  { "quoteleft",                          333 },
+  { "W",                                  889 },
+  { "plus",                               570 },
+  { "ampersand",                          778 },
+  { "ntilde",                             556 },
+  { "sterling",                           500 },
+  { "minus",                              606 },
+  { "imacron",                            278 },
+  { "ograve",                             500 },
+  { "AE",                                 944 },
+  { "space",                              250 },
+  { "atilde",                             500 },
+  { "udieresis",                          556 },
+  { "parenright",                         333 },
+  { "semicolon",                          333 },
+  { "trademark",                         1000 },
+  { "adieresis",                          500 },
+  { "oacute",                             500 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                500 },
+  { "Scedilla",                           556 },
+  { "Zdotaccent",                         611 },
+  { "dcaron",                             608 },
+  { "mu",                                 576 },
+  { "a",                                  500 },
+  { "v",                                  444 },
+  { "at",                                 832 },
+  { "eogonek",                            444 },
+  { "j",                                  278 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             722 },
+  { "partialdiff",                        494 },
+  { "thorn",                              500 },
+  { "otilde",                             500 },
+  { "m",                                  778 },
+  { "dcroat",                             500 },
+  { "i",                                  278 },
+  { "asterisk",                           500 },
+  { "Idieresis",                          389 },
+  { "G",                                  722 },
+  { "Oacute",                             722 },
+  { "H",                                  778 },
+  { "scaron",                             389 },
+  { "quotesinglbase",                     333 },
+  { "Iacute",                             389 },
+  { "ugrave",                             556 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       500 },
+  { "amacron",                            500 },
+  { "Ydieresis",                          611 },
+  { "less",                               570 },
+  { "Thorn",                              611 },
+  { "logicalnot",                         606 },
+  { "twosuperior",                        300 },
+  { "uring",                              556 },
+  { "guilsinglright",                     333 },
+  { "r",                                  389 },
+  { "bracketright",                       333 },
+  { "Yacute",                             611 },
+  { "Scaron",                             556 },
+  { "hyphen",                             333 },
+  { "t",                                  278 },
+  { "u",                                  556 },
+  { "B",                                  667 },
+  { "periodcentered",                     250 },
+  { "eth",                                500 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  889 },
+  { "guillemotleft",                      500 },
+  { "ocircumflex",                        500 },
+  { "ccaron",                             444 },
+  { "quotedblleft",                       500 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  500 },
+  { "onesuperior",                        300 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           500 },
+  { "dollar",                             500 },
+  { "daggerdbl",                          500 },
+  { "Lcaron",                             611 },
+  { "omacron",                            500 },
+  { "Eacute",                             667 },
+  { "D",                                  722 },
+  { "sacute",                             389 },
+  { "ohungarumlaut",                      500 },
+  { "cacute",                             444 },
+  { "rcaron",                             389 },
+  { "zdotaccent",                         389 },
+  { "threesuperior",                      300 },
+  { "zero",                               500 },
+  { "guillemotright",                     500 },
+  { "asciicircum",                        570 },
+  { "backslash",                          278 },
+  { "lslash",                             278 },
+  { "onequarter",                         750 },
+  { "fraction",                           167 },
+  { "threequarters",                      750 },
+  { "quotedblright",                      500 },
+  { "period",                             250 },
+  { "ucircumflex",                        556 },
+  { "tcaron",                             366 },
+  { "Igrave",                             389 },
+  { "Rcommaaccent",                       667 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  611 },
+  { "uhungarumlaut",                      556 },
+  { "numbersign",                         500 },
+  { "Y",                                  611 },
+  { "Tcaron",                             611 },
+  { "Gbreve",                             722 },
+  { "Eogonek",                            667 },
+  { "w",                                  667 },
+  { "ydieresis",                          444 },
+  { "aring",                              500 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             611 },
+  { "seven",                              500 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        278 },
+  { "four",                               500 },
+  { "Ocircumflex",                        722 },
+  { "oe",                                 722 },
+  { "brokenbar",                          220 },
+  { "l",                                  278 },
+  { "breve",                              333 },
+  { "comma",                              250 },
+  { "f",                                  333 },
+  { "aacute",                             500 },
+  { "radical",                            549 },
+  { "d",                                  500 },
+  { "ecaron",                             444 },
+  { "S",                                  556 },
+  { "rcommaaccent",                       389 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       278 },
+  { "edieresis",                          444 },
+  { "equal",                              570 },
+  { "y",                                  444 },
+  { "ogonek",                             333 },
+  { "yacute",                             444 },
+  { "agrave",                             500 },
+  { "Tcommaaccent",                       611 },
+  { "six",                                500 },
+  { "Ccedilla",                           667 },
+  { "ordfeminine",                        266 },
+  { "exclamdown",                         389 },
+  { "Ohungarumlaut",                      722 },
+  { "nine",                               500 },
+  { "zcaron",                             389 },
+  { "Odieresis",                          722 },
+  { "Gcommaaccent",                       722 },
+  { "Iogonek",                            389 },
+  { "N",                                  722 },
+  { "Aogonek",                            667 },
+  { "Adieresis",                          667 },
+  { "braceleft",                          348 },
+  { "Abreve",                             667 },
+  { "uogonek",                            556 },
+  { "dagger",                             500 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         444 },
+  { "bullet",                             350 },
+  { "Imacron",                            389 },
+  { "egrave",                             444 },
+  { "paragraph",                          500 },
+  { "Otilde",                             722 },
+  { "Kcommaaccent",                       667 },
+  { "eacute",                             444 },
+  { "OE",                                 944 },
+  { "Acircumflex",                        667 },
+  { "two",                                500 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             667 },
+  { "ncaron",                             556 },
+  { "h",                                  556 },
+  { "q",                                  500 },
+  { "circumflex",                         333 },
+  { "E",                                  667 },
+  { "Ccaron",                             667 },
+  { "fl",                                 556 },
+  { "F",                                  667 },
+  { "Ecircumflex",                        667 },
+  { "Zcaron",                             611 },
+  { "abreve",                             500 }
+};
+
+static const Gushort timesBoldItalicWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth timesItalicWidthsTab[] = {
+  { "J",                                  444 },
+  { "scedilla",                           389 },
+  { "Euro",                               500 },
+  { "plusminus",                          675 },
+  { "grave",                              333 },
+  { "b",                                  500 },
+  { "iogonek",                            278 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                275 },
+  { "multiply",                           675 },
+  { "ccedilla",                           444 },
+  { "ecircumflex",                        444 },
+  { "n",                                  500 },
+  { "Atilde",                             611 },
+  { "tilde",                              333 },
+  { "Ecaron",                             611 },
+  { "Edotaccent",                         611 },
+  { "uacute",                             500 },
+  { "e",                                  444 },
+  { "registered",                         760 },
+  { "Icircumflex",                        333 },
+  { "fi",                                 500 },
+  { "Uacute",                             722 },
+  { "braceright",                         400 },
+  { "asciitilde",                         541 },
+  { "percent",                            833 },
+  { "Lcommaaccent",                       556 },
+  { "oslash",                             500 },
+  { "Dcroat",                             722 },
+  { "I",                                  333 },
+  { "z",                                  389 },
+  { "kcommaaccent",                       444 },
+  { "Racute",                             611 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  611 },
+  { "Ntilde",                             667 },
+  { "dieresis",                           333 },
+  { "divide",                             675 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         333 },
+  { "quotedbl",                           420 },
+  { "Scommaaccent",                       500 },
+  { "A",                                  611 },
+  { "scommaaccent",                       389 },
+  { "Amacron",                            611 },
+  { "C",                                  667 },
+  { "bracketleft",                        389 },
+  { "three",                              500 },
+  { "emacron",                            444 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        500 },
+  { "lcaron",                             300 },
+  { "copyright",                          760 },
+  { "emdash",                             889 },
+  { "icircumflex",                        278 },
+  { "cent",                               500 },
+  { "Z",                                  556 },
+  { "quotedblbase",                       556 },
+  { "ncommaaccent",                       500 },
+  { "racute",                             389 },
+  { "k",                                  444 },
+  { "o",                                  500 },
+  { "ordmasculine",                       310 },
+  { "cedilla",                            333 },
+  { "greater",                            675 },
+  { "Aacute",                             611 },
+  { "Eth",                                722 },
+  { "colon",                              333 },
+  { "c",                                  444 },
+  { "lozenge",                            471 },
+  { "Agrave",                             611 },
+  { "Emacron",                            611 },
+  { "Zacute",                             556 },
+  { "macron",                             333 },
+  { "germandbls",                         500 },
+  { "s",                                  389 },
+  { "eight",                              500 },
+  { "P",                                  611 },
+  { "Q",                                  722 },
+  { "R",                                  611 },
+  { "ae",                                 667 },
+  { "one",                                500 },
+  { "U",                                  722 },
+  { "Edieresis",                          611 },
+  { "currency",                           500 },
+  { "K",                                  667 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            750 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             722 },
+  { "Dcaron",                             722 },
+  { "Aring",                              611 },
+  { "five",                               500 },
+  { "T",                                  556 },
+  { "endash",                             500 },
+  { "lacute",                             278 },
+  { "umacron",                            500 },
+  { "V",                                  611 },
+  { "Ncaron",                             667 },
+  { "Omacron",                            722 },
+  { "g",                                  500 },
+  { "p",                                  500 },
+  { "Rcaron",                             611 },
+  { "quoteright",                         333 },
+  { "O",                                  722 },
+  { "lcommaaccent",                       278 },
+  { "exclam",                             333 },
+  { "idieresis",                          278 },
+  { "zacute",                             389 },
+  { "gbreve",                             500 },
+  { "underscore",                         500 },
+  { "Sacute",                             500 },
+  { "aogonek",                            500 },
+  { "section",                            500 },
+  { "Cacute",                             667 },
+  { "florin",                             500 },
+  { "odieresis",                          500 },
+  { "gcommaaccent",                       500 },
+  { "nacute",                             500 },
+  { "Lslash",                             556 },
+  { "quoteleft",                          333 },
+  { "W",                                  833 },
+  { "plus",                               675 },
+  { "ampersand",                          778 },
+  { "ntilde",                             500 },
+  { "sterling",                           500 },
+  { "minus",                              675 },
+  { "imacron",                            278 },
+  { "ograve",                             500 },
+  { "AE",                                 889 },
+  { "space",                              250 },
+  { "atilde",                             500 },
+  { "udieresis",                          500 },
+  { "parenright",                         333 },
+  { "semicolon",                          333 },
+  { "trademark",                          980 },
+  { "adieresis",                          500 },
+  { "oacute",                             500 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                500 },
+  { "Scedilla",                           500 },
+  { "Zdotaccent",                         556 },
+  { "dcaron",                             544 },
+  { "mu",                                 500 },
+  { "a",                                  500 },
+  { "v",                                  444 },
+  { "at",                                 920 },
+  { "eogonek",                            444 },
+  { "j",                                  278 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             722 },
+  { "partialdiff",                        476 },
+  { "thorn",                              500 },
+  { "otilde",                             500 },
+  { "m",                                  722 },
+  { "dcroat",                             500 },
+  { "i",                                  278 },
+  { "asterisk",                           500 },
+  { "Idieresis",                          333 },
+  { "G",                                  722 },
+  { "Oacute",                             722 },
+  { "H",                                  722 },
+  { "scaron",                             389 },
+  { "quotesinglbase",                     333 },
+  { "Iacute",                             333 },
+  { "ugrave",                             500 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       500 },
+  { "amacron",                            500 },
+  { "Ydieresis",                          556 },
+  { "less",                               675 },
+  { "Thorn",                              611 },
+  { "logicalnot",                         675 },
+  { "twosuperior",                        300 },
+  { "uring",                              500 },
+  { "guilsinglright",                     333 },
+  { "r",                                  389 },
+  { "bracketright",                       389 },
+  { "Yacute",                             556 },
+  { "Scaron",                             500 },
+  { "hyphen",                             333 },
+  { "t",                                  278 },
+  { "u",                                  500 },
+  { "B",                                  611 },
+  { "periodcentered",                     250 },
+  { "eth",                                500 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  833 },
+  { "guillemotleft",                      500 },
+  { "ocircumflex",                        500 },
+  { "ccaron",                             444 },
+  { "quotedblleft",                       556 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       667 },
+  { "x",                                  444 },
+  { "onesuperior",                        300 },
+  { "Nacute",                             667 },
+  { "lessequal",                          549 },
+  { "question",                           500 },
+  { "dollar",                             500 },
+  { "daggerdbl",                          500 },
+  { "Lcaron",                             611 },
+  { "omacron",                            500 },
+  { "Eacute",                             611 },
+  { "D",                                  722 },
+  { "sacute",                             389 },
+  { "ohungarumlaut",                      500 },
+  { "cacute",                             444 },
+  { "rcaron",                             389 },
+  { "zdotaccent",                         389 },
+  { "threesuperior",                      300 },
+  { "zero",                               500 },
+  { "guillemotright",                     500 },
+  { "asciicircum",                        422 },
+  { "backslash",                          278 },
+  { "lslash",                             278 },
+  { "onequarter",                         750 },
+  { "fraction",                           167 },
+  { "threequarters",                      750 },
+  { "quotedblright",                      556 },
+  { "period",                             250 },
+  { "ucircumflex",                        500 },
+  { "tcaron",                             300 },
+  { "Igrave",                             333 },
+  { "Rcommaaccent",                       611 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  556 },
+  { "uhungarumlaut",                      500 },
+  { "numbersign",                         500 },
+  { "Y",                                  556 },
+  { "Tcaron",                             556 },
+  { "Gbreve",                             722 },
+  { "Eogonek",                            611 },
+  { "w",                                  667 },
+  { "ydieresis",                          444 },
+  { "aring",                              500 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             556 },
+  { "seven",                              500 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        214 },
+  { "four",                               500 },
+  { "Ocircumflex",                        722 },
+  { "oe",                                 667 },
+  { "brokenbar",                          275 },
+  { "l",                                  278 },
+  { "breve",                              333 },
+  { "comma",                              250 },
+  { "f",                                  278 },
+  { "aacute",                             500 },
+  { "radical",                            453 },
+  { "d",                                  500 },
+  { "ecaron",                             444 },
+  { "S",                                  500 },
+  { "rcommaaccent",                       389 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       278 },
+  { "edieresis",                          444 },
+  { "equal",                              675 },
+  { "y",                                  444 },
+  { "ogonek",                             333 },
+  { "yacute",                             444 },
+  { "agrave",                             500 },
+  { "Tcommaaccent",                       556 },
+  { "six",                                500 },
+  { "Ccedilla",                           667 },
+  { "ordfeminine",                        276 },
+  { "exclamdown",                         389 },
+  { "Ohungarumlaut",                      722 },
+  { "nine",                               500 },
+  { "zcaron",                             389 },
+  { "Odieresis",                          722 },
+  { "Gcommaaccent",                       722 },
+  { "Iogonek",                            333 },
+  { "N",                                  667 },
+  { "Aogonek",                            611 },
+  { "Adieresis",                          611 },
+  { "braceleft",                          400 },
+  { "Abreve",                             611 },
+  { "uogonek",                            500 },
+  { "dagger",                             500 },
+  { "ellipsis",                           889 },
+  { "iacute",                             278 },
+  { "edotaccent",                         444 },
+  { "bullet",                             350 },
+  { "Imacron",                            333 },
+  { "egrave",                             444 },
+  { "paragraph",                          523 },
+  { "Otilde",                             722 },
+  { "Kcommaaccent",                       667 },
+  { "eacute",                             444 },
+  { "OE",                                 944 },
+  { "Acircumflex",                        611 },
+  { "two",                                500 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             611 },
+  { "ncaron",                             500 },
+  { "h",                                  500 },
+  { "q",                                  500 },
+  { "circumflex",                         333 },
+  { "E",                                  611 },
+  { "Ccaron",                             667 },
+  { "fl",                                 500 },
+  { "F",                                  611 },
+  { "Ecircumflex",                        611 },
+  { "Zcaron",                             556 },
+  { "abreve",                             500 }
+};
+
+static const Gushort timesItalicWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth timesRomanWidthsTab[] = {
+  { "J",                                  389 },
+  { "scedilla",                           389 },
+  { "Euro",                               500 },
+  { "plusminus",                          564 },
+  { "grave",                              333 },
+  { "b",                                  500 },
+  { "iogonek",                            278 },
+  { "Uhungarumlaut",                      722 },
+  { "bar",                                200 },
+  { "multiply",                           564 },
+  { "ccedilla",                           444 },
+  { "ecircumflex",                        444 },
+  { "n",                                  500 },
+  { "Atilde",                             722 },
+  { "tilde",                              333 },
+  { "Ecaron",                             611 },
+  { "Edotaccent",                         611 },
+  { "uacute",                             500 },
+  { "e",                                  444 },
+  { "registered",                         760 },
+  { "Icircumflex",                        333 },
+  { "fi",                                 556 },
+  { "Uacute",                             722 },
+  { "braceright",                         480 },
+  { "asciitilde",                         541 },
+  { "percent",                            833 },
+  { "Lcommaaccent",                       611 },
+  { "oslash",                             500 },
+  { "Dcroat",                             722 },
+  { "I",                                  333 },
+  { "z",                                  444 },
+  { "kcommaaccent",                       500 },
+  { "Racute",                             667 },
+  { "summation",                          600 },
+  { "greaterequal",                       549 },
+  { "ring",                               333 },
+  { "X",                                  722 },
+  { "Ntilde",                             722 },
+  { "dieresis",                           333 },
+  { "divide",                             564 },
+  { "Uring",                              722 },
+  { "Idotaccent",                         333 },
+  { "quotedbl",                           408 },
+  { "Scommaaccent",                       556 },
+  { "A",                                  722 },
+  { "scommaaccent",                       389 },
+  { "Amacron",                            722 },
+  { "C",                                  667 },
+  { "bracketleft",                        333 },
+  { "three",                              500 },
+  { "emacron",                            444 },
+  { "notequal",                           549 },
+  { "caron",                              333 },
+  { "acircumflex",                        444 },
+  { "lcaron",                             344 },
+  { "copyright",                          760 },
+  { "emdash",                            1000 },
+  { "icircumflex",                        278 },
+  { "cent",                               500 },
+  { "Z",                                  611 },
+  { "quotedblbase",                       444 },
+  { "ncommaaccent",                       500 },
+  { "racute",                             333 },
+  { "k",                                  500 },
+  { "o",                                  500 },
+  { "ordmasculine",                       310 },
+  { "cedilla",                            333 },
+  { "greater",                            564 },
+  { "Aacute",                             722 },
+  { "Eth",                                722 },
+  { "colon",                              278 },
+  { "c",                                  444 },
+  { "lozenge",                            471 },
+  { "Agrave",                             722 },
+  { "Emacron",                            611 },
+  { "Zacute",                             611 },
+  { "macron",                             333 },
+  { "germandbls",                         500 },
+  { "s",                                  389 },
+  { "eight",                              500 },
+  { "P",                                  556 },
+  { "Q",                                  722 },
+  { "R",                                  667 },
+  { "ae",                                 667 },
+  { "one",                                500 },
+  { "U",                                  722 },
+  { "Edieresis",                          611 },
+  { "currency",                           500 },
+  { "K",                                  722 },
+  { "guilsinglleft",                      333 },
+  { "onehalf",                            750 },
+  { "hungarumlaut",                       333 },
+  { "Oslash",                             722 },
+  { "Dcaron",                             722 },
+  { "Aring",                              722 },
+  { "five",                               500 },
+  { "T",                                  611 },
+  { "endash",                             500 },
+  { "lacute",                             278 },
+  { "umacron",                            500 },
+  { "V",                                  722 },
+  { "Ncaron",                             722 },
+  { "Omacron",                            722 },
+  { "g",                                  500 },
+  { "p",                                  500 },
+  { "Rcaron",                             667 },
+  { "quoteright",                         333 },
+  { "O",                                  722 },
+  { "lcommaaccent",                       278 },
+  { "exclam",                             333 },
+  { "idieresis",                          278 },
+  { "zacute",                             444 },
+  { "gbreve",                             500 },
+  { "underscore",                         500 },
+  { "Sacute",                             556 },
+  { "aogonek",                            444 },
+  { "section",                            500 },
+  { "Cacute",                             667 },
+  { "florin",                             500 },
+  { "odieresis",                          500 },
+  { "gcommaaccent",                       500 },
+  { "nacute",                             500 },
+  { "Lslash",                             611 },
+  { "quoteleft",                          333 },
+  { "W",                                  944 },
+  { "plus",                               564 },
+  { "ampersand",                          778 },
+  { "ntilde",                             500 },
+  { "sterling",                           500 },
+  { "minus",                              564 },
+  { "imacron",                            278 },
+  { "ograve",                             500 },
+  { "AE",                                 889 },
+  { "space",                              250 },
+  { "atilde",                             444 },
+  { "udieresis",                          500 },
+  { "parenright",                         333 },
+  { "semicolon",                          278 },
+  { "trademark",                          980 },
+  { "adieresis",                          444 },
+  { "oacute",                             500 },
+  { "Ucircumflex",                        722 },
+  { "acute",                              333 },
+  { "yen",                                500 },
+  { "Scedilla",                           556 },
+  { "Zdotaccent",                         611 },
+  { "dcaron",                             588 },
+  { "mu",                                 500 },
+  { "a",                                  444 },
+  { "v",                                  500 },
+  { "at",                                 921 },
+  { "eogonek",                            444 },
+  { "j",                                  278 },
+  { "perthousand",                       1000 },
+  { "Ograve",                             722 },
+  { "partialdiff",                        476 },
+  { "thorn",                              500 },
+  { "otilde",                             500 },
+  { "m",                                  778 },
+  { "dcroat",                             500 },
+  { "i",                                  278 },
+  { "asterisk",                           500 },
+  { "Idieresis",                          333 },
+  { "G",                                  722 },
+  { "Oacute",                             722 },
+  { "H",                                  722 },
+  { "scaron",                             389 },
+  { "quotesinglbase",                     333 },
+  { "Iacute",                             333 },
+  { "ugrave",                             500 },
+  { "Ugrave",                             722 },
+  { "questiondown",                       444 },
+  { "amacron",                            444 },
+  { "Ydieresis",                          722 },
+  { "less",                               564 },
+  { "Thorn",                              556 },
+  { "logicalnot",                         564 },
+  { "twosuperior",                        300 },
+  { "uring",                              500 },
+  { "guilsinglright",                     333 },
+  { "r",                                  333 },
+  { "bracketright",                       333 },
+  { "Yacute",                             722 },
+  { "Scaron",                             556 },
+  { "hyphen",                             333 },
+  { "t",                                  278 },
+  { "u",                                  500 },
+  { "B",                                  667 },
+  { "periodcentered",                     250 },
+  { "eth",                                500 },
+  { "Delta",                              612 },
+  { "parenleft",                          333 },
+  { "M",                                  889 },
+  { "guillemotleft",                      500 },
+  { "ocircumflex",                        500 },
+  { "ccaron",                             444 },
+  { "quotedblleft",                       444 },
+  { "Umacron",                            722 },
+  { "Ncommaaccent",                       722 },
+  { "x",                                  500 },
+  { "onesuperior",                        300 },
+  { "Nacute",                             722 },
+  { "lessequal",                          549 },
+  { "question",                           444 },
+  { "dollar",                             500 },
+  { "daggerdbl",                          500 },
+  { "Lcaron",                             611 },
+  { "omacron",                            500 },
+  { "Eacute",                             611 },
+  { "D",                                  722 },
+  { "sacute",                             389 },
+  { "ohungarumlaut",                      500 },
+  { "cacute",                             444 },
+  { "rcaron",                             333 },
+  { "zdotaccent",                         444 },
+  { "threesuperior",                      300 },
+  { "zero",                               500 },
+  { "guillemotright",                     500 },
+  { "asciicircum",                        469 },
+  { "backslash",                          278 },
+  { "lslash",                             278 },
+  { "onequarter",                         750 },
+  { "fraction",                           167 },
+  { "threequarters",                      750 },
+  { "quotedblright",                      444 },
+  { "period",                             250 },
+  { "ucircumflex",                        500 },
+  { "tcaron",                             326 },
+  { "Igrave",                             333 },
+  { "Rcommaaccent",                       667 },
+  { "dotlessi",                           278 },
+  { "dotaccent",                          333 },
+  { "igrave",                             278 },
+  { "L",                                  611 },
+  { "uhungarumlaut",                      500 },
+  { "numbersign",                         500 },
+  { "Y",                                  722 },
+  { "Tcaron",                             611 },
+  { "Gbreve",                             722 },
+  { "Eogonek",                            611 },
+  { "w",                                  722 },
+  { "ydieresis",                          500 },
+  { "aring",                              444 },
+  { "commaaccent",                        250 },
+  { "Lacute",                             611 },
+  { "seven",                              500 },
+  { "degree",                             400 },
+  { "Udieresis",                          722 },
+  { "quotesingle",                        180 },
+  { "four",                               500 },
+  { "Ocircumflex",                        722 },
+  { "oe",                                 722 },
+  { "brokenbar",                          200 },
+  { "l",                                  278 },
+  { "breve",                              333 },
+  { "comma",                              250 },
+  { "f",                                  333 },
+  { "aacute",                             444 },
+  { "radical",                            453 },
+  { "d",                                  500 },
+  { "ecaron",                             444 },
+  { "S",                                  556 },
+  { "rcommaaccent",                       333 },
+  { "slash",                              278 },
+  { "tcommaaccent",                       278 },
+  { "edieresis",                          444 },
+  { "equal",                              564 },
+  { "y",                                  500 },
+  { "ogonek",                             333 },
+  { "yacute",                             500 },
+  { "agrave",                             444 },
+  { "Tcommaaccent",                       611 },
+  { "six",                                500 },
+  { "Ccedilla",                           667 },
+  { "ordfeminine",                        276 },
+  { "exclamdown",                         333 },
+  { "Ohungarumlaut",                      722 },
+  { "nine",                               500 },
+  { "zcaron",                             444 },
+  { "Odieresis",                          722 },
+  { "Gcommaaccent",                       722 },
+  { "Iogonek",                            333 },
+  { "N",                                  722 },
+  { "Aogonek",                            722 },
+  { "Adieresis",                          722 },
+  { "braceleft",                          480 },
+  { "Abreve",                             722 },
+  { "uogonek",                            500 },
+  { "dagger",                             500 },
+  { "ellipsis",                          1000 },
+  { "iacute",                             278 },
+  { "edotaccent",                         444 },
+  { "bullet",                             350 },
+  { "Imacron",                            333 },
+  { "egrave",                             444 },
+  { "paragraph",                          453 },
+  { "Otilde",                             722 },
+  { "Kcommaaccent",                       722 },
+  { "eacute",                             444 },
+  { "OE",                                 889 },
+  { "Acircumflex",                        722 },
+  { "two",                                500 },
+  { "Uogonek",                            722 },
+  { "Egrave",                             611 },
+  { "ncaron",                             500 },
+  { "h",                                  500 },
+  { "q",                                  500 },
+  { "circumflex",                         333 },
+  { "E",                                  611 },
+  { "Ccaron",                             667 },
+  { "fl",                                 556 },
+  { "F",                                  556 },
+  { "Ecircumflex",                        611 },
+  { "Zcaron",                             611 },
+  { "abreve",                             444 }
+};
+
+static const Gushort timesRomanWidthsDisp[] = {
+  0, 15, 10, 106, 22, 0, 23, 5, 258, 98, 86, 118,
+  78, 276, 128, 1, 187, 13, 329, 149, 7, 0, 138, 2,
+  9, 3, 2, 2, 16, 0, 7, 3, 4, 3, 37, 159,
+  319, 28, 1, 176, 13, 33, 207, 3, 67, 97, 35, 1,
+  212, 238, 338, 160, 163, 357, 0, 2, 15, 17, 190, 2,
+  18, 0, 859, 136, 0, 2, 0, 597, 55, 369, 15, 479,
+  188, 79, 81, 315, 6, 2195, 0
+};
+
+static const BuiltinFontWidth zapfDingbatsWidthsTab[] = {
+  { "a3",                                 980 },
+  { "a47",                                790 },
+  { "a92",                                276 },
+  { "space",                              278 },
+  { "a98",                                392 },
+  { "a58",                                826 },
+  { "a67",                                787 },
+  { "a136",                               788 },
+  { "a32",                                790 },
+  { "a141",                               788 },
+  { "a23",                                571 },
+  { "a16",                                933 },
+  { "a201",                               874 },
+  { "a109",                               626 },
+  { "a166",                               918 },
+  { "a83",                                277 },
+  { "a28",                                754 },
+  { "a147",                               788 },
+  { "a202",                               974 },
+  { "a142",                               788 },
+  { "a1",                                 974 },
+  { "a158",                               788 },
+  { "a182",                               874 },
+  { "a74",                                762 },
+  { "a10",                                692 },
+  { "a14",                                855 },
+  { "a137",                               788 },
+  { "a19",                                755 },
+  { "a68",                                713 },
+  { "a4",                                 719 },
+  { "a70",                                785 },
+  { "a71",                                791 },
+  { "a72",                                873 },
+  { "a73",                                761 },
+  { "a129",                               788 },
+  { "a188",                               873 },
+  { "a59",                                815 },
+  { "a37",                                789 },
+  { "a77",                                892 },
+  { "a192",                               748 },
+  { "a89",                                390 },
+  { "a99",                                668 },
+  { "a60",                                789 },
+  { "a176",                               931 },
+  { "a160",                               894 },
+  { "a161",                               838 },
+  { "a162",                               924 },
+  { "a101",                               732 },
+  { "a204",                               759 },
+  { "a9",                                 577 },
+  { "a144",                               788 },
+  { "a167",                               927 },
+  { "a44",                                744 },
+  { "a17",                                945 },
+  { "a181",                               696 },
+  { "a56",                                682 },
+  { "a22",                                761 },
+  { "a5",                                 789 },
+  { "a53",                                759 },
+  { "a156",                               788 },
+  { "a150",                               788 },
+  { "a163",                              1016 },
+  { "a189",                               927 },
+  { "a118",                               791 },
+  { "a104",                               910 },
+  { "a119",                               790 },
+  { "a185",                               865 },
+  { "a149",                               788 },
+  { "a112",                               776 },
+  { "a107",                               760 },
+  { "a168",                               928 },
+  { "a197",                               771 },
+  { "a11",                                960 },
+  { "a153",                               788 },
+  { "a154",                               788 },
+  { "a190",                               970 },
+  { "a21",                                762 },
+  { "a172",                               828 },
+  { "a173",                               924 },
+  { "a174",                               917 },
+  { "a175",                               930 },
+  { "a24",                                677 },
+  { "a25",                                763 },
+  { "a26",                                760 },
+  { "a27",                                759 },
+  { "a64",                                696 },
+  { "a184",                               946 },
+  { "a191",                               918 },
+  { "a88",                                234 },
+  { "a170",                               834 },
+  { "a66",                                786 },
+  { "a140",                               788 },
+  { "a111",                               595 },
+  { "a198",                               888 },
+  { "a128",                               788 },
+  { "a93",                                317 },
+  { "a94",                                317 },
+  { "a95",                                334 },
+  { "a96",                                334 },
+  { "a193",                               836 },
+  { "a122",                               788 },
+  { "a69",                                791 },
+  { "a102",                               544 },
+  { "a151",                               788 },
+  { "a157",                               788 },
+  { "a29",                                786 },
+  { "a180",                               867 },
+  { "a179",                               836 },
+  { "a30",                                788 },
+  { "a31",                                788 },
+  { "a65",                                689 },
+  { "a33",                                793 },
+  { "a127",                               788 },
+  { "a86",                                410 },
+  { "a36",                                823 },
+  { "a79",                                784 },
+  { "a187",                               831 },
+  { "a54",                                707 },
+  { "a195",                               888 },
+  { "a18",                                974 },
+  { "a203",                               762 },
+  { "a121",                               788 },
+  { "a139",                               788 },
+  { "a110",                               694 },
+  { "a34",                                794 },
+  { "a200",                               696 },
+  { "a124",                               788 },
+  { "a183",                               760 },
+  { "a206",                               410 },
+  { "a117",                               690 },
+  { "a61",                                789 },
+  { "a123",                               788 },
+  { "a169",                               928 },
+  { "a152",                               788 },
+  { "a143",                               788 },
+  { "a39",                                823 },
+  { "a57",                                701 },
+  { "a40",                                833 },
+  { "a106",                               667 },
+  { "a38",                                841 },
+  { "a125",                               788 },
+  { "a194",                               771 },
+  { "a55",                                708 },
+  { "a120",                               788 },
+  { "a6",                                 494 },
+  { "a41",                                816 },
+  { "a199",                               867 },
+  { "a48",                                792 },
+  { "a49",                                695 },
+  { "a87",                                234 },
+  { "a15",                                911 },
+  { "a20",                                846 },
+  { "a178",                               883 },
+  { "a205",                               509 },
+  { "a131",                               788 },
+  { "a132",                               788 },
+  { "a133",                               788 },
+  { "a90",                                390 },
+  { "a43",                                923 },
+  { "a62",                                707 },
+  { "a146",                               788 },
+  { "a130",                               788 },
+  { "a134",                               788 },
+  { "a45",                                723 },
+  { "a91",                                276 },
+  { "a35",                                816 },
+  { "a171",                               873 },
+  { "a75",                                759 },
+  { "a85",                                509 },
+  { "a186",                               967 },
+  { "a50",                                776 },
+  { "a135",                               788 },
+  { "a138",                               788 },
+  { "a126",                               788 },
+  { "a81",                                438 },
+  { "a100",                               668 },
+  { "a8",                                 537 },
+  { "a7",                                 552 },
+  { "a2",                                 961 },
+  { "a63",                                687 },
+  { "a105",                               911 },
+  { "a159",                               788 },
+  { "a82",                                138 },
+  { "a51",                                768 },
+  { "a108",                               760 },
+  { "a46",                                749 },
+  { "a103",                               544 },
+  { "a97",                                392 },
+  { "a84",                                415 },
+  { "a145",                               788 },
+  { "a196",                               748 },
+  { "a164",                               458 },
+  { "a148",                               788 },
+  { "a155",                               788 },
+  { "a52",                                792 },
+  { "a76",                                892 },
+  { "a13",                                549 },
+  { "a78",                                788 },
+  { "a165",                               924 },
+  { "a177",                               463 },
+  { "a12",                                939 },
+  { "a42",                                831 }
+};
+
+static const Gushort zapfDingbatsWidthsDisp[] = {
+  0, 97, 117, 3, 51, 11, 8, 104, 61, 117, 80, 63,
+  95, 32, 205, 59, 14, 0, 21, 19, 161, 0, 6, 239,
+  61385, 0, 158, 0, 418, 0, 2, 84, 732, 6, 0, 382,
+  1683, 18, 17, 465, 210, 86, 75, 99, 121, 1045, 9, 27,
+  584, 143, 2
+};
+
+static BuiltinFontWidths courierWidths = {
+  courierWidthsTab, 315, courierWidthsDisp, 79
+};
+
+static BuiltinFontWidths courierBoldWidths = {
+  courierBoldWidthsTab, 315, courierBoldWidthsDisp, 79
+};
+
+static BuiltinFontWidths courierBoldObliqueWidths = {
+  courierBoldObliqueWidthsTab, 315, courierBoldObliqueWidthsDisp, 79
+};
+
+static BuiltinFontWidths courierObliqueWidths = {
+  courierObliqueWidthsTab, 315, courierObliqueWidthsDisp, 79
+};
+
+static BuiltinFontWidths helveticaWidths = {
+  helveticaWidthsTab, 315, helveticaWidthsDisp, 79
+};
+
+static BuiltinFontWidths helveticaBoldWidths = {
+  helveticaBoldWidthsTab, 316, helveticaBoldWidthsDisp, 79
+};
+
+static BuiltinFontWidths helveticaBoldObliqueWidths = {
+  helveticaBoldObliqueWidthsTab, 315, helveticaBoldObliqueWidthsDisp, 79
+};
+
+static BuiltinFontWidths helveticaObliqueWidths = {
+  helveticaObliqueWidthsTab, 315, helveticaObliqueWidthsDisp, 79
+};
+
+static BuiltinFontWidths symbolWidths = {
+  symbolWidthsTab, 190, symbolWidthsDisp, 48
+};
+
+static BuiltinFontWidths timesBoldWidths = {
+  timesBoldWidthsTab, 315, timesBoldWidthsDisp, 79
+};
+
+static BuiltinFontWidths timesBoldItalicWidths = {
+  timesBoldItalicWidthsTab, 315, timesBoldItalicWidthsDisp, 79
+};
+
+static BuiltinFontWidths timesItalicWidths = {
+  timesItalicWidthsTab, 315, timesItalicWidthsDisp, 79
+};
+
+static BuiltinFontWidths timesRomanWidths = {
+  timesRomanWidthsTab, 315, timesRomanWidthsDisp, 79
+};
+
+static BuiltinFontWidths zapfDingbatsWidths = {
+  zapfDingbatsWidthsTab, 202, zapfDingbatsWidthsDisp, 51
 };
 
 BuiltinFont builtinFonts[] = {
-  { "Courier",               standardEncoding,            629, -157, { -23, -250,  715,  805}, NULL },
-  { "Courier-Bold",          standardEncoding,            629, -157, {-113, -250,  749,  801}, NULL },
-  { "Courier-BoldOblique",   standardEncoding,            629, -157, { -57, -250,  869,  801}, NULL },
-  { "Courier-Oblique",       standardEncoding,            629, -157, { -27, -250,  849,  805}, NULL },
-  { "Helvetica",             standardEncoding,            718, -207, {-166, -225, 1000,  931}, NULL },
-  { "Helvetica-Bold",        standardEncoding,            718, -207, {-170, -228, 1003,  962}, NULL },
-  { "Helvetica-BoldOblique", standardEncoding,            718, -207, {-174, -228, 1114,  962}, NULL },
-  { "Helvetica-Oblique",     standardEncoding,            718, -207, {-170, -225, 1116,  931}, NULL },
-  { "Symbol",                symbolEncoding,             1010, -293, {-180, -293, 1090, 1010}, NULL },
-  { "Times-Bold",            standardEncoding,            683, -217, {-168, -218, 1000,  935}, NULL },
-  { "Times-BoldItalic",      standardEncoding,            683, -217, {-200, -218,  996,  921}, NULL },
-  { "Times-Italic",          standardEncoding,            683, -217, {-169, -217, 1010,  883}, NULL },
-  { "Times-Roman",           standardEncoding,            683, -217, {-168, -218, 1000,  898}, NULL },
-  { "ZapfDingbats",          zapfDingbatsEncoding,        820, -143, {  -1, -143,  981,  820}, NULL }
+  { "Courier",               standardEncoding,            629, -157, { -23, -250,  715,  805}, &courierWidths },
+  { "Courier-Bold",          standardEncoding,            629, -157, {-113, -250,  749,  801}, &courierBoldWidths },
+  { "Courier-BoldOblique",   standardEncoding,            629, -157, { -57, -250,  869,  801}, &courierBoldObliqueWidths },
+  { "Courier-Oblique",       standardEncoding,            629, -157, { -27, -250,  849,  805}, &courierObliqueWidths },
+  { "Helvetica",             standardEncoding,            718, -207, {-166, -225, 1000,  931}, &helveticaWidths },
+  { "Helvetica-Bold",        standardEncoding,            718, -207, {-170, -228, 1003,  962}, &helveticaBoldWidths },
+  { "Helvetica-BoldOblique", standardEncoding,            718, -207, {-174, -228, 1114,  962}, &helveticaBoldObliqueWidths },
+  { "Helvetica-Oblique",     standardEncoding,            718, -207, {-170, -225, 1116,  931}, &helveticaObliqueWidths },
+  { "Symbol",                symbolEncoding,             1010, -293, {-180, -293, 1090, 1010}, &symbolWidths },
+  { "Times-Bold",            standardEncoding,            683, -217, {-168, -218, 1000,  935}, &timesBoldWidths },
+  { "Times-BoldItalic",      standardEncoding,            683, -217, {-200, -218,  996,  921}, &timesBoldItalicWidths },
+  { "Times-Italic",          standardEncoding,            683, -217, {-169, -217, 1010,  883}, &timesItalicWidths },
+  { "Times-Roman",           standardEncoding,            683, -217, {-168, -218, 1000,  898}, &timesRomanWidths },
+  { "ZapfDingbats",          zapfDingbatsEncoding,        820, -143, {  -1, -143,  981,  820}, &zapfDingbatsWidths }
 };
 
 BuiltinFont *builtinFontSubst[] = {
@@ -4256,28 +4447,3 @@ BuiltinFont *builtinFontSubst[] = {
   &builtinFonts[9],
   &builtinFonts[10]
 };
-
-void initBuiltinFontTables() {
-  builtinFonts[0].widths = new BuiltinFontWidths(courierWidthsTab, 315);
-  builtinFonts[1].widths = new BuiltinFontWidths(courierBoldWidthsTab, 315);
-  builtinFonts[2].widths = new BuiltinFontWidths(courierBoldObliqueWidthsTab, 315);
-  builtinFonts[3].widths = new BuiltinFontWidths(courierObliqueWidthsTab, 315);
-  builtinFonts[4].widths = new BuiltinFontWidths(helveticaWidthsTab, 315);
-  builtinFonts[5].widths = new BuiltinFontWidths(helveticaBoldWidthsTab, 316);
-  builtinFonts[6].widths = new BuiltinFontWidths(helveticaBoldObliqueWidthsTab, 315);
-  builtinFonts[7].widths = new BuiltinFontWidths(helveticaObliqueWidthsTab, 315);
-  builtinFonts[8].widths = new BuiltinFontWidths(symbolWidthsTab, 190);
-  builtinFonts[9].widths = new BuiltinFontWidths(timesBoldWidthsTab, 315);
-  builtinFonts[10].widths = new BuiltinFontWidths(timesBoldItalicWidthsTab, 315);
-  builtinFonts[11].widths = new BuiltinFontWidths(timesItalicWidthsTab, 315);
-  builtinFonts[12].widths = new BuiltinFontWidths(timesRomanWidthsTab, 315);
-  builtinFonts[13].widths = new BuiltinFontWidths(zapfDingbatsWidthsTab, 202);
-}
-
-void freeBuiltinFontTables() {
-  int i;
-
-  for (i = 0; i < 14; ++i) {
-    delete builtinFonts[i].widths;
-  }
-}
@@ -32,9 +32,11 @@
 #include "gmem.h"
 #include "gfile.h"
 #include "GooString.h"
+#include "GooList.h"
 #include "Error.h"
 #include "GlobalParams.h"
 #include "PSTokenizer.h"
+#include "CompiledData.h"
 #include "CMap.h"
 #include "Object.h"
 
@@ -62,34 +64,61 @@ static int getCharFromStream(void *data) {
 
 CMap *CMap::parse(CMapCache *cache, GooString *collectionA,
 		  GooString *cMapNameA, Stream *stream) {
-  FILE *f = NULL;
+  GMemScope memScope(gMemTagFonts);
+  GooString *srcFileName, *fileName;
+  FILE *f;
   CMap *cmap;
-  PSTokenizer *pst;
-  char tok1[256], tok2[256], tok3[256];
-  int n1, n2, n3;
-  Guint start, end, code;
 
   if (stream) {
     stream->reset();
-    pst = new PSTokenizer(&getCharFromStream, stream);
-  } else {
-    if (!(f = globalParams->findCMapFile(collectionA, cMapNameA))) {
+    return parse(cache, collectionA, cMapNameA, &getCharFromStream, stream);
+  }
 
-      // Check for an identity CMap.
-      if (!cMapNameA->cmp("Identity") || !cMapNameA->cmp("Identity-H")) {
-        return new CMap(collectionA->copy(), cMapNameA->copy(), 0);
-      }
-      if (!cMapNameA->cmp("Identity-V")) {
-        return new CMap(collectionA->copy(), cMapNameA->copy(), 1);
-      }
+  if (!(srcFileName = globalParams->findCMapFileName(collectionA,
+						      cMapNameA))) {
+
+    // Check for an identity CMap.
+    if (!cMapNameA->cmp("Identity") || !cMapNameA->cmp("Identity-H")) {
+      return new CMap(collectionA->copy(), cMapNameA->copy(), 0);
+    }
+    if (!cMapNameA->cmp("Identity-V")) {
+      return new CMap(collectionA->copy(), cMapNameA->copy(), 1);
+    }
 
-      error(-1, "Couldn't find '%s' CMap file for '%s' collection",
-	    cMapNameA->getCString(), collectionA->getCString());
-      return NULL;
+    error(-1, "Couldn't find '%s' CMap file for '%s' collection",
+	  cMapNameA->getCString(), collectionA->getCString());
+    return NULL;
+  }
+
+  // use the compiled CMap file if it is up to date
+  cmap = NULL;
+  if ((fileName = globalParams->getCompiledCMapFileName(collectionA,
+							 cMapNameA))) {
+    cmap = readCompiled(collectionA, cMapNameA, fileName, srcFileName);
+    delete fileName;
+  }
+  if (!cmap) {
+    if ((f = fopen(srcFileName->getCString(), "r"))) {
+      cmap = parse(cache, collectionA, cMapNameA, &getCharFromFile, f);
+      fclose(f);
+    } else {
+      error(-1, "Couldn't open CMap file '%s'", srcFileName->getCString());
     }
-    pst = new PSTokenizer(&getCharFromFile, f);
   }
+  delete srcFileName;
+  return cmap;
+}
+
+CMap *CMap::parse(CMapCache *cache, GooString *collectionA,
+		  GooString *cMapNameA,
+		  int (*getCharFunc)(void *), void *data) {
+  CMap *cmap;
+  PSTokenizer *pst;
+  char tok1[256], tok2[256], tok3[256];
+  int n1, n2, n3;
+  Guint start, end, code;
 
+  pst = new PSTokenizer(getCharFunc, data);
   cmap = new CMap(collectionA->copy(), cMapNameA->copy());
 
   pst->getToken(tok1, sizeof(tok1), &n1);
@@ -174,13 +203,257 @@ CMap *CMap::parse(CMapCache *cache, GooString *collectionA,
   }
   delete pst;
 
-  if (f) {
-    fclose(f);
+  return cmap;
+}
+
+GBool CMap::compile(CMapCache *cache, GooString *collectionA,
+		    GooString *cMapNameA, GooString *srcFileName,
+		    GooString *fileName) {
+  GMemScope memScope(gMemTagFonts);
+  FILE *f;
+  CMap *cmap;
+  GBool ok;
+
+  if (!(f = fopen(srcFileName->getCString(), "r"))) {
+    error(-1, "Couldn't open CMap file '%s'", srcFileName->getCString());
+    return gFalse;
+  }
+  cmap = parse(cache, collectionA, cMapNameA, &getCharFromFile, f);
+  fclose(f);
+  ok = cmap->writeCompiled(fileName, srcFileName);
+  cmap->decRefCnt();
+  return ok;
+}
+
+//------------------------------------------------------------------------
+// compiled CMaps
+//------------------------------------------------------------------------
+
+// A compiled CMap file holds a CompiledCMapHeader, a CompiledCMapUse
+// record for each CMap merged in through usecmap, and then <nTables>
+// tables of 256 Guints, which are the CMap's vectors with all used
+// CMaps merged in.  Each CompiledCMapUse is followed by the name of the
+// CMap, padded to 8 bytes; the used CMaps are looked up by name in the
+// CMap dirs and have to be unchanged, too, for the file to be current.
+// The tables are stored in depth-first order, so a table only refers
+// to tables after it.
+
+struct CompiledCMapHeader {
+  CompiledDataHeader hdr;
+  int wMode;
+  Guint nTables;
+  Guint nUsed;
+  Guint usedLen;		// bytes of CompiledCMapUse records and names
+};
+
+struct CompiledCMapUse {
+  double srcMTime;
+  Guint srcSize;
+  Guint nameLen;
+};
+
+#define compiledCMapUseLen(nameLen) \
+  (sizeof(CompiledCMapUse) + (((nameLen) + 7) & ~7))
+
+#define cMapSubTable 0x80000000
+
+static Guint countCMapTables(CMapVectorEntry *vec) {
+  Guint n;
+  int i;
+
+  n = 1;
+  for (i = 0; i < 256; ++i) {
+    if (vec[i].isVector) {
+      n += countCMapTables(vec[i].vector);
+    }
+  }
+  return n;
+}
+
+static GBool flattenCMapVector(CMapVectorEntry *vec, Guint *tables,
+			       Guint table, Guint *nTables) {
+  Guint sub;
+  int i;
+
+  for (i = 0; i < 256; ++i) {
+    if (vec[i].isVector) {
+      sub = (*nTables)++;
+      tables[table * 256 + i] = cMapSubTable | sub;
+      if (!flattenCMapVector(vec[i].vector, tables, sub, nTables)) {
+	return gFalse;
+      }
+    } else {
+      if (vec[i].cid & cMapSubTable) {
+	return gFalse;
+      }
+      tables[table * 256 + i] = vec[i].cid;
+    }
+  }
+  return gTrue;
+}
+
+// Get the size and modification time of the CMap file <name> from
+// <collection>.
+static GBool getUsedCMapStamp(GooString *collection, GooString *name,
+			      Guint *size, double *mTime) {
+  GooString *srcFileName;
+  GBool ok;
+
+  if (!(srcFileName = globalParams->findCMapFileName(collection, name))) {
+    return gFalse;
+  }
+  ok = getCompiledDataSourceStamp(srcFileName->getCString(), size, mTime);
+  delete srcFileName;
+  return ok;
+}
+
+GBool CMap::writeCompiled(GooString *fileName, GooString *srcFileName) {
+  CompiledCMapHeader *hdr;
+  CompiledCMapUse *use;
+  GooString *name;
+  char *p;
+  Guint n, usedLen;
+  size_t len;
+  GBool ok;
+  int i;
+
+  usedLen = 0;
+  for (i = 0; i < usedCMaps->getLength(); ++i) {
+    usedLen += compiledCMapUseLen(((GooString *)usedCMaps->get(i))
+				    ->getLength());
+  }
+  n = countCMapTables(vector);
+  len = sizeof(CompiledCMapHeader) + usedLen +
+        (size_t)n * 256 * sizeof(Guint);
+  hdr = (CompiledCMapHeader *)gmalloc(len);
+  memset(hdr, 0, len);
+  ok = initCompiledDataHeader(&hdr->hdr, compiledCMapMagic,
+			      srcFileName->getCString());
+  hdr->wMode = wMode;
+  hdr->nTables = n;
+  hdr->nUsed = usedCMaps->getLength();
+  hdr->usedLen = usedLen;
+  p = (char *)(hdr + 1);
+  for (i = 0; ok && i < usedCMaps->getLength(); ++i) {
+    name = (GooString *)usedCMaps->get(i);
+    use = (CompiledCMapUse *)p;
+    if (!getUsedCMapStamp(collection, name, &use->srcSize,
+			  &use->srcMTime)) {
+      error(-1, "Couldn't find '%s' CMap file used by '%s'",
+	    name->getCString(), srcFileName->getCString());
+      ok = gFalse;
+    }
+    use->nameLen = name->getLength();
+    memcpy(use + 1, name->getCString(), use->nameLen);
+    p += compiledCMapUseLen(use->nameLen);
   }
+  n = 1;
+  if (ok && !flattenCMapVector(vector, (Guint *)p, 0, &n)) {
+    error(-1, "CID out of range in CMap file '%s'",
+	  srcFileName->getCString());
+    ok = gFalse;
+  }
+  ok = ok && writeCompiledData(fileName->getCString(), &hdr->hdr, len);
+  gfree(hdr);
+  return ok;
+}
 
+// Map <fileName> if it is a well-formed compiled CMap that is up to
+// date with <srcFileName> and with all the CMaps it uses.
+void *CMap::mapCompiled(GooString *collectionA, GooString *fileName,
+			GooString *srcFileName, size_t *len) {
+  CompiledCMapHeader *hdr;
+  CompiledCMapUse *use;
+  GooString *name;
+  void *data;
+  char *p, *end;
+  Guint i, size;
+  double mTime;
+  GBool ok;
+
+  if (!(data = mapCompiledData(fileName->getCString(), compiledCMapMagic,
+			       srcFileName->getCString(), len))) {
+    return NULL;
+  }
+  hdr = (CompiledCMapHeader *)data;
+  if (*len < sizeof(CompiledCMapHeader) || (hdr->usedLen & 7) ||
+      hdr->usedLen > *len - sizeof(CompiledCMapHeader) ||
+      hdr->nTables < 1 ||
+      hdr->nTables > (*len - sizeof(CompiledCMapHeader) - hdr->usedLen) /
+	               (256 * sizeof(Guint)) ||
+      *len != sizeof(CompiledCMapHeader) + hdr->usedLen +
+	        (size_t)hdr->nTables * 256 * sizeof(Guint)) {
+    error(-1, "Bad compiled CMap file '%s'", fileName->getCString());
+    unmapCompiledData(data, *len);
+    return NULL;
+  }
+  p = (char *)(hdr + 1);
+  end = p + hdr->usedLen;
+  ok = gTrue;
+  for (i = 0; ok && i < hdr->nUsed; ++i) {
+    use = (CompiledCMapUse *)p;
+    if ((size_t)(end - p) < sizeof(CompiledCMapUse) ||
+	use->nameLen > (size_t)(end - p) - sizeof(CompiledCMapUse)) {
+      error(-1, "Bad compiled CMap file '%s'", fileName->getCString());
+      ok = gFalse;
+      break;
+    }
+    name = new GooString((char *)(use + 1), use->nameLen);
+    ok = getUsedCMapStamp(collectionA, name, &size, &mTime) &&
+         size == use->srcSize && mTime == use->srcMTime;
+    delete name;
+    p += compiledCMapUseLen(use->nameLen);
+  }
+  if (!ok) {
+    unmapCompiledData(data, *len);
+    return NULL;
+  }
+  return data;
+}
+
+CMap *CMap::readCompiled(GooString *collectionA, GooString *cMapNameA,
+			 GooString *fileName, GooString *srcFileName) {
+  CompiledCMapHeader *hdr;
+  CompiledCMapUse *use;
+  CMap *cmap;
+  void *data;
+  char *p;
+  size_t len;
+  Guint i;
+
+  if (!(data = mapCompiled(collectionA, fileName, srcFileName, &len))) {
+    return NULL;
+  }
+  hdr = (CompiledCMapHeader *)data;
+  cmap = new CMap(collectionA->copy(), cMapNameA->copy(), hdr->wMode);
+  // CMaps compiled from this one depend on the ones it uses, too
+  p = (char *)(hdr + 1);
+  for (i = 0; i < hdr->nUsed; ++i) {
+    use = (CompiledCMapUse *)p;
+    cmap->usedCMaps->append(new GooString((char *)(use + 1), use->nameLen));
+    p += compiledCMapUseLen(use->nameLen);
+  }
+  cmap->tables = (const Guint *)p;
+  cmap->nTables = hdr->nTables;
+  cmap->mapData = data;
+  cmap->mapDataLen = len;
   return cmap;
 }
 
+GBool CMap::isCompiledCurrent(GooString *collectionA, GooString *fileName,
+			      GooString *srcFileName) {
+  void *data;
+  size_t len;
+
+  if (!(data = mapCompiled(collectionA, fileName, srcFileName, &len))) {
+    return gFalse;
+  }
+  unmapCompiledData(data, len);
+  return gTrue;
+}
+
+//------------------------------------------------------------------------
+
 CMap::CMap(GooString *collectionA, GooString *cMapNameA) {
   int i;
 
@@ -192,6 +465,11 @@ CMap::CMap(GooString *collectionA, GooString *cMapNameA) {
     vector[i].isVector = gFalse;
     vector[i].cid = 0;
   }
+  tables = NULL;
+  nTables = 0;
+  mapData = NULL;
+  mapDataLen = 0;
+  usedCMaps = new GooList();
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -203,6 +481,11 @@ CMap::CMap(GooString *collectionA, GooString *cMapNameA, int wModeA) {
   cMapName = cMapNameA;
   wMode = wModeA;
   vector = NULL;
+  tables = NULL;
+  nTables = 0;
+  mapData = NULL;
+  mapDataLen = 0;
+  usedCMaps = new GooList();
   refCnt = 1;
 #if MULTITHREADED
   gInitMutex(&mutex);
@@ -212,6 +495,7 @@ CMap::CMap(GooString *collectionA, GooString *cMapNameA, int wModeA) {
 void CMap::useCMap(CMapCache *cache, const char *useName) {
   GooString *useNameStr;
   CMap *subCMap;
+  int i;
 
   useNameStr = new GooString(useName);
   subCMap = cache->getCMap(collection, useNameStr, NULL);
@@ -219,10 +503,29 @@ void CMap::useCMap(CMapCache *cache, const char *useName) {
   if (!subCMap) {
     return;
   }
-  copyVector(vector, subCMap->vector);
+  if (subCMap->vector) {
+    copyVector(vector, subCMap->vector);
+  } else if (subCMap->tables) {
+    copyTable(vector, subCMap, 0);
+  }
+  addUsedCMap(subCMap->cMapName);
+  for (i = 0; i < subCMap->usedCMaps->getLength(); ++i) {
+    addUsedCMap((GooString *)subCMap->usedCMaps->get(i));
+  }
   subCMap->decRefCnt();
 }
 
+void CMap::addUsedCMap(GooString *name) {
+  int i;
+
+  for (i = 0; i < usedCMaps->getLength(); ++i) {
+    if (!((GooString *)usedCMaps->get(i))->cmp(name)) {
+      return;
+    }
+  }
+  usedCMaps->append(name->copy());
+}
+
 void CMap::copyVector(CMapVectorEntry *dest, CMapVectorEntry *src) {
   int i, j;
 
@@ -248,6 +551,37 @@ void CMap::copyVector(CMapVectorEntry *dest, CMapVectorEntry *src) {
   }
 }
 
+void CMap::copyTable(CMapVectorEntry *dest, CMap *src, Guint table) {
+  Guint e;
+  int i, j;
+
+  for (i = 0; i < 256; ++i) {
+    e = src->tables[table * 256 + i];
+    if (e & cMapSubTable) {
+      e &= ~cMapSubTable;
+      if (e <= table || e >= src->nTables) {
+	continue;
+      }
+      if (!dest[i].isVector) {
+	dest[i].isVector = gTrue;
+	dest[i].vector =
+	  (CMapVectorEntry *)gmallocn(256, sizeof(CMapVectorEntry));
+	for (j = 0; j < 256; ++j) {
+	  dest[i].vector[j].isVector = gFalse;
+	  dest[i].vector[j].cid = 0;
+	}
+      }
+      copyTable(dest[i].vector, src, e);
+    } else {
+      if (dest[i].isVector) {
+	error(-1, "Collision in usecmap");
+      } else {
+	dest[i].cid = e;
+      }
+    }
+  }
+}
+
 void CMap::addCodeSpace(CMapVectorEntry *vec, Guint start, Guint end,
 			Guint nBytes) {
   Guint start2, end2;
@@ -307,6 +641,10 @@ CMap::~CMap() {
   if (vector) {
     freeCMapVector(vector);
   }
+  if (mapData) {
+    unmapCompiledData(mapData, mapDataLen);
+  }
+  deleteGooList(usedCMaps, GooString);
 #if MULTITHREADED
   gDestroyMutex(&mutex);
 #endif
@@ -354,8 +692,29 @@ GBool CMap::match(GooString *collectionA, GooString *cMapNameA) {
 
 CID CMap::getCID(const char *s, int len, int *nUsed) {
   CMapVectorEntry *vec;
+  const Guint *table;
+  Guint e;
   int n, i;
 
+  if ((table = tables)) {
+    n = 0;
+    while (1) {
+      if (n >= len) {
+	*nUsed = n;
+	return 0;
+      }
+      e = table[s[n++] & 0xff];
+      if (!(e & cMapSubTable)) {
+	*nUsed = n;
+	return e;
+      }
+      if ((e &= ~cMapSubTable) >= nTables) {
+	*nUsed = n;
+	return 0;
+      }
+      table = tables + e * 256;
+    }
+  }
   if (!(vec = vector)) {
     // identity CMap
     *nUsed = 2;
@@ -379,6 +738,23 @@ CID CMap::getCID(const char *s, int len, int *nUsed) {
   }
 }
 
+static void setReverseMapEntry(Guint code, Guint cid,
+			       Guint *rmap, Guint rmapSize, Guint ncand) {
+  if (cid < rmapSize) {
+    Guint cand;
+
+    for (cand = 0;cand < ncand;cand++) {
+      Guint idx = cid*ncand+cand;
+      if (rmap[idx] == 0) {
+	rmap[idx] = code;
+	break;
+      } else if (rmap[idx] == code) {
+	break;
+      }
+    }
+  }
+}
+
 void CMap::setReverseMapVector(Guint startCode, CMapVectorEntry *vec,
  Guint *rmap, Guint rmapSize, Guint ncand) {
   int i;
@@ -389,28 +765,35 @@ void CMap::setReverseMapVector(Guint startCode, CMapVectorEntry *vec,
       setReverseMapVector((startCode+i) << 8,
 	  vec[i].vector,rmap,rmapSize,ncand);
     } else {
-      Guint cid = vec[i].cid;
-
-      if (cid < rmapSize) {
-	Guint cand;
-
-	for (cand = 0;cand < ncand;cand++) {
-	  Guint code = startCode+i;
-	  Guint idx = cid*ncand+cand;
-	  if (rmap[idx] == 0) {
-	    rmap[idx] = code;
-	    break;
-	  } else if (rmap[idx] == code) {
-	    break;
-	  }
-	}
+      setReverseMapEntry(startCode+i,vec[i].cid,rmap,rmapSize,ncand);
+    }
+  }
+}
+
+void CMap::setReverseMapTable(Guint startCode, Guint table,
+ Guint *rmap, Guint rmapSize, Guint ncand) {
+  Guint e;
+  int i;
+
+  for (i = 0;i < 256;i++) {
+    e = tables[table * 256 + i];
+    if (e & cMapSubTable) {
+      e &= ~cMapSubTable;
+      if (e > table && e < nTables) {
+	setReverseMapTable((startCode+i) << 8,e,rmap,rmapSize,ncand);
       }
+    } else {
+      setReverseMapEntry(startCode+i,e,rmap,rmapSize,ncand);
     }
   }
 }
 
 void CMap::setReverseMap(Guint *rmap, Guint rmapSize, Guint ncand) {
-  setReverseMapVector(0,vector,rmap,rmapSize,ncand);
+  if (tables) {
+    setReverseMapTable(0,0,rmap,rmapSize,ncand);
+  } else {
+    setReverseMapVector(0,vector,rmap,rmapSize,ncand);
+  }
 }
 
 //------------------------------------------------------------------------
@@ -28,13 +28,15 @@
 #pragma interface
 #endif
 
+#include <stddef.h>
 #include "gtypes.h"
 
 #if MULTITHREADED
-#include "goo/GooMutex.h"
+#include "GooMutex.h"
 #endif
 
 class GooString;
+class GooList;
 struct CMapVectorEntry;
 class CMapCache;
 class Stream;
@@ -47,11 +49,25 @@ public:
   // Create the CMap specified by <collection> and <cMapName>.  Sets
   // the initial reference count to 1.
   // Stream is a stream containing the CMap, can be NULL and 
-  // this means the CMap will be searched in the CMap files
+  // this means the CMap will be searched in the CMap files; a
+  // compiled CMap file is mapped instead of parsing the text file if
+  // there is an up-to-date one.
   // Returns NULL on failure.
   static CMap *parse(CMapCache *cache, GooString *collectionA,
 		     GooString *cMapNameA, Stream *stream);
 
+  // Parse the CMap text file <srcFileName>, with all CMaps it uses,
+  // and write it to <fileName> in the compiled form.  Returns false on
+  // failure.
+  static GBool compile(CMapCache *cache, GooString *collectionA,
+		       GooString *cMapNameA, GooString *srcFileName,
+		       GooString *fileName);
+
+  // Returns true if <fileName> is an up-to-date compiled form of the
+  // CMap text file <srcFileName> and of every CMap it uses.
+  static GBool isCompiledCurrent(GooString *collectionA,
+				 GooString *fileName, GooString *srcFileName);
+
   ~CMap();
 
   void incRefCnt();
@@ -78,20 +94,41 @@ private:
 
   CMap(GooString *collectionA, GooString *cMapNameA);
   CMap(GooString *collectionA, GooString *cMapNameA, int wModeA);
+  static CMap *parse(CMapCache *cache, GooString *collectionA,
+		     GooString *cMapNameA,
+		     int (*getCharFunc)(void *), void *data);
+  static void *mapCompiled(GooString *collectionA, GooString *fileName,
+			   GooString *srcFileName, size_t *len);
+  static CMap *readCompiled(GooString *collectionA, GooString *cMapNameA,
+			    GooString *fileName, GooString *srcFileName);
+  GBool writeCompiled(GooString *fileName, GooString *srcFileName);
   void useCMap(CMapCache *cache, const char *useName);
+  void addUsedCMap(GooString *name);
   void copyVector(CMapVectorEntry *dest, CMapVectorEntry *src);
+  void copyTable(CMapVectorEntry *dest, CMap *src, Guint table);
   void addCodeSpace(CMapVectorEntry *vec, Guint start, Guint end,
 		    Guint nBytes);
   void addCIDs(Guint start, Guint end, Guint nBytes, CID firstCID);
   void freeCMapVector(CMapVectorEntry *vec);
   void setReverseMapVector(Guint startCode, CMapVectorEntry *vec,
           Guint *rmap, Guint rmapSize, Guint ncand);
+  void setReverseMapTable(Guint startCode, Guint table,
+			  Guint *rmap, Guint rmapSize, Guint ncand);
 
   GooString *collection;
   GooString *cMapName;
   int wMode;			// writing mode (0=horizontal, 1=vertical)
   CMapVectorEntry *vector;	// vector for first byte (NULL for
-				//   identity CMap)
+				//   identity and compiled CMaps)
+  const Guint *tables;		// tables of a compiled CMap, 256 entries
+				//   each, the first one for the first
+				//   byte: a CID, or cMapSubTable | the
+				//   index of the table for the next byte
+  Guint nTables;
+  void *mapData;		// mapped compiled CMap file, or NULL
+  size_t mapDataLen;
+  GooList *usedCMaps;		// names of the CMaps merged in through
+				//   usecmap, directly or not [GooString]
   int refCnt;
 #if MULTITHREADED
   GooMutex mutex;
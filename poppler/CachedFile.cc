@@ -0,0 +1,267 @@
+//========================================================================
+//
+// CachedFile.cc
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "gmem.h"
+#include "GooString.h"
+#include "CachedFile.h"
+
+//------------------------------------------------------------------------
+// CachedFile
+//------------------------------------------------------------------------
+
+CachedFile::CachedFile(CachedFileLoader *cachedFileLoaderA, GooString *uriA)
+{
+  uri = uriA;
+  loader = cachedFileLoaderA;
+
+  streamPos = 0;
+  chunks = new std::vector<Chunk>();
+  length = 0;
+  bytesLoaded = 0;
+  loads = 0;
+
+  length = loader->init(uri, this);
+  refCnt = 1;
+
+  chunks->resize(length/CachedFileChunkSize + 1);
+}
+
+CachedFile::~CachedFile()
+{
+  std::vector<Chunk>::iterator it;
+
+  delete uri;
+  delete loader;
+  for (it = chunks->begin(); it < chunks->end(); it++) {
+    gfree(it->data);
+  }
+  delete chunks;
+}
+
+void CachedFile::incRefCnt() {
+  refCnt++;
+}
+
+void CachedFile::decRefCnt() {
+  if (--refCnt == 0)
+    delete this;
+}
+
+CachedFile::Chunk *CachedFile::getChunk(size_t i)
+{
+  Chunk c;
+
+  if (i >= chunks->size()) {
+    c.loaded = gFalse;
+    c.data = NULL;
+    chunks->resize(i + 1, c);
+  }
+  if (!(*chunks)[i].data) {
+    (*chunks)[i].data = (char *)gmalloc(CachedFileChunkSize);
+  }
+  return &(*chunks)[i];
+}
+
+long int CachedFile::tell() {
+  return streamPos;
+}
+
+int CachedFile::seek(long int offset, int origin)
+{
+  if (origin == SEEK_SET) {
+    streamPos = offset;
+  } else if (origin == SEEK_CUR) {
+    streamPos += offset;
+  } else {
+    streamPos = length + offset;
+  }
+
+  if (streamPos > length) {
+    streamPos = 0;
+    return 1;
+  }
+
+  return 0;
+}
+
+int CachedFile::cache(const std::vector<ByteRange> &origRanges)
+{
+  std::vector<int> loadChunks;
+  std::vector<ByteRange> chunkRanges;
+  ByteRange range;
+  size_t first, last, end, i;
+
+  if (length == 0) {
+    return 0;
+  }
+
+  // collect the chunks that aren't loaded yet
+  for (i = 0; i < origRanges.size(); i++) {
+    if (origRanges[i].length == 0 || origRanges[i].offset >= length) {
+      continue;
+    }
+    end = (size_t)origRanges[i].offset + origRanges[i].length;
+    if (end > length) {
+      end = length;
+    }
+    first = origRanges[i].offset / CachedFileChunkSize;
+    last = (end - 1) / CachedFileChunkSize;
+    for (size_t c = first; c <= last; c++) {
+      if (!(*chunks)[c].loaded) {
+        loadChunks.push_back(c);
+      }
+    }
+  }
+  if (loadChunks.empty()) {
+    return 0;
+  }
+  std::sort(loadChunks.begin(), loadChunks.end());
+  loadChunks.erase(std::unique(loadChunks.begin(), loadChunks.end()),
+		   loadChunks.end());
+
+  // merge runs of adjacent chunks into a single range
+  i = 0;
+  while (i < loadChunks.size()) {
+    first = i;
+    while (i + 1 < loadChunks.size() && loadChunks[i+1] == loadChunks[i] + 1) {
+      i++;
+    }
+    range.offset = loadChunks[first] * CachedFileChunkSize;
+    end = (size_t)(loadChunks[i] + 1) * CachedFileChunkSize;
+    if (end > length) {
+      end = length;
+    }
+    range.length = end - range.offset;
+    chunkRanges.push_back(range);
+    bytesLoaded += range.length;
+    i++;
+  }
+  loads++;
+
+  CachedFileWriter writer(this, &loadChunks);
+  return loader->load(chunkRanges, &writer);
+}
+
+int CachedFile::cache(size_t offset, size_t len)
+{
+  std::vector<ByteRange> r;
+  ByteRange range;
+
+  range.offset = offset;
+  range.length = len;
+  r.push_back(range);
+  return cache(r);
+}
+
+size_t CachedFile::read(void *ptr, size_t unitsize, size_t count)
+{
+  size_t bytes = unitsize*count;
+  if (length < (streamPos + bytes)) {
+    bytes = length - streamPos;
+  }
+
+  if (bytes == 0) return 0;
+
+  // Load data
+  if (cache(streamPos, bytes) != 0) return 0;
+
+  // Copy data to buffer
+  size_t toCopy = bytes;
+  while (toCopy) {
+    size_t chunk = streamPos / CachedFileChunkSize;
+    size_t offset = streamPos % CachedFileChunkSize;
+    size_t len = CachedFileChunkSize-offset;
+
+    // the loader came up short
+    if (!(*chunks)[chunk].loaded)
+      return bytes - toCopy;
+
+    if (len > toCopy)
+      len = toCopy;
+
+    memcpy(ptr, (*chunks)[chunk].data + offset, len);
+    streamPos += len;
+    toCopy -= len;
+    ptr = (char*)ptr + len;
+  }
+
+  return bytes;
+}
+
+//------------------------------------------------------------------------
+// CachedFileWriter
+//------------------------------------------------------------------------
+
+CachedFileWriter::CachedFileWriter(CachedFile *cachedFileA, std::vector<int> *chunksA)
+{
+   cachedFile = cachedFileA;
+   chunks = chunksA;
+
+   if (chunks) {
+     offset = 0;
+     it = chunks->begin();
+   }
+}
+
+CachedFileWriter::~CachedFileWriter()
+{
+}
+
+size_t CachedFileWriter::write(const char *ptr, size_t size)
+{
+  const char *cp = ptr;
+  size_t len = size;
+  size_t nfree, ncopy;
+  size_t written = 0;
+  size_t chunk, chunkLength;
+  CachedFile::Chunk *c;
+
+  while (len) {
+    if (chunks) {
+      if (it == chunks->end()) {
+        return written;
+      }
+      chunk = *it;
+      // the last chunk of the file is short
+      chunkLength = cachedFile->length - chunk * CachedFileChunkSize;
+      if (chunkLength > CachedFileChunkSize) {
+        chunkLength = CachedFileChunkSize;
+      }
+    } else {
+      // no chunk list: append to the end of the file
+      offset = cachedFile->length % CachedFileChunkSize;
+      chunk = cachedFile->length / CachedFileChunkSize;
+      chunkLength = CachedFileChunkSize;
+    }
+    c = cachedFile->getChunk(chunk);
+    nfree = chunkLength - offset;
+    ncopy = (len >= nfree) ? nfree : len;
+    memcpy(c->data + offset, cp, ncopy);
+    len -= ncopy;
+    cp += ncopy;
+    offset += ncopy;
+    written += ncopy;
+    if (chunks) {
+      if (offset == chunkLength) {
+        c->loaded = gTrue;
+        offset = 0;
+        it++;
+      }
+    } else {
+      cachedFile->length += ncopy;
+      c->loaded = gTrue;
+    }
+  }
+
+  return written;
+}
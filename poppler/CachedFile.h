@@ -0,0 +1,137 @@
+//========================================================================
+//
+// CachedFile.h
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef CACHEDFILE_H
+#define CACHEDFILE_H
+
+#include "gtypes.h"
+#include "Object.h"
+#include "Stream.h"
+
+#include <vector>
+
+//------------------------------------------------------------------------
+
+#define CachedFileChunkSize 8192
+
+class GooString;
+class CachedFileLoader;
+
+//------------------------------------------------------------------------
+// CachedFile
+//
+// A file whose contents are fetched from a CachedFileLoader in chunks
+// of CachedFileChunkSize bytes, and kept once fetched.  Reads of
+// chunks that aren't loaded yet fetch them one read at a time; cache()
+// fetches a whole set of ranges with a single call to the loader.
+//------------------------------------------------------------------------
+
+class CachedFile {
+
+friend class CachedFileWriter;
+
+public:
+
+  // Takes ownership of <cacheLoader> and <uriA>.
+  CachedFile(CachedFileLoader *cacheLoader, GooString *uriA);
+
+  Guint getLength() { return length; }
+  long int tell();
+  int seek(long int offset, int origin);
+  size_t read(void *ptr, size_t unitsize, size_t count);
+
+  // Make sure all of <ranges> are loaded.  Returns 0 on success.
+  int cache(const std::vector<ByteRange> &ranges);
+
+  // Number of bytes fetched from the loader so far, and the number of
+  // calls it took.
+  Guint getBytesLoaded() { return bytesLoaded; }
+  int getLoads() { return loads; }
+
+  void incRefCnt();
+  void decRefCnt();
+
+private:
+
+  ~CachedFile();
+
+  struct Chunk {
+    GBool loaded;
+    char *data;			// NULL until first written
+  };
+
+  int cache(size_t offset, size_t length);
+  Chunk *getChunk(size_t i);
+
+  CachedFileLoader *loader;
+  GooString *uri;
+
+  size_t length;
+  size_t streamPos;
+
+  std::vector<Chunk> *chunks;
+
+  Guint bytesLoaded;
+  int loads;
+  int refCnt;  // Reference count
+};
+
+//------------------------------------------------------------------------
+// CachedFileWriter
+//
+// Handed to CachedFileLoader::load, which pushes the bytes of the
+// requested ranges through it in order.
+//------------------------------------------------------------------------
+
+class CachedFileWriter {
+
+public:
+
+  // Writes to the chunks listed in <chunksA>, or to the whole file,
+  // starting at byte 0, if <chunksA> is NULL.
+  CachedFileWriter(CachedFile *cachedFile, std::vector<int> *chunksA);
+  ~CachedFileWriter();
+
+  // Writes <size> bytes, returns the number written.
+  size_t write(const char *ptr, size_t size);
+
+private:
+
+  CachedFile *cachedFile;
+  std::vector<int> *chunks;
+  std::vector<int>::iterator it;
+  size_t offset;
+};
+
+//------------------------------------------------------------------------
+// CachedFileLoader
+//
+// The source of a CachedFile's bytes.
+//------------------------------------------------------------------------
+
+class CachedFileLoader {
+
+public:
+
+  virtual ~CachedFileLoader() {};
+
+  // Initializes the file load.
+  // Returns the length of the file.
+  // The caller is responsible for deleting uri and cachedFile.
+  virtual size_t init(GooString *uri, CachedFile *cachedFile) = 0;
+
+  // Loads specified byte ranges and passes it to the writer to store them.
+  // Returns 0 on success, Anything but 0 on failure.
+  // The caller is responsible for deleting the writer.
+  virtual int load(const std::vector<ByteRange> &ranges, CachedFileWriter *writer) = 0;
+
+};
+
+#endif
@@ -46,6 +46,149 @@
 #include "Catalog.h"
 #include "OptionalContent.h"
 
+// Maximum depth of the Pages tree that findPageInTree will descend;
+// deeper trees (or loops) fall back to the sequential walk.
+#define maxPageTreeDepth 256
+
+//------------------------------------------------------------------------
+// PageTreeNode
+//------------------------------------------------------------------------
+
+// A Pages node visited by findPageInTree.  Its kids are counted the
+// first time it is needed: kid i then holds the pages starts[i] ..
+// starts[i+1]-1 of this node, and kids[i] is filled in once
+// findPageInTree descends into it or checks it.
+struct PageTreeNode {
+  Dict *dict;
+  PageAttrs *attrs;		// attributes inherited by the kids
+  int count;			// /Count of this node
+  int nKids;
+  GBool counted;		// set once starts and leaf are filled in
+  int *starts;			// [nKids + 1]
+  GBool *leaf;			// [nKids]
+  PageTreeNode **kids;		// [nKids]
+};
+
+static PageTreeNode *newPageTreeNode(PageAttrs *attrs, Dict *dict,
+				     int count) {
+  PageTreeNode *node;
+  Object kids;
+  int n;
+
+  if (!dict->lookup("Kids", &kids)->isArray() ||
+      (n = kids.arrayGetLength()) == 0) {
+    kids.free();
+    return NULL;
+  }
+  kids.free();
+
+  node = new PageTreeNode;
+  dict->incRef();
+  node->dict = dict;
+  node->attrs = new PageAttrs(attrs, dict);
+  node->count = count;
+  node->nKids = n;
+  node->counted = gFalse;
+  node->starts = (int *)gmallocn(n + 1, sizeof(int));
+  node->starts[0] = 0;
+  node->leaf = (GBool *)gmallocn(n, sizeof(GBool));
+  node->kids = (PageTreeNode **)gmallocn(n, sizeof(PageTreeNode *));
+  for (int i = 0; i < n; ++i) {
+    node->kids[i] = NULL;
+  }
+  return node;
+}
+
+// Count all kids of <node>.  Returns false on anything findPageInTree
+// can't be sure of -- a kid that is not an indirect reference (which
+// cachePageTree rejects), a leaf without /Type /Page, a Pages kid
+// without an integer /Count, or counts that don't add up to the node's
+// /Count -- in that case the tree has to be walked in order.
+static GBool countPageTreeKids(PageTreeNode *node) {
+  Object kids, kid, kidRef, obj1;
+  int i, c;
+
+  if (node->counted) {
+    return gTrue;
+  }
+  if (!node->dict->lookup("Kids", &kids)->isArray() ||
+      kids.arrayGetLength() != node->nKids) {
+    kids.free();
+    return gFalse;
+  }
+  for (i = 0; i < node->nKids; ++i) {
+    if (!kids.arrayGetNF(i, &kidRef)->isRef()) {
+      kidRef.free();
+      kids.free();
+      return gFalse;
+    }
+    kidRef.free();
+    kids.arrayGet(i, &kid);
+    if (kid.isDict("Page")) {
+      node->leaf[i] = gTrue;
+      c = 1;
+    } else if (kid.isDict() && kid.getDict()->hasKey("Kids") &&
+	       kid.dictLookup("Count", &obj1)->isInt() &&
+	       obj1.getInt() >= 0 &&
+	       obj1.getInt() <= node->count - node->starts[i]) {
+      node->leaf[i] = gFalse;
+      c = obj1.getInt();
+      obj1.free();
+    } else {
+      obj1.free();
+      kid.free();
+      kids.free();
+      return gFalse;
+    }
+    kid.free();
+    node->starts[i+1] = node->starts[i] + c;
+  }
+  kids.free();
+  if (node->starts[node->nKids] != node->count) {
+    return gFalse;
+  }
+  node->counted = gTrue;
+  return gTrue;
+}
+
+// Get the node for Pages kid <i> of <node>, counting its kids.
+// Returns NULL if they can't be counted.
+static PageTreeNode *getPageTreeKid(PageTreeNode *node, int i) {
+  Object kids, kid;
+
+  if (!node->kids[i]) {
+    node->dict->lookup("Kids", &kids);
+    kids.arrayGet(i, &kid);
+    kids.free();
+    if (kid.isDict()) {
+      node->kids[i] = newPageTreeNode(node->attrs, kid.getDict(),
+				      node->starts[i+1] - node->starts[i]);
+    }
+    kid.free();
+  }
+  if (!node->kids[i] || !countPageTreeKids(node->kids[i])) {
+    return NULL;
+  }
+  return node->kids[i];
+}
+
+static void freePageTreeNode(PageTreeNode *node) {
+  if (!node) {
+    return;
+  }
+  for (int i = 0; i < node->nKids; ++i) {
+    freePageTreeNode(node->kids[i]);
+  }
+  if (!node->dict->decRef()) {
+    delete node->dict;
+  }
+  delete node->attrs;
+  gfree(node->starts);
+  gfree(node->leaf);
+  gfree(node->kids);
+  delete node;
+}
+
 //------------------------------------------------------------------------
 // Catalog
 //------------------------------------------------------------------------
@@ -56,8 +199,11 @@ Catalog::Catalog(XRef *xrefA) {
   ok = gTrue;
   xref = xrefA;
   pages = NULL;
+  pageRefs = NULL;
   numPages = -1;
   pagesSize = 0;
+  pageTree = NULL;
+  pageCounts = gTrue;
   optContent = NULL;
 
   pagesList = NULL;
@@ -90,6 +236,7 @@ Catalog::Catalog(XRef *xrefA) {
 }
 
 Catalog::~Catalog() {
+  freePageTreeNode(pageTree);
   delete kidsIdxList;
   if (attrsList) {
     std::vector<PageAttrs *>::iterator it;
@@ -114,6 +261,7 @@ Catalog::~Catalog() {
       }
     }
     gfree(pages);
+    gfree(pageRefs);
   }
   delete optContent;
 }
@@ -123,11 +271,121 @@ Page *Catalog::getPage(int i)
   if (i < 1) return NULL;
 
   if (i > lastCachedPage) {
+     // the in-order walk is cheaper when reading pages one after another,
+     // and it checks the pages findPageInTree built ahead as it gets there
+     if (i > lastCachedPage + 1 && pageCounts) {
+       if (pages && i <= pagesSize && pages[i-1]) return pages[i-1];
+       if (findPageInTree(i)) return pages[i-1];
+     }
      if (cachePageTree(i) == gFalse) return NULL;
   }
   return pages[i-1];
 }
 
+GBool Catalog::initPageArray()
+{
+  if (pages == NULL) {
+    pagesSize = getNumPages();
+    if (pagesSize <= 0) return gFalse;
+    pages = (Page **)gmallocn(pagesSize, sizeof(Page *));
+    pageRefs = (Ref *)gmallocn(pagesSize, sizeof(Ref));
+    for (int i = 0; i < pagesSize; ++i) {
+      pages[i] = NULL;
+      pageRefs[i].num = pageRefs[i].gen = -1;
+    }
+  }
+  return gTrue;
+}
+
+GBool Catalog::findPageInTree(int page)
+{
+  Object catDict, obj1, kids, kid, kidRef;
+  PageTreeNode *node;
+  Page *p;
+  int idx, lo, hi, mid, i, j;
+
+  if (!initPageArray() || page > pagesSize) return gFalse;
+
+  if (!pageTree) {
+    xref->getCatalog(&catDict);
+    catDict.dictLookup("Pages", &obj1);
+    catDict.free();
+    if (!obj1.isDict()) {
+      // cachePageTree reports this
+      obj1.free();
+      return gFalse;
+    }
+    pageTree = newPageTreeNode(NULL, obj1.getDict(), numPages);
+    obj1.free();
+  }
+
+  // walk down from the root, keeping the index of the page within the
+  // current node; the /Count of every Pages kid before the one taken is
+  // checked against its own kids, so a wrong count on the path shows up
+  // here instead of as a wrong page
+  node = pageTree;
+  idx = page - 1;
+  for (int depth = 0; node && depth < maxPageTreeDepth; ++depth) {
+    if (!countPageTreeKids(node) || idx >= node->count) {
+      break;
+    }
+
+    // find the last kid starting at or before idx
+    lo = 0;
+    hi = node->nKids - 1;
+    while (lo < hi) {
+      mid = (lo + hi + 1) / 2;
+      if (node->starts[mid] <= idx) {
+	lo = mid;
+      } else {
+	hi = mid - 1;
+      }
+    }
+    i = lo;
+    idx -= node->starts[i];
+
+    for (j = 0; j < i; ++j) {
+      if (!node->leaf[j] && !getPageTreeKid(node, j)) {
+	break;
+      }
+    }
+    if (j < i) {
+      break;
+    }
+
+    if (node->leaf[i]) {
+      node->dict->lookup("Kids", &kids);
+      kids.arrayGet(i, &kid);
+      kids.arrayGetNF(i, &kidRef);
+      kids.free();
+      if (!kid.isDict("Page") || !kidRef.isRef()) {
+	kid.free();
+	kidRef.free();
+	break;
+      }
+      p = new Page(xref, page, kid.getDict(),
+		   new PageAttrs(node->attrs, kid.getDict()));
+      kid.free();
+      if (!p->isOk()) {
+	error(-1, "Failed to create page (page %d)", page);
+	delete p;
+	kidRef.free();
+	return gFalse;
+      }
+      pages[page-1] = p;
+      pageRefs[page-1] = kidRef.getRef();
+      kidRef.free();
+      return gTrue;
+    }
+
+    node = getPageTreeKid(node, i);
+  }
+
+  error(-1, "Page counts in pages tree are unusable (page %d)", page);
+  pageCounts = gFalse;
+  return gFalse;
+}
+
 GBool Catalog::cachePageTree(int page)
 {
   Dict *pagesDict;
@@ -167,11 +425,8 @@ GBool Catalog::cachePageTree(int page)
       return gFalse;
     }
 
-    pagesSize = getNumPages();
-    pages = (Page **)gmallocn(pagesSize, sizeof(Page *));
-    for (int i = 0; i < pagesSize; ++i)
-      pages[i] = NULL;
-  
+    initPageArray();
+
     pagesList = new std::vector<Dict *>();
     pagesList->push_back(pagesDict);
     attrsList = new std::vector<PageAttrs *>();
@@ -235,16 +490,6 @@ GBool Catalog::cachePageTree(int page)
     kids.arrayGet(kidsIdx, &kid);
     kids.free();
     if (kid.isDict("Page") || (kid.isDict() && !kid.getDict()->hasKey("Kids"))) {
-      PageAttrs *attrs = new PageAttrs(attrsList->back(), kid.getDict());
-      Page *p = new Page(xref, lastCachedPage+1, kid.getDict(), attrs);
-      if (!p->isOk()) {
-        error(-1, "Failed to create page (page %d)", lastCachedPage+1);
-        delete p;
-        kidRef.free();
-        kid.free();
-        return gFalse;
-      }
-
       if (lastCachedPage >= numPages) {
         error(-1, "Page count in top-level pages object is incorrect");
         kidRef.free();
@@ -252,7 +497,35 @@ GBool Catalog::cachePageTree(int page)
         return gFalse;
       }
 
-      pages[lastCachedPage] = p;
+      // findPageInTree may already have built this one, but it trusts
+      // the /Count entries; if they led it to another page object, none
+      // of the pages it built ahead can be trusted either
+      if (pages[lastCachedPage] &&
+          (pageRefs[lastCachedPage].num != kidRef.getRefNum() ||
+           pageRefs[lastCachedPage].gen != kidRef.getRefGen())) {
+        error(-1, "Page counts in pages tree are wrong (page %d)",
+              lastCachedPage+1);
+        pageCounts = gFalse;
+        for (int i = lastCachedPage; i < pagesSize; ++i) {
+          if (pages[i]) {
+            delete pages[i];
+            pages[i] = NULL;
+          }
+        }
+      }
+      if (!pages[lastCachedPage]) {
+        PageAttrs *attrs = new PageAttrs(attrsList->back(), kid.getDict());
+        Page *p = new Page(xref, lastCachedPage+1, kid.getDict(), attrs);
+        if (!p->isOk()) {
+          error(-1, "Failed to create page (page %d)", lastCachedPage+1);
+          delete p;
+          kidRef.free();
+          kid.free();
+          return gFalse;
+        }
+        pages[lastCachedPage] = p;
+        pageRefs[lastCachedPage] = kidRef.getRef();
+      }
 
       lastCachedPage++;
       kidsIdxList->back()++;
@@ -41,6 +41,7 @@ class Page;
 class PageAttrs;
 struct Ref;
 class OCGs;
+struct PageTreeNode;
 
 //------------------------------------------------------------------------
 // Catalog
@@ -73,16 +74,23 @@ private:
 
   XRef *xref;			// the xref table for this PDF file
   Page **pages;			// array of pages
+  Ref *pageRefs;		// the page objects <pages> were built from
   int lastCachedPage;
   std::vector<Dict *> *pagesList;
   std::vector<PageAttrs *> *attrsList;
   std::vector<int> *kidsIdxList;
   int numPages;			// number of pages
   int pagesSize;		// size of pages array
+  PageTreeNode *pageTree;	// Pages nodes expanded by findPageInTree
+  GBool pageCounts;		// false once a /Count in the page tree
+				//   was found to be unusable
   OCGs *optContent;		// Optional Content groups
   GBool ok;			// true if catalog is valid
 
+  GBool initPageArray();
   GBool cachePageTree(int page); // Cache first <page> pages.
+  GBool findPageInTree(int page); // Cache only page <page>, using the
+				  //   /Count entries to skip subtrees.
 };
 
 #endif
@@ -39,6 +39,7 @@
 #include "Error.h"
 #include "GlobalParams.h"
 #include "PSTokenizer.h"
+#include "CompiledData.h"
 #include "CharCodeToUnicode.h"
 
 //------------------------------------------------------------------------
@@ -73,6 +74,7 @@ static int getCharFromFile(void *data) {
 
 CharCodeToUnicode *CharCodeToUnicode::parseCIDToUnicode(GooString *fileName,
 							GooString *collection) {
+  GMemScope memScope(gMemTagFonts);
   FILE *f;
   Unicode *mapA;
   CharCode size, mapLenA;
@@ -112,8 +114,72 @@ CharCodeToUnicode *CharCodeToUnicode::parseCIDToUnicode(GooString *fileName,
   return ctu;
 }
 
+// A compiled CID-to-Unicode file holds a CompiledCIDToUnicodeHeader
+// followed by <mapLen> Unicode values, indexed by CID.
+
+struct CompiledCIDToUnicodeHeader {
+  CompiledDataHeader hdr;
+  Guint mapLen;
+  Guint reserved;
+};
+
+CharCodeToUnicode *CharCodeToUnicode::readCompiledCIDToUnicode(
+				    GooString *fileName,
+				    GooString *srcFileName,
+				    GooString *collection) {
+  CompiledCIDToUnicodeHeader *hdr;
+  CharCodeToUnicode *ctu;
+  void *data;
+  size_t len;
+
+  if (!(data = mapCompiledData(fileName->getCString(),
+			       compiledCIDToUnicodeMagic,
+			       srcFileName->getCString(), &len))) {
+    return NULL;
+  }
+  hdr = (CompiledCIDToUnicodeHeader *)data;
+  if (len < sizeof(CompiledCIDToUnicodeHeader) ||
+      hdr->mapLen > (len - sizeof(CompiledCIDToUnicodeHeader)) /
+	              sizeof(Unicode) ||
+      len != sizeof(CompiledCIDToUnicodeHeader) +
+	       (size_t)hdr->mapLen * sizeof(Unicode)) {
+    error(-1, "Bad compiled cidToUnicode file '%s'", fileName->getCString());
+    unmapCompiledData(data, len);
+    return NULL;
+  }
+  ctu = new CharCodeToUnicode(collection->copy(), (Unicode *)(hdr + 1),
+			      hdr->mapLen, gFalse, NULL, 0, 0);
+  ctu->mapData = data;
+  ctu->mapDataLen = len;
+  return ctu;
+}
+
+GBool CharCodeToUnicode::compileCIDToUnicode(GooString *srcFileName,
+					     GooString *fileName) {
+  CompiledCIDToUnicodeHeader *hdr;
+  CharCodeToUnicode *ctu;
+  size_t len;
+  GBool ok;
+
+  if (!(ctu = parseCIDToUnicode(srcFileName, srcFileName))) {
+    return gFalse;
+  }
+  len = sizeof(CompiledCIDToUnicodeHeader) + ctu->mapLen * sizeof(Unicode);
+  hdr = (CompiledCIDToUnicodeHeader *)gmalloc(len);
+  ok = initCompiledDataHeader(&hdr->hdr, compiledCIDToUnicodeMagic,
+			      srcFileName->getCString());
+  hdr->mapLen = ctu->mapLen;
+  hdr->reserved = 0;
+  memcpy(hdr + 1, ctu->map, ctu->mapLen * sizeof(Unicode));
+  ok = ok && writeCompiledData(fileName->getCString(), &hdr->hdr, len);
+  gfree(hdr);
+  ctu->decRefCnt();
+  return ok;
+}
+
 CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(
 						    GooString *fileName) {
+  GMemScope memScope(gMemTagFonts);
   FILE *f;
   Unicode *mapA;
   CharCodeToUnicodeString *sMapA;
@@ -208,10 +274,12 @@ CharCodeToUnicode *CharCodeToUnicode::parseUnicodeToUnicode(
 }
 
 CharCodeToUnicode *CharCodeToUnicode::make8BitToUnicode(Unicode *toUnicode) {
+  GMemScope memScope(gMemTagFonts);
   return new CharCodeToUnicode(NULL, toUnicode, 256, gTrue, NULL, 0, 0);
 }
 
 CharCodeToUnicode *CharCodeToUnicode::parseCMap(GooString *buf, int nBits) {
+  GMemScope memScope(gMemTagFonts);
   CharCodeToUnicode *ctu;
   const char *p;
 
@@ -223,6 +291,7 @@ CharCodeToUnicode *CharCodeToUnicode::parseCMap(GooString *buf, int nBits) {
 
 CharCodeToUnicode *CharCodeToUnicode::parseCMapFromFile(GooString *fileName,
   int nBits) {
+  GMemScope memScope(gMemTagFonts);
   CharCodeToUnicode *ctu;
   FILE *f;
 
@@ -362,6 +431,7 @@ void CharCodeToUnicode::addMapping(CharCode code, char *uStr, int n,
   char uHex[5];
   int j;
 
+  unshareMap();
   if (code >= mapLen) {
     oldLen = mapLen;
     mapLen = (code + 256) & ~255;
@@ -412,6 +482,8 @@ CharCodeToUnicode::CharCodeToUnicode(GooString *tagA) {
   for (i = 0; i < mapLen; ++i) {
     map[i] = 0;
   }
+  mapData = NULL;
+  mapDataLen = 0;
   sMap = NULL;
   sMapLen = sMapSize = 0;
   refCnt = 1;
@@ -432,6 +504,8 @@ CharCodeToUnicode::CharCodeToUnicode(GooString *tagA, Unicode *mapA,
   } else {
     map = mapA;
   }
+  mapData = NULL;
+  mapDataLen = 0;
   sMap = sMapA;
   sMapLen = sMapLenA;
   sMapSize = sMapSizeA;
@@ -445,7 +519,11 @@ CharCodeToUnicode::~CharCodeToUnicode() {
   if (tag) {
     delete tag;
   }
-  gfree(map);
+  if (mapData) {
+    unmapCompiledData(mapData, mapDataLen);
+  } else {
+    gfree(map);
+  }
   if (sMap) {
     for (int i = 0; i < sMapLen; ++i) gfree(sMap[i].u);
     gfree(sMap);
@@ -484,9 +562,23 @@ GBool CharCodeToUnicode::match(GooString *tagA) {
   return tag && !tag->cmp(tagA);
 }
 
+// Copy a map that lives in a mapped compiled file, before changing it.
+void CharCodeToUnicode::unshareMap() {
+  Unicode *mapA;
+
+  if (mapData) {
+    mapA = (Unicode *)gmallocn(mapLen, sizeof(Unicode));
+    memcpy(mapA, map, mapLen * sizeof(Unicode));
+    unmapCompiledData(mapData, mapDataLen);
+    mapData = NULL;
+    map = mapA;
+  }
+}
+
 void CharCodeToUnicode::setMapping(CharCode c, Unicode *u, int len) {
   int i, j;
 
+  unshareMap();
   if (len == 1) {
     map[c] = u[0];
   } else {
@@ -31,10 +31,11 @@
 #pragma interface
 #endif
 
+#include <stddef.h>
 #include "gtypes.h"
 
 #if MULTITHREADED
-#include "goo/GooMutex.h"
+#include "GooMutex.h"
 #endif
 
 struct CharCodeToUnicodeString;
@@ -51,6 +52,19 @@ public:
   static CharCodeToUnicode *parseCIDToUnicode(GooString *fileName,
 					      GooString *collection);
 
+  // Map the compiled CID-to-Unicode mapping for <collection> from
+  // <fileName>, if it is up to date with the text file <srcFileName>.
+  // The mapping is shared read-only until it is modified.  Sets the
+  // initial reference count to 1.  Returns NULL on failure.
+  static CharCodeToUnicode *readCompiledCIDToUnicode(GooString *fileName,
+						     GooString *srcFileName,
+						     GooString *collection);
+
+  // Read the CID-to-Unicode text file <srcFileName> and write it to
+  // <fileName> in the compiled form.  Returns false on failure.
+  static GBool compileCIDToUnicode(GooString *srcFileName,
+				   GooString *fileName);
+
   // Create a Unicode-to-Unicode mapping from the file specified by
   // <fileName>.  Sets the initial reference count to 1.  Returns NULL
   // on failure.
@@ -93,6 +107,7 @@ private:
 
   void parseCMap1(int (*getCharFunc)(void *), void *data, int nBits);
   void addMapping(CharCode code, char *uStr, int n, int offset);
+  void unshareMap();
   CharCodeToUnicode(GooString *tagA);
   CharCodeToUnicode(GooString *tagA, Unicode *mapA,
 		    CharCode mapLenA, GBool copyMap,
@@ -102,6 +117,8 @@ private:
   GooString *tag;
   Unicode *map;
   CharCode mapLen;
+  void *mapData;		// mapped compiled file holding <map>, or
+  size_t mapDataLen;		//   NULL if <map> is allocated
   CharCodeToUnicodeString *sMap;
   int sMapLen, sMapSize;
   int refCnt;
@@ -0,0 +1,105 @@
+//========================================================================
+//
+// CompiledData.cc
+//
+// Binary files compiled from the CMap and cidToUnicode text files in
+// poppler-data.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "GooString.h"
+#include "Error.h"
+#include "CompiledData.h"
+
+//------------------------------------------------------------------------
+
+GBool initCompiledDataHeader(CompiledDataHeader *hdr, Guint magic,
+			     const char *srcFileName) {
+  memset(hdr, 0, sizeof(CompiledDataHeader));
+  hdr->magic = magic;
+  hdr->version = compiledDataVersion;
+  return getCompiledDataSourceStamp(srcFileName, &hdr->srcSize,
+				    &hdr->srcMTime);
+}
+
+GBool getCompiledDataSourceStamp(const char *srcFileName,
+				 Guint *size, double *mTime) {
+  struct stat st;
+
+  if (stat(srcFileName, &st) != 0) {
+    return gFalse;
+  }
+  *size = (Guint)st.st_size;
+  *mTime = (double)st.st_mtime;
+  return gTrue;
+}
+
+void *mapCompiledData(const char *fileName, Guint magic,
+		      const char *srcFileName, size_t *len) {
+  CompiledDataHeader srcHdr;
+  CompiledDataHeader *hdr;
+  struct stat st;
+  void *data;
+  int fd;
+
+  if ((fd = open(fileName, O_RDONLY)) < 0) {
+    return NULL;
+  }
+  if (fstat(fd, &st) != 0 ||
+      (size_t)st.st_size < sizeof(CompiledDataHeader) ||
+      !initCompiledDataHeader(&srcHdr, magic, srcFileName)) {
+    close(fd);
+    return NULL;
+  }
+  *len = st.st_size;
+  data = mmap(NULL, *len, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return NULL;
+  }
+  hdr = (CompiledDataHeader *)data;
+  if (hdr->magic != srcHdr.magic || hdr->version != srcHdr.version ||
+      hdr->fileSize != *len || hdr->srcSize != srcHdr.srcSize ||
+      hdr->srcMTime != srcHdr.srcMTime) {
+    munmap(data, *len);
+    return NULL;
+  }
+  return data;
+}
+
+void unmapCompiledData(void *data, size_t len) {
+  munmap(data, len);
+}
+
+GBool writeCompiledData(const char *fileName, CompiledDataHeader *data,
+			size_t len) {
+  GooString *tmpName;
+  FILE *f;
+  GBool ok;
+
+  data->fileSize = (Guint)len;
+  tmpName = GooString::format("{0:s}.{1:d}.{2:ulx}", fileName,
+			      (int)getpid(), (Gulong)data);
+  ok = (f = fopen(tmpName->getCString(), "wb")) &&
+       fwrite(data, 1, len, f) == len;
+  if (f && fclose(f) != 0) {
+    ok = gFalse;
+  }
+  if (ok && rename(tmpName->getCString(), fileName) != 0) {
+    ok = gFalse;
+  }
+  if (!ok) {
+    error(-1, "Couldn't write compiled data file '%s'", fileName);
+    unlink(tmpName->getCString());
+  }
+  delete tmpName;
+  return ok;
+}
@@ -0,0 +1,66 @@
+//========================================================================
+//
+// CompiledData.h
+//
+// Binary files compiled from the CMap and cidToUnicode text files in
+// poppler-data.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef COMPILEDDATA_H
+#define COMPILEDDATA_H
+
+#include <stddef.h>
+#include "gtypes.h"
+
+//------------------------------------------------------------------------
+
+// Bump this whenever the layout of a compiled file changes; files with
+// another version are ignored and compiled again.
+#define compiledDataVersion 2
+
+#define compiledCMapMagic         0x50414d43	// "CMAP"
+#define compiledCIDToUnicodeMagic 0x55444943	// "CIDU"
+
+// Every compiled file starts with this header.  The size and
+// modification time of the text file it was compiled from tell whether
+// it is out of date.  The data following the header starts on an
+// 8-byte boundary.
+struct CompiledDataHeader {
+  Guint magic;
+  Guint version;
+  Guint fileSize;		// size of the compiled file
+  Guint srcSize;
+  double srcMTime;
+};
+
+//------------------------------------------------------------------------
+
+// Fill in <hdr> for a file of kind <magic> compiled from <srcFileName>.
+// Returns false if <srcFileName> doesn't exist.
+extern GBool initCompiledDataHeader(CompiledDataHeader *hdr, Guint magic,
+				    const char *srcFileName);
+
+// Get the size and modification time that identify the version of
+// <srcFileName>.  Returns false if it doesn't exist.
+extern GBool getCompiledDataSourceStamp(const char *srcFileName,
+					Guint *size, double *mTime);
+
+// Map <fileName> read-only into memory, if it is a compiled file of
+// kind <magic> that is up to date with <srcFileName>.  The mapping
+// starts with the header and is *<len> bytes long.  Returns NULL
+// otherwise.
+extern void *mapCompiledData(const char *fileName, Guint magic,
+			     const char *srcFileName, size_t *len);
+
+extern void unmapCompiledData(void *data, size_t len);
+
+// Write the <len> bytes at <data>, which start with the header, to
+// <fileName>.  The data goes to a temporary file that is renamed into
+// place, so that readers never map a partly written file.
+extern GBool writeCompiledData(const char *fileName, CompiledDataHeader *data,
+			       size_t len);
+
+#endif
@@ -34,9 +34,11 @@
 
 static void rc4InitKey(Guchar *key, int keyLen, Guchar *state);
 static Guchar rc4DecryptByte(Guchar *state, Guchar *x, Guchar *y, Guchar c);
-static void aesKeyExpansion(DecryptAESState *s,
-			    Guchar *objKey, int objKeyLen);
+static void rc4DecryptBytes(Guchar *state, Guchar *x, Guchar *y,
+			    Guchar *buf, int n);
+static void aesKeyExpansion(Guint *w, Guchar *objKey, int objKeyLen);
 static void aesDecryptBlock(DecryptAESState *s, Guchar *in, GBool last);
+static void aesDecryptCBC(DecryptAESState *s, Guchar *buf, int nBlocks);
 
 static const Guchar passwordPad[32] = {
   0x28, 0xbf, 0x4e, 0x5e, 0x4e, 0x75, 0x8a, 0x41,
@@ -192,42 +194,60 @@ GBool Decrypt::makeFileKey2(int encVersion, int encRevision, int keyLength,
   return ok;
 }
 
-//------------------------------------------------------------------------
-// DecryptStream
-//------------------------------------------------------------------------
-
-DecryptStream::DecryptStream(Stream *strA, Guchar *fileKey,
-			     CryptAlgorithm algoA, int keyLength,
-			     int objNum, int objGen):
-  FilterStream(strA)
-{
+void Decrypt::makeObjKey(Guchar *fileKey, CryptAlgorithm algo,
+			 int keyLength, int objNum, int objGen,
+			 DecryptObjKey *objKey) {
+  Guchar buf[16 + 9];
   int n, i;
 
-  algo = algoA;
-
-  // construct object key
   for (i = 0; i < keyLength; ++i) {
-    objKey[i] = fileKey[i];
+    buf[i] = fileKey[i];
   }
-  objKey[keyLength] = objNum & 0xff;
-  objKey[keyLength + 1] = (objNum >> 8) & 0xff;
-  objKey[keyLength + 2] = (objNum >> 16) & 0xff;
-  objKey[keyLength + 3] = objGen & 0xff;
-  objKey[keyLength + 4] = (objGen >> 8) & 0xff;
+  buf[keyLength] = objNum & 0xff;
+  buf[keyLength + 1] = (objNum >> 8) & 0xff;
+  buf[keyLength + 2] = (objNum >> 16) & 0xff;
+  buf[keyLength + 3] = objGen & 0xff;
+  buf[keyLength + 4] = (objGen >> 8) & 0xff;
   if (algo == cryptAES) {
-    objKey[keyLength + 5] = 0x73; // 's'
-    objKey[keyLength + 6] = 0x41; // 'A'
-    objKey[keyLength + 7] = 0x6c; // 'l'
-    objKey[keyLength + 8] = 0x54; // 'T'
+    buf[keyLength + 5] = 0x73; // 's'
+    buf[keyLength + 6] = 0x41; // 'A'
+    buf[keyLength + 7] = 0x6c; // 'l'
+    buf[keyLength + 8] = 0x54; // 'T'
     n = keyLength + 9;
   } else {
     n = keyLength + 5;
   }
-  Decrypt::md5(objKey, n, objKey);
-  if ((objKeyLength = keyLength + 5) > 16) {
-    objKeyLength = 16;
+  md5(buf, n, objKey->key);
+  if ((objKey->length = keyLength + 5) > 16) {
+    objKey->length = 16;
+  }
+  if (algo == cryptAES) {
+    aesKeyExpansion(objKey->sched.aes, objKey->key, objKey->length);
+  } else {
+    rc4InitKey(objKey->key, objKey->length, objKey->sched.rc4);
   }
+}
 
+//------------------------------------------------------------------------
+// DecryptStream
+//------------------------------------------------------------------------
+
+DecryptStream::DecryptStream(Stream *strA, Guchar *fileKey,
+			     CryptAlgorithm algoA, int keyLength,
+			     int objNum, int objGen):
+  FilterStream(strA)
+{
+  algo = algoA;
+  Decrypt::makeObjKey(fileKey, algo, keyLength, objNum, objGen, &objKey);
+  charactersRead = 0;
+}
+
+DecryptStream::DecryptStream(Stream *strA, DecryptObjKey *objKeyA,
+			     CryptAlgorithm algoA):
+  FilterStream(strA)
+{
+  algo = algoA;
+  objKey = *objKeyA;
   charactersRead = 0;
 }
 
@@ -243,11 +263,11 @@ void DecryptStream::reset() {
   switch (algo) {
   case cryptRC4:
     state.rc4.x = state.rc4.y = 0;
-    rc4InitKey(objKey, objKeyLength, state.rc4.state);
+    memcpy(state.rc4.state, objKey.sched.rc4, sizeof(state.rc4.state));
     state.rc4.buf = EOF;
     break;
   case cryptAES:
-    aesKeyExpansion(&state.aes, objKey, objKeyLength);
+    memcpy(state.aes.w, objKey.sched.aes, sizeof(state.aes.w));
     for (i = 0; i < 16; ++i) {
       state.aes.cbc[i] = str->getChar();
     }
@@ -335,6 +355,59 @@ int DecryptStream::lookChar() {
   return c;
 }
 
+int DecryptStream::getChars(int nChars, Guchar *buffer) {
+  Guchar in[16];
+  int n, m, nBlocks;
+
+  n = 0;
+  switch (algo) {
+  case cryptRC4:
+    if (state.rc4.buf != EOF && nChars > 0) {
+      buffer[n++] = (Guchar)state.rc4.buf;
+      state.rc4.buf = EOF;
+    }
+    m = str->doGetChars(nChars - n, buffer + n);
+    rc4DecryptBytes(state.rc4.state, &state.rc4.x, &state.rc4.y,
+		    buffer + n, m);
+    n += m;
+    break;
+  case cryptAES:
+    while (n < nChars) {
+      if (state.aes.bufIdx < 16) {
+	m = 16 - state.aes.bufIdx;
+	if (m > nChars - n) {
+	  m = nChars - n;
+	}
+	memcpy(buffer + n, state.aes.buf + state.aes.bufIdx, m);
+	state.aes.bufIdx += m;
+	n += m;
+	continue;
+      }
+      nBlocks = (nChars - n) / 16;
+      if (nBlocks > 1) {
+	// decrypt in place, in the caller's buffer; the last block read
+	// goes through state.aes.buf, as it may be the padded one
+	m = str->doGetChars((nBlocks - 1) * 16, buffer + n);
+	if (m < 16) {
+	  break;
+	}
+	aesDecryptCBC(&state.aes, buffer + n, m / 16 - 1);
+	n += (m / 16 - 1) * 16;
+	aesDecryptBlock(&state.aes, buffer + n,
+			!(m & 15) && str->lookChar() == EOF);
+      } else {
+	if (str->doGetChars(16, in) < 16) {
+	  break;
+	}
+	aesDecryptBlock(&state.aes, in, str->lookChar() == EOF);
+      }
+    }
+    break;
+  }
+  charactersRead += n;
+  return n;
+}
+
 GBool DecryptStream::isBinary(GBool last) {
   return str->isBinary(last);
 }
@@ -376,6 +449,26 @@ static Guchar rc4DecryptByte(Guchar *state, Guchar *x, Guchar *y, Guchar c) {
   return c ^ state[(tx + ty) % 256];
 }
 
+static void rc4DecryptBytes(Guchar *state, Guchar *x, Guchar *y,
+			    Guchar *buf, int n) {
+  Guchar x1, y1, tx, ty;
+  int i;
+
+  x1 = *x;
+  y1 = *y;
+  for (i = 0; i < n; ++i) {
+    x1 = (x1 + 1) % 256;
+    tx = state[x1];
+    y1 = (tx + y1) % 256;
+    ty = state[y1];
+    state[x1] = ty;
+    state[y1] = tx;
+    buf[i] ^= state[(tx + ty) % 256];
+  }
+  *x = x1;
+  *y = y1;
+}
+
 //------------------------------------------------------------------------
 // AES decryption
 //------------------------------------------------------------------------
@@ -418,6 +511,76 @@ static const Guchar invSbox[256] = {
   0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
 };
 
+// InvMixColumns applied to the inverse S-box: column
+// ({0e}, {09}, {0d}, {0b}) * invSbox[x], packed big-endian.  Rotating it
+// gives the other three columns of the matrix.
+static const Guint invTable[256] = {
+  0x51f4a750, 0x7e416553, 0x1a17a4c3, 0x3a275e96,
+  0x3bab6bcb, 0x1f9d45f1, 0xacfa58ab, 0x4be30393,
+  0x2030fa55, 0xad766df6, 0x88cc7691, 0xf5024c25,
+  0x4fe5d7fc, 0xc52acbd7, 0x26354480, 0xb562a38f,
+  0xdeb15a49, 0x25ba1b67, 0x45ea0e98, 0x5dfec0e1,
+  0xc32f7502, 0x814cf012, 0x8d4697a3, 0x6bd3f9c6,
+  0x038f5fe7, 0x15929c95, 0xbf6d7aeb, 0x955259da,
+  0xd4be832d, 0x587421d3, 0x49e06929, 0x8ec9c844,
+  0x75c2896a, 0xf48e7978, 0x99583e6b, 0x27b971dd,
+  0xbee14fb6, 0xf088ad17, 0xc920ac66, 0x7dce3ab4,
+  0x63df4a18, 0xe51a3182, 0x97513360, 0x62537f45,
+  0xb16477e0, 0xbb6bae84, 0xfe81a01c, 0xf9082b94,
+  0x70486858, 0x8f45fd19, 0x94de6c87, 0x527bf8b7,
+  0xab73d323, 0x724b02e2, 0xe31f8f57, 0x6655ab2a,
+  0xb2eb2807, 0x2fb5c203, 0x86c57b9a, 0xd33708a5,
+  0x302887f2, 0x23bfa5b2, 0x02036aba, 0xed16825c,
+  0x8acf1c2b, 0xa779b492, 0xf307f2f0, 0x4e69e2a1,
+  0x65daf4cd, 0x0605bed5, 0xd134621f, 0xc4a6fe8a,
+  0x342e539d, 0xa2f355a0, 0x058ae132, 0xa4f6eb75,
+  0x0b83ec39, 0x4060efaa, 0x5e719f06, 0xbd6e1051,
+  0x3e218af9, 0x96dd063d, 0xdd3e05ae, 0x4de6bd46,
+  0x91548db5, 0x71c45d05, 0x0406d46f, 0x605015ff,
+  0x1998fb24, 0xd6bde997, 0x894043cc, 0x67d99e77,
+  0xb0e842bd, 0x07898b88, 0xe7195b38, 0x79c8eedb,
+  0xa17c0a47, 0x7c420fe9, 0xf8841ec9, 0x00000000,
+  0x09808683, 0x322bed48, 0x1e1170ac, 0x6c5a724e,
+  0xfd0efffb, 0x0f853856, 0x3daed51e, 0x362d3927,
+  0x0a0fd964, 0x685ca621, 0x9b5b54d1, 0x24362e3a,
+  0x0c0a67b1, 0x9357e70f, 0xb4ee96d2, 0x1b9b919e,
+  0x80c0c54f, 0x61dc20a2, 0x5a774b69, 0x1c121a16,
+  0xe293ba0a, 0xc0a02ae5, 0x3c22e043, 0x121b171d,
+  0x0e090d0b, 0xf28bc7ad, 0x2db6a8b9, 0x141ea9c8,
+  0x57f11985, 0xaf75074c, 0xee99ddbb, 0xa37f60fd,
+  0xf701269f, 0x5c72f5bc, 0x44663bc5, 0x5bfb7e34,
+  0x8b432976, 0xcb23c6dc, 0xb6edfc68, 0xb8e4f163,
+  0xd731dcca, 0x42638510, 0x13972240, 0x84c61120,
+  0x854a247d, 0xd2bb3df8, 0xaef93211, 0xc729a16d,
+  0x1d9e2f4b, 0xdcb230f3, 0x0d8652ec, 0x77c1e3d0,
+  0x2bb3166c, 0xa970b999, 0x119448fa, 0x47e96422,
+  0xa8fc8cc4, 0xa0f03f1a, 0x567d2cd8, 0x223390ef,
+  0x87494ec7, 0xd938d1c1, 0x8ccaa2fe, 0x98d40b36,
+  0xa6f581cf, 0xa57ade28, 0xdab78e26, 0x3fadbfa4,
+  0x2c3a9de4, 0x5078920d, 0x6a5fcc9b, 0x547e4662,
+  0xf68d13c2, 0x90d8b8e8, 0x2e39f75e, 0x82c3aff5,
+  0x9f5d80be, 0x69d0937c, 0x6fd52da9, 0xcf2512b3,
+  0xc8ac993b, 0x10187da7, 0xe89c636e, 0xdb3bbb7b,
+  0xcd267809, 0x6e5918f4, 0xec9ab701, 0x834f9aa8,
+  0xe6956e65, 0xaaffe67e, 0x21bccf08, 0xef15e8e6,
+  0xbae79bd9, 0x4a6f36ce, 0xea9f09d4, 0x29b07cd6,
+  0x31a4b2af, 0x2a3f2331, 0xc6a59430, 0x35a266c0,
+  0x744ebc37, 0xfc82caa6, 0xe090d0b0, 0x33a7d815,
+  0xf104984a, 0x41ecdaf7, 0x7fcd500e, 0x1791f62f,
+  0x764dd68d, 0x43efb04d, 0xccaa4d54, 0xe49604df,
+  0x9ed1b5e3, 0x4c6a881b, 0xc12c1fb8, 0x4665517f,
+  0x9d5eea04, 0x018c355d, 0xfa877473, 0xfb0b412e,
+  0xb3671d5a, 0x92dbd252, 0xe9105633, 0x6dd64713,
+  0x9ad7618c, 0x37a10c7a, 0x59f8148e, 0xeb133c89,
+  0xcea927ee, 0xb761c935, 0xe11ce5ed, 0x7a47b13c,
+  0x9cd2df59, 0x55f2733f, 0x1814ce79, 0x73c737bf,
+  0x53f7cdea, 0x5ffdaa5b, 0xdf3d6f14, 0x7844db86,
+  0xcaaff381, 0xb968c43e, 0x3824342c, 0xc2a3405f,
+  0x161dc372, 0xbce2250c, 0x283c498b, 0xff0d9541,
+  0x39a80171, 0x080cb3de, 0xd8b4e49c, 0x6456c190,
+  0x7bcb8461, 0xd532b670, 0x486c5c74, 0xd0b85742
+};
+
 static const Guint rcon[11] = {
   0x00000000, // unused
   0x01000000,
@@ -443,37 +606,6 @@ static inline Guint rotWord(Guint x) {
   return ((x << 8) & 0xffffffff) | (x >> 24);
 }
 
-static inline void invSubBytes(Guchar *state) {
-  int i;
-
-  for (i = 0; i < 16; ++i) {
-    state[i] = invSbox[state[i]];
-  }
-}
-
-static inline void invShiftRows(Guchar *state) {
-  Guchar t;
-
-  t = state[7];
-  state[7] = state[6];
-  state[6] = state[5];
-  state[5] = state[4];
-  state[4] = t;
-
-  t = state[8];
-  state[8] = state[10];
-  state[10] = t;
-  t = state[9];
-  state[9] = state[11];
-  state[11] = t;
-
-  t = state[12];
-  state[12] = state[13];
-  state[13] = state[14];
-  state[14] = state[15];
-  state[15] = t;
-}
-
 // {09} \cdot s
 static inline Guchar mul09(Guchar s) {
   Guchar s2, s4, s8;
@@ -514,22 +646,6 @@ static inline Guchar mul0e(Guchar s) {
   return s2 ^ s4 ^ s8;
 }
 
-static inline void invMixColumns(Guchar *state) {
-  int c;
-  Guchar s0, s1, s2, s3;
-
-  for (c = 0; c < 4; ++c) {
-    s0 = state[c];
-    s1 = state[4+c];
-    s2 = state[8+c];
-    s3 = state[12+c];
-    state[c] =    mul0e(s0) ^ mul0b(s1) ^ mul0d(s2) ^ mul09(s3);
-    state[4+c] =  mul09(s0) ^ mul0e(s1) ^ mul0b(s2) ^ mul0d(s3);
-    state[8+c] =  mul0d(s0) ^ mul09(s1) ^ mul0e(s2) ^ mul0b(s3);
-    state[12+c] = mul0b(s0) ^ mul0d(s1) ^ mul09(s2) ^ mul0e(s3);
-  }
-}
-
 static inline void invMixColumnsW(Guint *w) {
   int c;
   Guchar s0, s1, s2, s3;
@@ -546,73 +662,98 @@ static inline void invMixColumnsW(Guint *w) {
   }
 }
 
-static inline void addRoundKey(Guchar *state, Guint *w) {
-  int c;
-
-  for (c = 0; c < 4; ++c) {
-    state[c] ^= w[c] >> 24;
-    state[4+c] ^= w[c] >> 16;
-    state[8+c] ^= w[c] >> 8;
-    state[12+c] ^= w[c];
-  }
-}
-
-static void aesKeyExpansion(DecryptAESState *s,
-			    Guchar *objKey, int /*objKeyLen*/) {
+static void aesKeyExpansion(Guint *w, Guchar *objKey, int /*objKeyLen*/) {
   Guint temp;
   int i, round;
 
   //~ this assumes objKeyLen == 16
 
   for (i = 0; i < 4; ++i) {
-    s->w[i] = (objKey[4*i] << 24) + (objKey[4*i+1] << 16) +
-              (objKey[4*i+2] << 8) + objKey[4*i+3];
+    w[i] = (objKey[4*i] << 24) + (objKey[4*i+1] << 16) +
+           (objKey[4*i+2] << 8) + objKey[4*i+3];
   }
   for (i = 4; i < 44; ++i) {
-    temp = s->w[i-1];
+    temp = w[i-1];
     if (!(i & 3)) {
       temp = subWord(rotWord(temp)) ^ rcon[i/4];
     }
-    s->w[i] = s->w[i-4] ^ temp;
+    w[i] = w[i-4] ^ temp;
   }
   for (round = 1; round <= 9; ++round) {
-    invMixColumnsW(&s->w[round * 4]);
+    invMixColumnsW(&w[round * 4]);
   }
 }
 
-static void aesDecryptBlock(DecryptAESState *s, Guchar *in, GBool last) {
-  int c, round, n, i;
+static inline Guint rotr8(Guint x) {
+  return (x >> 8) | (x << 24);
+}
 
-  // initial state
-  for (c = 0; c < 4; ++c) {
-    s->state[c] = in[4*c];
-    s->state[4+c] = in[4*c+1];
-    s->state[8+c] = in[4*c+2];
-    s->state[12+c] = in[4*c+3];
-  }
+static inline Guint invRoundColumn(Guint a, Guint b, Guint c, Guint d) {
+  return invTable[a >> 24]
+         ^ rotr8(invTable[(b >> 16) & 0xff])
+         ^ rotr8(rotr8(invTable[(c >> 8) & 0xff]))
+         ^ rotr8(rotr8(rotr8(invTable[d & 0xff])));
+}
+
+static inline Guint invLastColumn(Guint a, Guint b, Guint c, Guint d) {
+  return (invSbox[a >> 24] << 24)
+         | (invSbox[(b >> 16) & 0xff] << 16)
+         | (invSbox[(c >> 8) & 0xff] << 8)
+         | invSbox[d & 0xff];
+}
+
+static inline Guint getWord(Guchar *p) {
+  return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static inline void putWord(Guchar *p, Guint x) {
+  p[0] = x >> 24;
+  p[1] = x >> 16;
+  p[2] = x >> 8;
+  p[3] = x;
+}
+
+// Decrypt one block, without CBC.  This is the equivalent inverse
+// cipher (FIPS-197, 5.3.5) on 32-bit columns: InvSubBytes,
+// InvShiftRows and InvMixColumns of a round are one table lookup per
+// byte.
+static void aesDecryptRaw(Guint *w, Guchar *in, Guchar *out) {
+  Guint s0, s1, s2, s3, t0, t1, t2, t3;
+  int round;
 
   // round 0
-  addRoundKey(s->state, &s->w[10 * 4]);
+  s0 = getWord(in) ^ w[40];
+  s1 = getWord(in + 4) ^ w[41];
+  s2 = getWord(in + 8) ^ w[42];
+  s3 = getWord(in + 12) ^ w[43];
 
   // rounds 1-9
   for (round = 9; round >= 1; --round) {
-    invSubBytes(s->state);
-    invShiftRows(s->state);
-    invMixColumns(s->state);
-    addRoundKey(s->state, &s->w[round * 4]);
+    t0 = invRoundColumn(s0, s3, s2, s1) ^ w[round * 4];
+    t1 = invRoundColumn(s1, s0, s3, s2) ^ w[round * 4 + 1];
+    t2 = invRoundColumn(s2, s1, s0, s3) ^ w[round * 4 + 2];
+    t3 = invRoundColumn(s3, s2, s1, s0) ^ w[round * 4 + 3];
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
   }
 
   // round 10
-  invSubBytes(s->state);
-  invShiftRows(s->state);
-  addRoundKey(s->state, &s->w[0]);
+  putWord(out, invLastColumn(s0, s3, s2, s1) ^ w[0]);
+  putWord(out + 4, invLastColumn(s1, s0, s3, s2) ^ w[1]);
+  putWord(out + 8, invLastColumn(s2, s1, s0, s3) ^ w[2]);
+  putWord(out + 12, invLastColumn(s3, s2, s1, s0) ^ w[3]);
+}
+
+static void aesDecryptBlock(DecryptAESState *s, Guchar *in, GBool last) {
+  int n, i;
+
+  aesDecryptRaw(s->w, in, s->buf);
 
   // CBC
-  for (c = 0; c < 4; ++c) {
-    s->buf[4*c] = s->state[c] ^ s->cbc[4*c];
-    s->buf[4*c+1] = s->state[4+c] ^ s->cbc[4*c+1];
-    s->buf[4*c+2] = s->state[8+c] ^ s->cbc[4*c+2];
-    s->buf[4*c+3] = s->state[12+c] ^ s->cbc[4*c+3];
+  for (i = 0; i < 16; ++i) {
+    s->buf[i] ^= s->cbc[i];
   }
 
   // save the input block for the next CBC
@@ -636,6 +777,105 @@ static void aesDecryptBlock(DecryptAESState *s, Guchar *in, GBool last) {
   }
 }
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+// AES-NI: aesdec takes the same InvMixColumns-transformed round keys
+// that aesKeyExpansion builds, as little-endian 128-bit values.
+
+#define HAVE_AESNI 1
+
+#include <cpuid.h>
+#include <wmmintrin.h>
+
+static GBool checkAESNI() {
+  unsigned int a, b, c, d;
+
+  return __get_cpuid(1, &a, &b, &c, &d) && (c & bit_AES);
+}
+
+__attribute__((target("aes,sse2")))
+static inline __m128i aesniDecrypt(__m128i *k, __m128i x) {
+  x = _mm_xor_si128(x, k[10]);
+  for (int round = 9; round >= 1; --round) {
+    x = _mm_aesdec_si128(x, k[round]);
+  }
+  return _mm_aesdeclast_si128(x, k[0]);
+}
+
+__attribute__((target("aes,sse2")))
+static void aesniDecryptCBC(DecryptAESState *s, Guchar *buf, int nBlocks) {
+  __m128i k[11], cbc, c0, c1, c2, c3, p0, p1, p2, p3;
+  int round, i;
+
+  for (round = 0; round <= 10; ++round) {
+    k[round] = _mm_setr_epi32(__builtin_bswap32(s->w[round * 4]),
+			      __builtin_bswap32(s->w[round * 4 + 1]),
+			      __builtin_bswap32(s->w[round * 4 + 2]),
+			      __builtin_bswap32(s->w[round * 4 + 3]));
+  }
+  cbc = _mm_loadu_si128((__m128i *)s->cbc);
+
+  // CBC decryption has no chain between blocks: run four at once
+  for (i = 0; i + 4 <= nBlocks; i += 4, buf += 64) {
+    c0 = _mm_loadu_si128((__m128i *)buf);
+    c1 = _mm_loadu_si128((__m128i *)(buf + 16));
+    c2 = _mm_loadu_si128((__m128i *)(buf + 32));
+    c3 = _mm_loadu_si128((__m128i *)(buf + 48));
+    p0 = _mm_xor_si128(c0, k[10]);
+    p1 = _mm_xor_si128(c1, k[10]);
+    p2 = _mm_xor_si128(c2, k[10]);
+    p3 = _mm_xor_si128(c3, k[10]);
+    for (round = 9; round >= 1; --round) {
+      p0 = _mm_aesdec_si128(p0, k[round]);
+      p1 = _mm_aesdec_si128(p1, k[round]);
+      p2 = _mm_aesdec_si128(p2, k[round]);
+      p3 = _mm_aesdec_si128(p3, k[round]);
+    }
+    p0 = _mm_aesdeclast_si128(p0, k[0]);
+    p1 = _mm_aesdeclast_si128(p1, k[0]);
+    p2 = _mm_aesdeclast_si128(p2, k[0]);
+    p3 = _mm_aesdeclast_si128(p3, k[0]);
+    _mm_storeu_si128((__m128i *)buf, _mm_xor_si128(p0, cbc));
+    _mm_storeu_si128((__m128i *)(buf + 16), _mm_xor_si128(p1, c0));
+    _mm_storeu_si128((__m128i *)(buf + 32), _mm_xor_si128(p2, c1));
+    _mm_storeu_si128((__m128i *)(buf + 48), _mm_xor_si128(p3, c2));
+    cbc = c3;
+  }
+  for (; i < nBlocks; ++i, buf += 16) {
+    c0 = _mm_loadu_si128((__m128i *)buf);
+    _mm_storeu_si128((__m128i *)buf,
+		     _mm_xor_si128(aesniDecrypt(k, c0), cbc));
+    cbc = c0;
+  }
+  _mm_storeu_si128((__m128i *)s->cbc, cbc);
+}
+
+#endif
+
+// Decrypt <nBlocks> whole blocks of <buf> in place, none of which is
+// the last (padded) block of the stream.
+static void aesDecryptCBC(DecryptAESState *s, Guchar *buf, int nBlocks) {
+  Guchar in[16];
+  int i, j;
+
+#ifdef HAVE_AESNI
+  static const GBool aesni = checkAESNI();
+
+  if (aesni) {
+    aesniDecryptCBC(s, buf, nBlocks);
+    return;
+  }
+#endif
+  for (i = 0; i < nBlocks; ++i, buf += 16) {
+    memcpy(in, buf, 16);
+    aesDecryptRaw(s->w, in, buf);
+    for (j = 0; j < 16; ++j) {
+      buf[j] ^= s->cbc[j];
+    }
+    memcpy(s->cbc, in, 16);
+  }
+}
+
 //------------------------------------------------------------------------
 // MD5 message digest
 //------------------------------------------------------------------------
@@ -33,6 +33,21 @@
 #include "Object.h"
 #include "Stream.h"
 
+//------------------------------------------------------------------------
+// DecryptObjKey
+//------------------------------------------------------------------------
+
+// The key of one object, derived from the file key, and the cipher
+// state set up from it.
+struct DecryptObjKey {
+  Guchar key[16];
+  int length;
+  union {
+    Guchar rc4[256];		// RC4 state after the key setup
+    Guint aes[44];		// expanded AES key schedule
+  } sched;
+};
+
 //------------------------------------------------------------------------
 // Decrypt
 //------------------------------------------------------------------------
@@ -41,6 +56,12 @@ class Decrypt {
 public:
   static void md5(Guchar *msg, int msgLen, Guchar *digest);
 
+  // Derive the key of object <objNum, objGen> from the <keyLength>
+  // bytes of <fileKey>.
+  static void makeObjKey(Guchar *fileKey, CryptAlgorithm algo,
+			 int keyLength, int objNum, int objGen,
+			 DecryptObjKey *objKey);
+
   // Generate a file key.  The <fileKey> buffer must have space for at
   // least 16 bytes.  Checks <ownerPassword> and then <userPassword>
   // and returns true if either is correct.  Sets <ownerPasswordOk> if
@@ -74,7 +95,6 @@ struct DecryptRC4State {
 
 struct DecryptAESState {
   Guint w[44];
-  Guchar state[16];
   Guchar cbc[16];
   Guchar buf[16];
   int bufIdx;
@@ -86,6 +106,8 @@ public:
   DecryptStream(Stream *strA, Guchar *fileKey,
 		CryptAlgorithm algoA, int keyLength,
 		int objNum, int objGen);
+  DecryptStream(Stream *strA, DecryptObjKey *objKeyA,
+		CryptAlgorithm algoA);
   virtual ~DecryptStream();
   virtual StreamKind getKind() { return strWeird; }
   virtual void reset();
@@ -97,9 +119,11 @@ public:
 
 private:
 
+  virtual GBool hasGetChars() { return true; }
+  virtual int getChars(int nChars, Guchar *buffer);
+
   CryptAlgorithm algo;
-  int objKeyLength;
-  Guchar objKey[16 + 9];
+  DecryptObjKey objKey;
   int charactersRead; // so that getPos() can be correct
 
   union {
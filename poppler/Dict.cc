@@ -28,7 +28,6 @@
 #pragma implementation
 #endif
 
-#include <algorithm>
 #include <stddef.h>
 #include <string.h>
 #include "gmem.h"
@@ -40,48 +39,39 @@
 // Dict
 //------------------------------------------------------------------------
 
-static const int SORT_LENGTH_LOWER_LIMIT = 32;
-
-static inline bool cmpDictEntries(const DictEntry &e1, const DictEntry &e2)
-{
-  return strcmp(e1.key, e2.key) < 0;
-}
-
-static int binarySearch(const char *key, DictEntry *entries, int length)
-{
-  int first = 0;
-  int end = length - 1;
-  while (first <= end) {
-    const int middle = (first + end) / 2;
-    const int res = strcmp(key, entries[middle].key);
-    if (res == 0) {
-      return middle;
-    } else if (res < 0) {
-      end = middle - 1;
-    } else {
-      first = middle + 1;
-    }
-  }
-  return -1;
-}
+// Dictionaries this long get a hashed index of their keys.
+static const int INDEX_LENGTH_LOWER_LIMIT = 32;
+
+// The index is built by the first lookup, which may come from the
+// prefetch thread on a Dict shared through the xref's object cache.
+// So it is published with a compare-and-swap: a thread that loses the
+// race drops its copy and uses the winner's.
+#if MULTITHREADED
+#  define loadIndex(p)       __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#  define publishIndex(p, x) __sync_bool_compare_and_swap(&(p), \
+					(NameIndex *)NULL, (x))
+#else
+#  define loadIndex(p)       (p)
+#  define publishIndex(p, x) ((p) = (x), gTrue)
+#endif
 
 Dict::Dict(XRef *xrefA) {
   xref = xrefA;
   entries = NULL;
   size = length = 0;
   ref = 1;
-  sorted = gFalse;
+  index = NULL;
 }
 
 Dict::Dict(Dict* dictA) {
   xref = dictA->xref;
   size = length = dictA->length;
   ref = 1;
+  index = NULL;
 
-  sorted = dictA->sorted;
   entries = (DictEntry *)gmallocn(size, sizeof(DictEntry));
   for (int i=0; i<length; i++) {
-    entries[i].key = strdup(dictA->entries[i].key);
+    entries[i].key = dictA->entries[i].key;
     dictA->entries[i].val.copy(&entries[i].val);
   }
 }
@@ -90,19 +80,13 @@ Dict::~Dict() {
   int i;
 
   for (i = 0; i < length; ++i) {
-    gfree(entries[i].key);
     entries[i].val.free();
   }
   gfree(entries);
+  delete index;
 }
 
-void Dict::add(char *key, Object *val) {
-  if (sorted) {
-    // We use add on very few occasions so
-    // virtually this will never be hit
-    sorted = gFalse;
-  }
-
+void Dict::add(const char *key, Object *val) {
   if (length == size) {
     if (length == 0) {
       size = 8;
@@ -111,31 +95,42 @@ void Dict::add(char *key, Object *val) {
     }
     entries = (DictEntry *)greallocn(entries, size, sizeof(DictEntry));
   }
-  entries[length].key = key;
+  entries[length].key = NameTable::intern(key);
   entries[length].val = *val;
+  if (index) {
+    index->add(entries[length].key, length);
+  }
   ++length;
 }
 
 inline DictEntry *Dict::find(const char *key) {
-  if (!sorted && length >= SORT_LENGTH_LOWER_LIMIT)
-  {
-      sorted = gTrue;
-      std::sort(entries, entries+length, cmpDictEntries);
-  }
+  NameIndex *idx;
+  int i;
 
-  if (sorted) {
-    const int pos = binarySearch(key, entries, length);
-    if (pos != -1) {
-      return &entries[pos];
+  // a name that was never interned can't be a key
+  if (!(key = NameTable::lookup(key))) {
+    return NULL;
+  }
+  idx = loadIndex(index);
+  if (!idx && length >= INDEX_LENGTH_LOWER_LIMIT) {
+    // the last of duplicate keys wins, as in the scan below
+    idx = new NameIndex();
+    for (i = 0; i < length; ++i) {
+      idx->add(entries[i].key, i);
     }
-  } else {
-    int i;
-
-    for (i = length - 1; i >=0; --i) {
-      if (!strcmp(key, entries[i].key))
-        return &entries[i];
+    if (!publishIndex(index, idx)) {
+      delete idx;
+      idx = loadIndex(index);
     }
   }
+  if (idx) {
+    i = idx->lookup(key);
+    return i >= 0 ? &entries[i] : (DictEntry *)NULL;
+  }
+  for (i = length - 1; i >=0; --i) {
+    if (key == entries[i].key)
+      return &entries[i];
+  }
   return NULL;
 }
 
@@ -144,33 +139,26 @@ GBool Dict::hasKey(const char *key) {
 }
 
 void Dict::remove(const char *key) {
-  if (sorted) {
-    const int pos = binarySearch(key, entries, length);
-    if (pos != -1) {
-      length -= 1;
-      if (pos != length) {
-        memmove(&entries[pos], &entries[pos + 1], (length - pos) * sizeof(DictEntry));
-      }
-    }
-  } else {
-    int i; 
-    bool found = false;
-    DictEntry tmp;
-    if(length == 0) return;
-
-    for(i=0; i<length; i++) {
-      if (!strcmp(key, entries[i].key)) {
-        found = true;
-        break;
-      }
+  int i;
+  bool found = false;
+
+  if (!(key = NameTable::lookup(key))) {
+    return;
+  }
+  for(i=0; i<length; i++) {
+    if (key == entries[i].key) {
+      found = true;
+      break;
     }
-    if(!found) return;
-    //replace the deleted entry with the last entry
-    length -= 1;
-    tmp = entries[length];
-    if (i!=length) //don't copy the last entry if it is deleted 
-      entries[i] = tmp;
   }
+  if(!found) return;
+  //replace the deleted entry with the last entry
+  length -= 1;
+  if (i!=length) //don't copy the last entry if it is deleted 
+    entries[i] = entries[length];
+  // positions changed; rebuilt on the next lookup
+  delete index;
+  index = NULL;
 }
 
 void Dict::set(const char *key, Object *val) {
@@ -180,7 +168,7 @@ void Dict::set(const char *key, Object *val) {
     e->val.free();
     e->val = *val;
   } else {
-    add (copyString(key), val);
+    add (key, val);
   }
 }
 
@@ -223,7 +211,7 @@ GBool Dict::lookupInt(const char *key, const char *alt_key, int *value)
   return success;
 }
 
-char *Dict::getKey(int i) {
+const char *Dict::getKey(int i) {
   return entries[i].key;
 }
 
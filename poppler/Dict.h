@@ -38,7 +38,7 @@
 //------------------------------------------------------------------------
 
 struct DictEntry {
-  char *key;
+  const char *key;		// interned, see NameTable
   Object val;
 };
 
@@ -52,15 +52,23 @@ public:
   // Destructor.
   ~Dict();
 
-  // Reference counting.
+  // Reference counting.  Objects fetched through the xref are shared
+  // between threads, so the count is atomic.
+#if MULTITHREADED
+  int incRef() { return __sync_add_and_fetch(&ref, 1); }
+  int decRef() { return __sync_sub_and_fetch(&ref, 1); }
+#else
   int incRef() { return ++ref; }
   int decRef() { return --ref; }
+#endif
 
   // Get number of entries.
   int getLength() { return length; }
 
-  // Add an entry.  NB: does not copy key.
-  void add(char *key, Object *val);
+  // Add an entry.  The key is interned, so the caller keeps ownership
+  // of <key>.  add(), set() and remove() are for Dicts no other thread
+  // can see yet; lookups are safe from several threads at once.
+  void add(const char *key, Object *val);
 
   // Update the value of an existing entry, otherwise create it
   void set(const char *key, Object *val);
@@ -77,7 +85,7 @@ public:
   GBool lookupInt(const char *key, const char *alt_key, int *value);
 
   // Iterative accessors.
-  char *getKey(int i);
+  const char *getKey(int i);
   Object *getVal(int i, Object *obj);
   Object *getValNF(int i, Object *obj);
 
@@ -92,12 +100,13 @@ public:
 
 private:
 
-  GBool sorted;
   XRef *xref;			// the xref table for this PDF file
   DictEntry *entries;		// array of entries
   int size;			// size of <entries> array
   int length;			// number of entries in dictionary
   int ref;			// reference count
+  NameIndex *index;		// key -> entry, for long dictionaries;
+				//   built by the first lookup
 
   DictEntry *find(const char *key);
 };
@@ -0,0 +1,70 @@
+//========================================================================
+//
+// FileCachedFile.cc
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#include "FileCachedFile.h"
+#include "GooString.h"
+#include "Error.h"
+
+#include <errno.h>
+#include <string.h>
+
+//------------------------------------------------------------------------
+// FileCachedFileLoader
+//------------------------------------------------------------------------
+
+FileCachedFileLoader::FileCachedFileLoader()
+{
+  file = NULL;
+}
+
+FileCachedFileLoader::~FileCachedFileLoader()
+{
+  if (file) {
+    fclose(file);
+  }
+}
+
+size_t FileCachedFileLoader::init(GooString *uri, CachedFile *cachedFile)
+{
+  if (!(file = fopen(uri->getCString(), "rb"))) {
+    error(-1, "Couldn't open file '%s': %s.", uri->getCString(), strerror(errno));
+    return 0;
+  }
+  if (fseeko(file, 0, SEEK_END) != 0) {
+    return 0;
+  }
+  return (size_t)ftello(file);
+}
+
+int FileCachedFileLoader::load(const std::vector<ByteRange> &ranges, CachedFileWriter *writer)
+{
+  char buf[CachedFileChunkSize];
+  size_t toRead, n;
+
+  if (!file) {
+    return -1;
+  }
+  for (size_t i = 0; i < ranges.size(); i++) {
+    if (fseeko(file, ranges[i].offset, SEEK_SET) != 0) {
+      return -1;
+    }
+    toRead = ranges[i].length;
+    while (toRead) {
+      n = toRead < sizeof(buf) ? toRead : sizeof(buf);
+      if (fread(buf, 1, n, file) != n) {
+        error(-1, "Short read in cached file");
+        return -1;
+      }
+      writer->write(buf, n);
+      toRead -= n;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+//========================================================================
+//
+// FileCachedFile.h
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef FILECACHEDFILE_H
+#define FILECACHEDFILE_H
+
+#include "CachedFile.h"
+
+#include <stdio.h>
+
+//------------------------------------------------------------------------
+// FileCachedFileLoader
+//
+// Loads a CachedFile from a local file; the uri is its path.
+//------------------------------------------------------------------------
+
+class FileCachedFileLoader : public CachedFileLoader {
+
+public:
+
+  FileCachedFileLoader();
+  ~FileCachedFileLoader();
+  size_t init(GooString *uri, CachedFile *cachedFile);
+  int load(const std::vector<ByteRange> &ranges, CachedFileWriter *writer);
+
+private:
+
+  FILE *file;
+
+};
+
+#endif
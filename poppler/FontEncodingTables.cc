@@ -268,6 +268,39 @@ const char *macRomanEncoding[256] = {
   "caron"
 };
 
+// MacRomanEncoding codes by name, in the order of a perfect hash over
+// the names (see PerfectHash.h); a name encoded twice ('space') gets
+// its lowest code.
+const Guchar macRomanReverseTab[macRomanReverseSize] = {
+  84, 203, 233, 204, 169, 56, 190, 245, 40, 87, 35, 239,
+  200, 128, 172, 167, 113, 82, 205, 157, 117, 114, 185, 120,
+  171, 58, 211, 66, 138, 132, 145, 156, 134, 154, 236, 73,
+  102, 46, 88, 106, 144, 92, 44, 244, 143, 252, 160, 184,
+  91, 254, 137, 109, 253, 221, 34, 52, 151, 188, 59, 130,
+  165, 240, 118, 124, 129, 152, 125, 67, 155, 69, 168, 170,
+  175, 39, 74, 57, 76, 216, 78, 53, 191, 192, 218, 96,
+  213, 181, 177, 32, 197, 83, 48, 220, 153, 136, 166, 222,
+  164, 97, 207, 85, 133, 228, 107, 103, 70, 112, 193, 131,
+  246, 161, 77, 116, 187, 36, 49, 54, 60, 250, 135, 183,
+  51, 86, 139, 149, 45, 89, 42, 141, 247, 241, 214, 43,
+  126, 80, 186, 243, 115, 232, 55, 255, 101, 41, 81, 225,
+  75, 63, 68, 64, 249, 38, 179, 62, 71, 195, 100, 93,
+  201, 199, 150, 163, 242, 230, 189, 224, 90, 122, 198, 158,
+  217, 65, 174, 238, 79, 95, 159, 72, 182, 61, 209, 219,
+  123, 231, 229, 98, 37, 180, 194, 142, 162, 235, 176, 33,
+  119, 140, 196, 146, 47, 206, 104, 173, 99, 110, 215, 237,
+  227, 121, 208, 234, 94, 147, 148, 226, 212, 111, 251, 105,
+  248, 210, 108, 223, 50, 178
+};
+
+const Gushort macRomanReverseDisp[macRomanReverseBuckets] = {
+  0, 2, 0, 0, 28, 0, 58, 9, 16, 179, 775, 516,
+  0, 3, 102, 2, 1, 2, 1501, 24, 8, 5, 441, 7,
+  10, 489, 36, 36, 40, 2, 0, 1, 18, 1323, 987, 691,
+  37, 1, 365, 71, 1, 0, 1, 10, 155, 399, 635, 988,
+  21, 148, 1213, 544, 3652, 13, 393, 11633
+};
+
 const char *macExpertEncoding[256] = {
   NULL,
   NULL,
@@ -9,6 +9,8 @@
 #ifndef FONTENCODINGTABLES_H
 #define FONTENCODINGTABLES_H
 
+#include "gtypes.h"
+
 extern const char *macRomanEncoding[];
 extern const char *macExpertEncoding[];
 extern const char *winAnsiEncoding[];
@@ -17,4 +19,10 @@ extern const char *expertEncoding[];
 extern const char *symbolEncoding[];
 extern const char *zapfDingbatsEncoding[];
 
+// MacRomanEncoding codes by name (see PerfectHash.h)
+#define macRomanReverseSize    222
+#define macRomanReverseBuckets 56
+extern const Guchar macRomanReverseTab[macRomanReverseSize];
+extern const Gushort macRomanReverseDisp[macRomanReverseBuckets];
+
 #endif
@@ -1089,6 +1089,19 @@ class PostScriptFunctionKey : public PopplerCacheKey
         return false;
       }
     }
+
+    unsigned int hash() const
+    {
+      unsigned int h = size;
+      for (int i = 0; i < size; ++i) {
+        // adding 0 turns -0 into 0, which compare equal
+        double x = in[i] + 0.0;
+        unsigned long long bits;
+        memcpy(&bits, &x, sizeof(bits));
+        h = h * 31 + (unsigned int)(bits ^ (bits >> 32));
+      }
+      return h;
+    }
   
     bool copied;
     int size;
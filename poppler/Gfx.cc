@@ -51,6 +51,9 @@
 #include "gmem.h"
 #include "gtypes.h"
 #include "GooHash.h"
+#include "GooLikely.h"
+#include "GooString.h"
+#include "GooTimer.h"
 #include "Object.h"
 #include "Array.h"
 #include "Dict.h"
@@ -61,6 +64,7 @@
 #include "GfxState.h"
 #include "OutputDev.h"
 #include "Page.h"
+#include "ProfileData.h"
 #include "Error.h"
 #include "Gfx.h"
 #include "Catalog.h"
@@ -303,11 +307,13 @@ static inline GBool isSameGfxColor(const GfxColor &colorA, const GfxColor &color
 // GfxResources
 //------------------------------------------------------------------------
 
-GfxResources::GfxResources(XRef *xref, Dict *resDict, GfxResources *nextA) :
-    gStateCache(2, xref) {
+GfxResources::GfxResources(XRef *xrefA, Dict *resDict, GfxResources *nextA) :
+    gStateCache(2, xrefA) {
   Object obj1, obj2;
   Ref r;
+  int i;
 
+  xref = xrefA;
   if (resDict) {
 
     // build font dictionary
@@ -353,10 +359,17 @@ GfxResources::GfxResources(XRef *xref, Dict *resDict, GfxResources *nextA) :
     propertiesDict.initNull();
   }
 
+  for (i = 0; i < numKinds; ++i) {
+    resolvedIndex[i][0] = resolvedIndex[i][1] = NULL;
+  }
+  resolved = NULL;
+  resolvedLen = resolvedSize = 0;
   next = nextA;
 }
 
 GfxResources::~GfxResources() {
+  int i;
+
   if (fonts) {
     delete fonts;
   }
@@ -366,6 +379,81 @@ GfxResources::~GfxResources() {
   shadingDict.free();
   gStateDict.free();
   propertiesDict.free();
+  for (i = 0; i < numKinds; ++i) {
+    delete resolvedIndex[i][0];
+    delete resolvedIndex[i][1];
+  }
+  for (i = 0; i < resolvedLen; ++i) {
+    resolved[i].free();
+  }
+  gfree(resolved);
+}
+
+Object *GfxResources::getKindDict(int kind) {
+  switch (kind) {
+  case kindXObject:
+    return &xObjDict;
+  case kindColorSpace:
+    return &colorSpaceDict;
+  case kindGState:
+    return &gStateDict;
+  case kindProperties:
+  default:
+    return &propertiesDict;
+  }
+}
+
+// Look <name> up in the <kind> dictionaries of this and the enclosing
+// resources, and return its unfetched value, or NULL. A dict only
+// stops the search if its value for <name> is not null -- after
+// fetching it if <fetched> is set, so a reference to a missing object
+// falls through to the enclosing resources then. Hits are kept, so a
+// page that uses a name many times resolves it once.
+Object *GfxResources::resolve(int kind, const char *name, GBool fetched) {
+  NameIndex **index;
+  Object obj, obj2, *val;
+  GBool found;
+  int i;
+
+  // a name that was never interned can't be a key
+  if (!(name = NameTable::lookup(name))) {
+    return NULL;
+  }
+  index = &resolvedIndex[kind][fetched ? 1 : 0];
+  if (*index && (i = (*index)->lookup(name)) >= 0) {
+    return &resolved[i];
+  }
+  found = gFalse;
+  if (getKindDict(kind)->isDict()) {
+    if (fetched) {
+      found = !getKindDict(kind)->dictLookup(name, &obj2)->isNull();
+      obj2.free();
+      if (found) {
+	getKindDict(kind)->dictLookupNF(name, &obj);
+      }
+    } else {
+      found = !getKindDict(kind)->dictLookupNF(name, &obj)->isNull();
+      if (!found) {
+	obj.free();
+      }
+    }
+  }
+  if (!found) {
+    if (!next || !(val = next->resolve(kind, name, fetched))) {
+      return NULL;
+    }
+    val->copy(&obj);
+  }
+  if (resolvedLen == resolvedSize) {
+    resolvedSize = resolvedSize ? 2 * resolvedSize : 16;
+    resolved = (Object *)greallocn(resolved, resolvedSize, sizeof(Object));
+  }
+  if (!*index) {
+    *index = new NameIndex();
+  }
+  (*index)->add(name, resolvedLen);
+  resolved[resolvedLen] = obj;
+  return &resolved[resolvedLen++];
 }
 
 GfxFont *GfxResources::lookupFont(const char *name) {
@@ -383,59 +471,50 @@ GfxFont *GfxResources::lookupFont(const char *name) {
 }
 
 GBool GfxResources::lookupXObject(const char *name, Object *obj) {
-  GfxResources *resPtr;
+  Object *val;
 
-  for (resPtr = this; resPtr; resPtr = resPtr->next) {
-    if (resPtr->xObjDict.isDict()) {
-      if (!resPtr->xObjDict.dictLookup(name, obj)->isNull())
-	return gTrue;
-      obj->free();
-    }
+  if ((val = resolve(kindXObject, name, gTrue))) {
+    if (!val->fetch(xref, obj)->isNull())
+      return gTrue;
+    obj->free();
   }
   error(-1, "XObject '%s' is unknown", name);
+  obj->initNull();
   return gFalse;
 }
 
 GBool GfxResources::lookupXObjectNF(const char *name, Object *obj) {
-  GfxResources *resPtr;
+  Object *val;
 
-  for (resPtr = this; resPtr; resPtr = resPtr->next) {
-    if (resPtr->xObjDict.isDict()) {
-      if (!resPtr->xObjDict.dictLookupNF(name, obj)->isNull())
-	return gTrue;
-      obj->free();
-    }
+  if ((val = resolve(kindXObject, name, gFalse))) {
+    val->copy(obj);
+    return gTrue;
   }
   error(-1, "XObject '%s' is unknown", name);
+  obj->initNull();
   return gFalse;
 }
 
 GBool GfxResources::lookupMarkedContentNF(const char *name, Object *obj) {
-  GfxResources *resPtr;
+  Object *val;
 
-  for (resPtr = this; resPtr; resPtr = resPtr->next) {
-    if (resPtr->propertiesDict.isDict()) {
-      if (!resPtr->propertiesDict.dictLookupNF(name, obj)->isNull())
-	return gTrue;
-      obj->free();
-    }
+  if ((val = resolve(kindProperties, name, gFalse))) {
+    val->copy(obj);
+    return gTrue;
   }
   error(-1, "Marked Content '%s' is unknown", name);
+  obj->initNull();
   return gFalse;
 }
 
 void GfxResources::lookupColorSpace(const char *name, Object *obj) {
-  GfxResources *resPtr;
+  Object *val;
 
-  for (resPtr = this; resPtr; resPtr = resPtr->next) {
-    if (resPtr->colorSpaceDict.isDict()) {
-      if (!resPtr->colorSpaceDict.dictLookup(name, obj)->isNull()) {
-	return;
-      }
-      obj->free();
-    }
+  if ((val = resolve(kindColorSpace, name, gTrue))) {
+    val->fetch(xref, obj);
+  } else {
+    obj->initNull();
   }
-  obj->initNull();
 }
 
 GfxPattern *GfxResources::lookupPattern(const char *name, Gfx *gfx) {
@@ -493,17 +572,14 @@ GBool GfxResources::lookupGState(const char *name, Object *obj) {
 }
 
 GBool GfxResources::lookupGStateNF(const char *name, Object *obj) {
-  GfxResources *resPtr;
+  Object *val;
 
-  for (resPtr = this; resPtr; resPtr = resPtr->next) {
-    if (resPtr->gStateDict.isDict()) {
-      if (!resPtr->gStateDict.dictLookupNF(name, obj)->isNull()) {
-	return gTrue;
-      }
-      obj->free();
-    }
+  if ((val = resolve(kindGState, name, gFalse))) {
+    val->copy(obj);
+    return gTrue;
   }
   error(-1, "ExtGState '%s' is unknown", name);
+  obj->initNull();
   return gFalse;
 }
 
@@ -547,6 +623,7 @@ Gfx::Gfx(XRef *xrefA, OutputDev *outA, int pageNum, Dict *resDict, Catalog *cata
     baseMatrix[i] = state->getCTM()[i];
   }
   formDepth = 0;
+  profileNestedTime = 0;
   abortCheckCbk = abortCheckCbkA;
   abortCheckCbkData = abortCheckCbkDataA;
 
@@ -595,6 +672,7 @@ Gfx::Gfx(XRef *xrefA, OutputDev *outA, Dict *resDict, Catalog *catalogA,
     baseMatrix[i] = state->getCTM()[i];
   }
   formDepth = 0;
+  profileNestedTime = 0;
   abortCheckCbk = abortCheckCbkA;
   abortCheckCbkData = abortCheckCbkDataA;
 
@@ -663,8 +741,10 @@ void Gfx::go(GBool topLevel) {
   Object args[maxArgs];
   int numArgs, i;
   int lastAbortCheck;
+  GooHash *profile;
 
   // scan a sequence of objects
+  profile = out->getProfileHash();
   pushStateGuard();
   updateLevel = lastAbortCheck = 0;
   numArgs = 0;
@@ -685,7 +765,11 @@ void Gfx::go(GBool topLevel) {
       }
 
       // Run the operation
-      execOp(&obj, args, numArgs);
+      if (unlikely(profile != NULL)) {
+	profileOp(profile, &obj, args, numArgs);
+      } else {
+	execOp(&obj, args, numArgs);
+      }
 
       obj.free();
       for (i = 0; i < numArgs; ++i)
@@ -695,7 +779,7 @@ void Gfx::go(GBool topLevel) {
       // periodically update display
       if (++updateLevel >= 20000) {
 	out->dump();
-	updateLevel = 0;
+	updateLevel = lastAbortCheck = 0;
       }
 
       // did the command throw an exception
@@ -761,6 +845,28 @@ void Gfx::go(GBool topLevel) {
   }
 }
 
+// Run an operator and charge it to the profile. Operators nested in it
+// (form XObjects, Type 3 glyphs) run through here as well; their time is
+// collected in profileNestedTime and left out of the outer one's self time.
+void Gfx::profileOp(GooHash *profile, Object *cmd, Object args[],
+		    int numArgs) {
+  GooTimer timer;
+  ProfileData *data;
+  double outerNestedTime, elapsed;
+
+  outerNestedTime = profileNestedTime;
+  profileNestedTime = 0;
+  timer.start();
+  execOp(cmd, args, numArgs);
+  elapsed = timer.getElapsed();
+  if (!(data = (ProfileData *)profile->lookup(cmd->getCmd()))) {
+    data = new ProfileData();
+    profile->add(new GooString(cmd->getCmd()), data);
+  }
+  data->addElement(elapsed, elapsed - profileNestedTime);
+  profileNestedTime = outerNestedTime + elapsed;
+}
+
 void Gfx::execOp(Object *cmd, Object args[], int numArgs) {
   Operator *op;
   const char *name;
@@ -4538,7 +4644,7 @@ void Gfx::opBeginImage(Object args[], int numArgs) {
 Stream *Gfx::buildImageStream() {
   Object dict;
   Object obj;
-  char *key;
+  const char *key;
   Stream *str;
 
   // build dictionary
@@ -4549,11 +4655,10 @@ Stream *Gfx::buildImageStream() {
       error(getPos(), "Inline image dictionary key must be a name object");
       obj.free();
     } else {
-      key = copyString(obj.getName());
+      key = obj.getName();
       obj.free();
       parser->getObj(&obj);
       if (obj.isEOF() || obj.isError()) {
-	gfree(key);
 	break;
       }
       dict.dictAdd(key, &obj);
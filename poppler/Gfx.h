@@ -43,6 +43,7 @@
 #include <vector>
 
 class GooString;
+class GooHash;
 class XRef;
 class Array;
 class Stream;
@@ -121,6 +122,19 @@ public:
 
 private:
 
+  // resource categories with a resolved-name cache
+  enum Kind {
+    kindXObject,
+    kindColorSpace,
+    kindGState,
+    kindProperties,
+    numKinds
+  };
+
+  Object *getKindDict(int kind);
+  Object *resolve(int kind, const char *name, GBool fetched);
+
+  XRef *xref;
   GfxFontDict *fonts;
   Object xObjDict;
   Object colorSpaceDict;
@@ -129,6 +143,11 @@ private:
   Object gStateDict;
   PopplerObjectCache gStateCache;
   Object propertiesDict;
+  NameIndex *resolvedIndex[numKinds][2]; // [kind][fetched]: name ->
+					 //   index in resolved
+  Object *resolved;		// unfetched values of names found in
+				//   this or an enclosing resource dict
+  int resolvedLen, resolvedSize;
   GfxResources *next;
 };
 
@@ -198,6 +217,8 @@ private:
   double baseMatrix[6];		// default matrix for most recent
 				//   page/form/pattern
   int formDepth;
+  double profileNestedTime;	// time spent in operators nested in the
+				//   one being profiled
 
   MarkedContentStack *mcStack;	// current BMC/EMC stack
 
@@ -211,6 +232,7 @@ private:
 
   void go(GBool topLevel);
   void execOp(Object *cmd, Object args[], int numArgs);
+  void profileOp(GooHash *profile, Object *cmd, Object args[], int numArgs);
   Operator *findOp(const char *name);
   GBool checkArg(Object *arg, TchkType type);
   int getPos();
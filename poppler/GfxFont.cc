@@ -128,6 +128,7 @@ static int parseCharName(const char *charName, Unicode *uBuf, int uLen,
 //------------------------------------------------------------------------
 
 GfxFont *GfxFont::makeFont(XRef *xref, const char *tagA, Ref idA, Dict *fontDict) {
+  GMemScope memScope(gMemTagFonts);
   GooString *nameA;
   GfxFont *font;
   Object obj1;
@@ -2047,46 +2048,29 @@ double GfxCIDFont::getWidth (char* s, int len) {
 // GfxFontDict
 //------------------------------------------------------------------------
 
-GfxFontDict::GfxFontDict(XRef *xref, Ref *fontDictRef, Dict *fontDict) {
+GfxFontDict::GfxFontDict(XRef *xrefA, Ref *fontDictRef, Dict *fontDictA) {
   int i;
-  Object obj1, obj2;
-  Ref r;
 
-  numFonts = fontDict->getLength();
+  xref = xrefA;
+  fontDict.initDict(fontDictA);
+  if (fontDictRef) {
+    dictRef = *fontDictRef;
+  } else {
+    dictRef.num = -1;
+    dictRef.gen = 0;
+  }
+  numFonts = fontDictA->getLength();
   fonts = (GfxFont **)gmallocn(numFonts, sizeof(GfxFont *));
-  for (i = 0; i < numFonts; ++i) {
-    fontDict->getValNF(i, &obj1);
-    obj1.fetch(xref, &obj2);
-    if (obj2.isDict()) {
-      if (obj1.isRef()) {
-	r = obj1.getRef();
-      } else {
-	// no indirect reference for this font, so invent a unique one
-	// (legal generation numbers are five digits, so any 6-digit
-	// number would be safe)
-	r.num = i;
-	if (fontDictRef) {
-	  r.gen = 100000 + fontDictRef->num;
-	} else {
-	  r.gen = 999999;
-	}
-      }
-      fonts[i] = GfxFont::makeFont(xref, fontDict->getKey(i),
-				   r, obj2.getDict());
-      if (fonts[i] && !fonts[i]->isOk()) {
-	// XXX: it may be meaningful to distinguish between
-	// NULL and !isOk() so that when we do lookups
-	// we can tell the difference between a missing font
-	// and a font that is just !isOk()
-	fonts[i]->decRefCnt();
-	fonts[i] = NULL;
-      }
-    } else {
-      error(-1, "font resource is not a dictionary");
-      fonts[i] = NULL;
-    }
-    obj1.free();
-    obj2.free();
+  loaded = (char *)gmallocn(numFonts, sizeof(char));
+  nextSameTag = (int *)gmallocn(numFonts, sizeof(int));
+  tags = new NameIndex();
+  // the index holds the first font with each tag, and the others follow
+  // in dict order
+  for (i = numFonts - 1; i >= 0; --i) {
+    fonts[i] = NULL;
+    loaded[i] = 0;
+    nextSameTag[i] = tags->lookup(fontDictA->getKey(i));
+    tags->add(fontDictA->getKey(i), i);
   }
 }
 
@@ -2099,14 +2083,65 @@ GfxFontDict::~GfxFontDict() {
     }
   }
   gfree(fonts);
+  gfree(loaded);
+  gfree(nextSameTag);
+  delete tags;
+  fontDict.free();
+}
+
+GfxFont *GfxFontDict::load(int i) {
+  GMemScope memScope(gMemTagFonts);
+  Object obj1, obj2;
+  Ref r;
+
+  loaded[i] = 1;
+  fontDict.dictGetValNF(i, &obj1);
+  obj1.fetch(xref, &obj2);
+  if (obj2.isDict()) {
+    if (obj1.isRef()) {
+      r = obj1.getRef();
+    } else {
+      // no indirect reference for this font, so invent a unique one
+      // (legal generation numbers are five digits, so any 6-digit
+      // number would be safe)
+      r.num = i;
+      if (dictRef.num >= 0) {
+	r.gen = 100000 + dictRef.num;
+      } else {
+	r.gen = 999999;
+      }
+    }
+    fonts[i] = GfxFont::makeFont(xref, fontDict.dictGetKey(i),
+				 r, obj2.getDict());
+    if (fonts[i] && !fonts[i]->isOk()) {
+      // XXX: it may be meaningful to distinguish between
+      // NULL and !isOk() so that when we do lookups
+      // we can tell the difference between a missing font
+      // and a font that is just !isOk()
+      fonts[i]->decRefCnt();
+      fonts[i] = NULL;
+    }
+  } else {
+    error(-1, "font resource is not a dictionary");
+    fonts[i] = NULL;
+  }
+  obj1.free();
+  obj2.free();
+  return fonts[i];
 }
 
 GfxFont *GfxFontDict::lookup(const char *tag) {
+  GfxFont *font;
   int i;
 
-  for (i = 0; i < numFonts; ++i) {
-    if (fonts[i] && fonts[i]->matches(tag)) {
-      return fonts[i];
+  if (!(tag = NameTable::lookup(tag))) {
+    return NULL;
+  }
+  // a font that failed to load is skipped, as the linear search did, so
+  // a later font with the same tag is used instead
+  for (i = tags->lookup(tag); i >= 0; i = nextSameTag[i]) {
+    if ((font = getFont(i))) {
+      return font;
     }
   }
   return NULL;
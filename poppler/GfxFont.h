@@ -363,8 +363,9 @@ private:
 class GfxFontDict {
 public:
 
-  // Build the font dictionary, given the PDF font dictionary.
-  GfxFontDict(XRef *xref, Ref *fontDictRef, Dict *fontDict);
+  // Build the font dictionary, given the PDF font dictionary.  Fonts
+  // are loaded when they are first looked up.
+  GfxFontDict(XRef *xrefA, Ref *fontDictRef, Dict *fontDictA);
 
   // Destructor.
   ~GfxFontDict();
@@ -374,12 +375,21 @@ public:
 
   // Iterative access.
   int getNumFonts() { return numFonts; }
-  GfxFont *getFont(int i) { return fonts[i]; }
+  GfxFont *getFont(int i) { return loaded[i] ? fonts[i] : load(i); }
 
 private:
 
+  GfxFont *load(int i);
+
+  XRef *xref;
+  Object fontDict;		// the PDF font dictionary
+  Ref dictRef;			// its reference, or num = -1
   GfxFont **fonts;		// list of fonts
+  char *loaded;			// set once fonts[i] has been loaded
   int numFonts;			// number of fonts
+  NameIndex *tags;		// font tag -> index of the first font
+  int *nextSameTag;		// index of the next font with the same
+				//   tag, or -1
 };
 
 #endif
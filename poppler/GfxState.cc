@@ -935,6 +935,11 @@ class GfxICCBasedColorSpaceKey : public PopplerCacheKey
       const GfxICCBasedColorSpaceKey *k = static_cast<const GfxICCBasedColorSpaceKey*>(&key);
       return k->num == num && k->gen == gen;
     }
+
+    unsigned int hash() const
+    {
+      return (unsigned int)num * 0x9e3779b1u + (unsigned int)gen;
+    }
     
     int num, gen;
 };
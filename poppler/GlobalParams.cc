@@ -38,6 +38,9 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "gmem.h"
 #include "GooString.h"
 #include "GooList.h"
@@ -45,10 +48,11 @@
 #include "gfile.h"
 #include "Error.h"
 #include "NameToCharCode.h"
+#include "PerfectHash.h"
 #include "NameToUnicodeTable.h"
 #include "CharCodeToUnicode.h"
 #include "CMap.h"
-#include "BuiltinFontTables.h"
+#include "CompiledData.h"
 #include "FontEncodingTables.h"
 #include "GlobalParams.h"
 #include "GfxFont.h"
@@ -77,6 +81,7 @@
 #define unicodeToUnicodeCacheSize 4
 
 #define POPPLER_DATADIR "poppler-data"
+#define COMPILED_DATADIR "compiled"
 
 //------------------------------------------------------------------------
 
@@ -88,25 +93,15 @@ GlobalParams *globalParams = NULL;
 
 GlobalParams::GlobalParams(const char *baseDir)
 {
-  int i;
-
 #if MULTITHREADED
   gInitMutex(&mutex);
   gInitMutex(&unicodeMapCacheMutex);
   gInitMutex(&cMapCacheMutex);
 #endif
 
-  initBuiltinFontTables();
-
-  // scan the encoding in reverse because we want the lowest-numbered
-  // index for each char name ('space' is encoded twice)
-  macRomanReverseMap = new NameToCharCode();
-  for (i = 255; i >= 0; --i) {
-    if (macRomanEncoding[i]) {
-      macRomanReverseMap->add(macRomanEncoding[i], (CharCode)i);
-    }
-  }
-
+  // the built-in nameToUnicodeTab and the MacRoman reverse map are
+  // static perfect hash tables; this only holds the entries from
+  // poppler-data
   nameToUnicode = new NameToCharCode();
   cidToUnicodes = new GooHash(gTrue);
   unicodeToUnicodes = new GooHash(gTrue);
@@ -121,13 +116,9 @@ GlobalParams::GlobalParams(const char *baseDir)
       new CharCodeToUnicodeCache(unicodeToUnicodeCacheSize);
   cMapCache = new CMapCache();
 
-  // set up the initial nameToUnicode table
-  for (i = 0; nameToUnicodeTab[i].name; ++i) {
-    nameToUnicode->add(nameToUnicodeTab[i].name, nameToUnicodeTab[i].u);
-  }
-
 	popplerDataDir = new GooString(baseDir);
 	appendToPath(popplerDataDir, POPPLER_DATADIR);
+	compiledDataDir = appendToPath(popplerDataDir->copy(), COMPILED_DATADIR);
 	scanEncodingDirs();
 }
 
@@ -219,11 +210,27 @@ void GlobalParams::addCMapDir(GooString *collection, GooString *dir) {
   list->append(dir->copy());
 }
 
-GlobalParams::~GlobalParams() {
-  freeBuiltinFontTables();
+// Return the name of the compiled form of a data file: <kind> is
+// "cMap" or "cidToUnicode", <name> the CMap name or NULL.  The
+// compiled data directory mirrors poppler-data.  Call with the lock
+// held.
+GooString *GlobalParams::makeCompiledFileName(const char *kind,
+					      GooString *collection,
+					      GooString *name) {
+  GooString *fileName;
 
-  delete macRomanReverseMap;
+  if (!compiledDataDir) {
+    return NULL;
+  }
+  fileName = appendToPath(compiledDataDir->copy(), kind);
+  appendToPath(fileName, collection->getCString());
+  if (name) {
+    appendToPath(fileName, name->getCString());
+  }
+  return fileName;
+}
 
+GlobalParams::~GlobalParams() {
   delete nameToUnicode;
   deleteGooHash(cidToUnicodes, GooString);
   deleteGooHash(unicodeToUnicodes, GooString);
@@ -243,6 +250,9 @@ GlobalParams::~GlobalParams() {
   delete cMapCache;
 	
 	delete popplerDataDir;
+	if (compiledDataDir) {
+		delete compiledDataDir;
+	}
 
 #if MULTITHREADED
   gDestroyMutex(&mutex);
@@ -257,20 +267,47 @@ GlobalParams::~GlobalParams() {
 //------------------------------------------------------------------------
 
 CharCode GlobalParams::getMacRomanCharCode(const char *charName) {
-  // no need to lock - macRomanReverseMap is constant
-  return macRomanReverseMap->lookup(charName);
+  CharCode c;
+
+  c = macRomanReverseTab[perfectHashSlot(charName, macRomanReverseDisp,
+					 macRomanReverseBuckets,
+					 macRomanReverseSize)];
+  return strcmp(macRomanEncoding[c], charName) ? 0 : c;
 }
 
 Unicode GlobalParams::mapNameToUnicode(const char *charName) {
-  // no need to lock - nameToUnicode is constant
-  return nameToUnicode->lookup(charName);
+  Unicode u;
+  int i;
+
+  // no need to lock - nameToUnicode is constant; its entries override
+  // the built-in ones
+  if (nameToUnicode->getLength() > 0 &&
+      (u = nameToUnicode->lookup(charName))) {
+    return u;
+  }
+  i = perfectHashSlot(charName, nameToUnicodeDisp, nameToUnicodeBuckets,
+		      nameToUnicodeTabSize);
+  return strcmp(nameToUnicodeTab[i].name, charName) ? 0
+                                                    : nameToUnicodeTab[i].u;
 }
 
 FILE *GlobalParams::findCMapFile(GooString *collection, GooString *cMapName) {
+  GooString *fileName;
+  FILE *f;
+
+  if (!(fileName = findCMapFileName(collection, cMapName))) {
+    return NULL;
+  }
+  f = fopen(fileName->getCString(), "r");
+  delete fileName;
+  return f;
+}
+
+GooString *GlobalParams::findCMapFileName(GooString *collection,
+					  GooString *cMapName) {
   GooList *list;
   GooString *dir;
   GooString *fileName;
-  FILE *f;
   int i;
 
   lockGlobalParams;
@@ -281,17 +318,26 @@ FILE *GlobalParams::findCMapFile(GooString *collection, GooString *cMapName) {
   for (i = 0; i < list->getLength(); ++i) {
     dir = (GooString *)list->get(i);
     fileName = appendToPath(dir->copy(), cMapName->getCString());
-    f = fopen(fileName->getCString(), "r");
-    delete fileName;
-    if (f) {
+    if (access(fileName->getCString(), R_OK) == 0) {
       unlockGlobalParams;
-      return f;
+      return fileName;
     }
+    delete fileName;
   }
   unlockGlobalParams;
   return NULL;
 }
 
+GooString *GlobalParams::getCompiledCMapFileName(GooString *collection,
+						 GooString *cMapName) {
+  GooString *fileName;
+
+  lockGlobalParams;
+  fileName = makeCompiledFileName("cMap", collection, cMapName);
+  unlockGlobalParams;
+  return fileName;
+}
+
 FILE *GlobalParams::findToUnicodeFile(GooString *name) {
   GooString *dir, *fileName;
   FILE *f;
@@ -340,13 +386,22 @@ GBool GlobalParams::getMapUnknownCharNames() {
 }
 
 CharCodeToUnicode *GlobalParams::getCIDToUnicode(GooString *collection) {
-  GooString *fileName;
+  GooString *fileName, *compiledFileName;
   CharCodeToUnicode *ctu;
 
   lockGlobalParams;
-  if (!(ctu = cidToUnicodeCache->getCharCodeToUnicode(collection))) {
-    if ((fileName = (GooString *)cidToUnicodes->lookup(collection)) &&
-	(ctu = CharCodeToUnicode::parseCIDToUnicode(fileName, collection))) {
+  if (!(ctu = cidToUnicodeCache->getCharCodeToUnicode(collection)) &&
+      (fileName = (GooString *)cidToUnicodes->lookup(collection))) {
+    if ((compiledFileName = makeCompiledFileName("cidToUnicode", collection,
+						 NULL))) {
+      ctu = CharCodeToUnicode::readCompiledCIDToUnicode(compiledFileName,
+							fileName, collection);
+      delete compiledFileName;
+    }
+    if (!ctu) {
+      ctu = CharCodeToUnicode::parseCIDToUnicode(fileName, collection);
+    }
+    if (ctu) {
       cidToUnicodeCache->add(ctu);
     }
   }
@@ -410,3 +465,118 @@ void GlobalParams::setMapUnknownCharNames(GBool map) {
   mapUnknownCharNames = map;
   unlockGlobalParams;
 }
+
+void GlobalParams::setCompiledDataDir(const char *dir) {
+  lockGlobalParams;
+  if (compiledDataDir) {
+    delete compiledDataDir;
+  }
+  compiledDataDir = dir ? new GooString(dir) : (GooString *)NULL;
+  unlockGlobalParams;
+}
+
+//------------------------------------------------------------------------
+// compiled data
+//------------------------------------------------------------------------
+
+// Create the directories leading to <fileName>.
+static GBool makeParentDirs(GooString *fileName) {
+  GooString *dir;
+  int i;
+
+  for (i = 1; i < fileName->getLength(); ++i) {
+    if (fileName->getChar(i) == '/') {
+      dir = new GooString(fileName->getCString(), i);
+      if (mkdir(dir->getCString(), 0755) != 0 && errno != EEXIST) {
+	error(-1, "Couldn't create directory '%s'", dir->getCString());
+	delete dir;
+	return gFalse;
+      }
+      delete dir;
+    }
+  }
+  return gTrue;
+}
+
+// Returns true if <fileName> is an up-to-date compiled form of
+// <srcFileName>.
+static GBool isCompiledFileCurrent(GooString *fileName, Guint magic,
+				   GooString *srcFileName) {
+  void *data;
+  size_t len;
+
+  if (!(data = mapCompiledData(fileName->getCString(), magic,
+			       srcFileName->getCString(), &len))) {
+    return gFalse;
+  }
+  unmapCompiledData(data, len);
+  return gTrue;
+}
+
+GBool GlobalParams::compileEncodingData() {
+  GooHashIter *iter;
+  GooString *collection, *srcFileName, *fileName;
+  GooList *list;
+  CMapCache *cache;
+  GDir *dir;
+  GDirEntry *entry;
+  void *val;
+  GBool ok;
+  int i;
+
+  // cMapDirs and cidToUnicodes don't change after the constructor
+  ok = gTrue;
+  cidToUnicodes->startIter(&iter);
+  while (cidToUnicodes->getNext(&iter, &collection, &val)) {
+    srcFileName = (GooString *)val;
+    lockGlobalParams;
+    fileName = makeCompiledFileName("cidToUnicode", collection, NULL);
+    unlockGlobalParams;
+    if (!fileName) {
+      cidToUnicodes->killIter(&iter);
+      return gFalse;
+    }
+    if (!isCompiledFileCurrent(fileName, compiledCIDToUnicodeMagic,
+			       srcFileName) &&
+	!(makeParentDirs(fileName) &&
+	  CharCodeToUnicode::compileCIDToUnicode(srcFileName, fileName))) {
+      ok = gFalse;
+    }
+    delete fileName;
+  }
+
+  // CMaps that use other CMaps are compiled with those merged in
+  cache = new CMapCache();
+  cMapDirs->startIter(&iter);
+  while (cMapDirs->getNext(&iter, &collection, &val)) {
+    list = (GooList *)val;
+    for (i = 0; i < list->getLength(); ++i) {
+      dir = new GDir(((GooString *)list->get(i))->getCString(), gTrue);
+      while ((entry = dir->getNextEntry())) {
+	if (!entry->isDir() &&
+	    (srcFileName = findCMapFileName(collection, entry->getName()))) {
+	  lockGlobalParams;
+	  fileName = makeCompiledFileName("cMap", collection,
+					  entry->getName());
+	  unlockGlobalParams;
+	  if (!fileName ||
+	      (!CMap::isCompiledCurrent(collection, fileName, srcFileName) &&
+	       !(makeParentDirs(fileName) &&
+		 CMap::compile(cache, collection, entry->getName(),
+			       srcFileName, fileName)))) {
+	    ok = gFalse;
+	  }
+	  if (fileName) {
+	    delete fileName;
+	  }
+	  delete srcFileName;
+	}
+	delete entry;
+      }
+      delete dir;
+    }
+  }
+  delete cache;
+
+  return ok;
+}
@@ -76,6 +76,9 @@ public:
   CharCode getMacRomanCharCode(const char *charName);
   Unicode mapNameToUnicode(const char *charName);
   FILE *findCMapFile(GooString *collection, GooString *cMapName);
+  GooString *findCMapFileName(GooString *collection, GooString *cMapName);
+  GooString *getCompiledCMapFileName(GooString *collection,
+				     GooString *cMapName);
   FILE *findToUnicodeFile(GooString *name);
   GBool getTextKeepTinyChars();
   GBool getMapNumericCharNames();
@@ -89,6 +92,20 @@ public:
   void setMapNumericCharNames(GBool map);
   void setMapUnknownCharNames(GBool map);
 
+  // Set the directory that holds the compiled CMap and cidToUnicode
+  // files (by default "compiled" in poppler-data), or NULL to always
+  // parse the text files.
+  void setCompiledDataDir(const char *dir);
+
+  //----- compiled data
+
+  // Write the compiled form of every CMap and cidToUnicode file that
+  // has none, or an out-of-date one, to the compiled data directory.
+  // The compiled files are mapped read-only and shared by all
+  // documents and threads, instead of parsing the text files.
+  // Returns false if any file couldn't be compiled.
+  GBool compileEncodingData();
+
 private:
 
   void parseNameToUnicode(GooString *name);
@@ -97,16 +114,13 @@ private:
   void addCIDToUnicode(GooString *collection, GooString *fileName);
   void addUnicodeMap(GooString *encodingName, GooString *fileName);
   void addCMapDir(GooString *collection, GooString *dir);
-
-  //----- static tables
-
-  NameToCharCode *		// mapping from char name to
-  macRomanReverseMap;		//   MacRomanEncoding index
+  GooString *makeCompiledFileName(const char *kind, GooString *collection,
+				  GooString *name);
 
   //----- user-modifiable settings
 
-  NameToCharCode *		// mapping from char name to Unicode
-    nameToUnicode;
+  NameToCharCode *		// mapping from char name to Unicode, from
+    nameToUnicode;		//   the nameToUnicode files
   GooHash *cidToUnicodes;		// files for mappings from char collections
 				//   to Unicode, indexed by collection name
 				//   [GooString]
@@ -115,6 +129,8 @@ private:
   GooHash *cMapDirs;		// list of CMap dirs, indexed by collection
 				//   name [GooList[GooString]]
   GooList *toUnicodeDirs;		// list of ToUnicode CMap dirs [GooString]
+  GooString *compiledDataDir;	// dir of compiled CMap and cidToUnicode
+				//   files, or NULL
 
   GBool textKeepTinyChars;	// keep all characters in text output
   GBool mapNumericCharNames;	// map numeric char names (from font subsets)?
@@ -0,0 +1,261 @@
+//========================================================================
+//
+// ImageOutputDev.cc
+//
+// Image export support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#include <stddef.h>
+#include "gmem.h"
+#include "Object.h"
+#include "Stream.h"
+#include "GfxState.h"
+#include "ImageOutputDev.h"
+
+//------------------------------------------------------------------------
+// ImageOutputDev
+//------------------------------------------------------------------------
+
+ImageOutputDev::ImageOutputDev(ImageSink *sinkA) {
+  sink = sinkA;
+  pageNum = 0;
+}
+
+ImageOutputDev::~ImageOutputDev() {
+}
+
+void ImageOutputDev::startPage(int pageNumA, GfxState *state) {
+  pageNum = pageNumA;
+}
+
+void ImageOutputDev::drawImageMask(GfxState *state, Object *ref, Stream *str,
+				   int width, int height, GBool invert,
+				   GBool interpolate, GBool inlineImg) {
+  writeMask(state, ref, imageKindMask, str, width, height, invert, inlineImg);
+}
+
+void ImageOutputDev::drawImage(GfxState *state, Object *ref, Stream *str,
+			       int width, int height,
+			       GfxImageColorMap *colorMap,
+			       GBool interpolate, int *maskColors,
+			       GBool inlineImg) {
+  writeImage(state, ref, imageKindImage, str, width, height, colorMap,
+	     inlineImg);
+}
+
+void ImageOutputDev::drawMaskedImage(GfxState *state, Object *ref,
+				     Stream *str, int width, int height,
+				     GfxImageColorMap *colorMap,
+				     GBool interpolate, Stream *maskStr,
+				     int maskWidth, int maskHeight,
+				     GBool maskInvert, GBool maskInterpolate) {
+  writeImage(state, ref, imageKindImage, str, width, height, colorMap,
+	     gFalse);
+  writeMask(state, ref, imageKindMask, maskStr, maskWidth, maskHeight,
+	    maskInvert, gFalse);
+}
+
+void ImageOutputDev::drawSoftMaskedImage(GfxState *state, Object *ref,
+					 Stream *str, int width, int height,
+					 GfxImageColorMap *colorMap,
+					 GBool interpolate, Stream *maskStr,
+					 int maskWidth, int maskHeight,
+					 GfxImageColorMap *maskColorMap,
+					 GBool maskInterpolate) {
+  writeImage(state, ref, imageKindImage, str, width, height, colorMap,
+	     gFalse);
+  writeImage(state, ref, imageKindSoftMask, maskStr, maskWidth, maskHeight,
+	     maskColorMap, gFalse);
+}
+
+void ImageOutputDev::initInfo(ImageInfo *info, GfxState *state, Object *ref,
+			      ImageKind kind, int width, int height) {
+  double *ctm;
+  double x, y;
+  int i;
+
+  info->pageNum = pageNum;
+  if (ref && ref->isRef()) {
+    info->num = ref->getRefNum();
+    info->gen = ref->getRefGen();
+  } else {
+    info->num = -1;
+    info->gen = 0;
+  }
+  info->kind = kind;
+  info->format = imageFormatPixels;
+  info->width = width;
+  info->height = height;
+  info->nComps = 1;
+
+  // the image fills the unit square
+  ctm = state->getCTM();
+  for (i = 0; i < 6; ++i) {
+    info->ctm[i] = ctm[i];
+  }
+  info->xMin = info->xMax = ctm[4];
+  info->yMin = info->yMax = ctm[5];
+  for (i = 1; i < 4; ++i) {
+    x = (i & 1) * ctm[0] + (i >> 1) * ctm[2] + ctm[4];
+    y = (i & 1) * ctm[1] + (i >> 1) * ctm[3] + ctm[5];
+    if (x < info->xMin) {
+      info->xMin = x;
+    } else if (x > info->xMax) {
+      info->xMax = x;
+    }
+    if (y < info->yMin) {
+      info->yMin = y;
+    } else if (y > info->yMax) {
+      info->yMax = y;
+    }
+  }
+}
+
+// Returns the stream holding the encoded bytes of <str>, if those make
+// a complete JPEG or JPEG 2000 file that shows the same samples as the
+// PDF does: gray or RGB, not remapped by /Decode.  Returns NULL if the
+// image has to be decoded.
+Stream *ImageOutputDev::getPassThroughStream(Stream *str,
+					     GfxImageColorMap *colorMap,
+					     ImageFormat *format) {
+  GfxColorSpaceMode mode;
+  int nComps, i;
+
+  nComps = colorMap->getNumPixelComps();
+  if (nComps != 1 && nComps != 3) {
+    return NULL;
+  }
+  mode = colorMap->getColorSpace()->getMode();
+  if (mode != csDeviceGray && mode != csCalGray &&
+      mode != csDeviceRGB && mode != csCalRGB && mode != csICCBased) {
+    return NULL;
+  }
+  for (i = 0; i < nComps; ++i) {
+    if (colorMap->getDecodeLow(i) != 0 || colorMap->getDecodeHigh(i) != 1) {
+      return NULL;
+    }
+  }
+  switch (str->getKind()) {
+  case strDCT:
+    // a JPEG file without an Adobe marker is taken to be YCbCr by
+    // readers, whatever /ColorTransform says
+    if (nComps == 3 && ((DCTStream *)str)->getColorXform() == 0) {
+      return NULL;
+    }
+    *format = imageFormatJPEG;
+    return ((DCTStream *)str)->getRawStream();
+  case strJPX:
+    *format = imageFormatJPX;
+    return str->getNextStream();
+  default:
+    return NULL;
+  }
+}
+
+void ImageOutputDev::writeImage(GfxState *state, Object *ref, ImageKind kind,
+				Stream *str, int width, int height,
+				GfxImageColorMap *colorMap, GBool inlineImg) {
+  ImageInfo info;
+  ImageStream *imgStr;
+  Stream *rawStr;
+  Guchar *line, *buf;
+  unsigned int *rgb;
+  GfxColorSpace *colorSpace;
+  int x, y;
+
+  initInfo(&info, state, ref, kind, width, height);
+
+  // the data of inline images ends where the content stream goes on,
+  // so they can't be copied as they are
+  rawStr = inlineImg ? (Stream *)NULL
+                     : getPassThroughStream(str, colorMap, &info.format);
+  colorSpace = colorMap->getColorSpace();
+  if (rawStr) {
+    info.nComps = colorMap->getNumPixelComps();
+  } else if (colorSpace->getNComps() == 1 && colorSpace->getMode() != csIndexed) {
+    info.nComps = 1;
+  } else {
+    info.nComps = 3;
+  }
+  if (!sink->startImage(&info)) {
+    OutputDev::drawImage(state, ref, str, width, height, colorMap,
+			 gFalse, NULL, inlineImg);
+    return;
+  }
+
+  if (rawStr) {
+    copyStream(rawStr);
+  } else {
+    imgStr = new ImageStream(str, width, colorMap->getNumPixelComps(),
+			     colorMap->getBits());
+    imgStr->reset();
+    buf = (Guchar *)gmallocn(width, info.nComps);
+    rgb = info.nComps == 3 ? (unsigned int *)gmallocn(width, sizeof(unsigned int))
+                           : (unsigned int *)NULL;
+    for (y = 0; y < height; ++y) {
+      line = imgStr->getLine();
+      if (info.nComps == 1) {
+	colorMap->getGrayLine(line, buf, width);
+      } else {
+	colorMap->getRGBLine(line, rgb, width);
+	for (x = 0; x < width; ++x) {
+	  buf[3*x] = (Guchar)(rgb[x] >> 16);
+	  buf[3*x + 1] = (Guchar)(rgb[x] >> 8);
+	  buf[3*x + 2] = (Guchar)rgb[x];
+	}
+      }
+      sink->writeImageData(buf, width * info.nComps);
+    }
+    gfree(rgb);
+    gfree(buf);
+    imgStr->close();
+    delete imgStr;
+  }
+  sink->endImage();
+}
+
+void ImageOutputDev::writeMask(GfxState *state, Object *ref, ImageKind kind,
+			       Stream *str, int width, int height,
+			       GBool invert, GBool inlineImg) {
+  ImageInfo info;
+  ImageStream *imgStr;
+  Guchar *line, *buf;
+  int x, y;
+
+  initInfo(&info, state, ref, kind, width, height);
+  if (!sink->startImage(&info)) {
+    OutputDev::drawImageMask(state, ref, str, width, height, invert,
+			     gFalse, inlineImg);
+    return;
+  }
+
+  // painted samples are black
+  imgStr = new ImageStream(str, width, 1, 1);
+  imgStr->reset();
+  buf = (Guchar *)gmalloc(width);
+  for (y = 0; y < height; ++y) {
+    line = imgStr->getLine();
+    for (x = 0; x < width; ++x) {
+      buf[x] = (line[x] ^ invert) ? 0xff : 0;
+    }
+    sink->writeImageData(buf, width);
+  }
+  gfree(buf);
+  imgStr->close();
+  delete imgStr;
+  sink->endImage();
+}
+
+void ImageOutputDev::copyStream(Stream *str) {
+  Guchar buf[4096];
+  int n;
+
+  str->reset();
+  while ((n = str->doGetChars(sizeof(buf), buf)) > 0) {
+    sink->writeImageData(buf, n);
+  }
+  str->close();
+}
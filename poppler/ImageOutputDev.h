@@ -0,0 +1,132 @@
+//========================================================================
+//
+// ImageOutputDev.h
+//
+// Image export support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef IMAGEOUTPUTDEV_H
+#define IMAGEOUTPUTDEV_H
+
+#include "gtypes.h"
+#include "OutputDev.h"
+
+class GfxState;
+class GfxImageColorMap;
+class Stream;
+
+//------------------------------------------------------------------------
+
+enum ImageKind {
+  imageKindImage,		// an image XObject or inline image
+  imageKindMask,		// a stencil mask, or the /Mask of an image
+  imageKindSoftMask		// the /SMask of an image
+};
+
+enum ImageFormat {
+  imageFormatJPEG,		// a JPEG file, copied from the PDF
+  imageFormatJPX,		// a JPEG 2000 file or codestream, copied from
+				//   the PDF
+  imageFormatPixels		// decoded samples: <height> rows of <width>
+				//   pixels, <nComps> bytes each
+};
+
+struct ImageInfo {
+  int pageNum;
+  int num, gen;			// the image XObject, num = -1 for inline
+				//   images
+  ImageKind kind;
+  ImageFormat format;
+  int width, height;		// in samples
+  int nComps;			// 1 (gray) or 3 (RGB)
+  double ctm[6];		// maps the unit square to the page
+  double xMin, yMin,		// bounding box on the page, in points
+         xMax, yMax;		//   from the top left corner
+};
+
+//------------------------------------------------------------------------
+// ImageSink
+//
+// Receives the images found by an ImageOutputDev, one at a time.
+//------------------------------------------------------------------------
+
+class ImageSink {
+public:
+
+  virtual ~ImageSink() {}
+
+  // Called before the data of each image.  Returning gFalse skips the
+  // data, e.g. for an XObject drawn before; endImage is not called
+  // then.
+  virtual GBool startImage(ImageInfo *info) = 0;
+
+  // Called with the image data in pieces.
+  virtual void writeImageData(Guchar *data, int len) = 0;
+
+  virtual void endImage() = 0;
+};
+
+//------------------------------------------------------------------------
+// ImageOutputDev
+//
+// Hands every image drawn on a page to an ImageSink.  JPEG and JPEG
+// 2000 images whose samples need no conversion are passed on as stored
+// in the file, without decoding them; all others are decoded to gray or
+// RGB pixels.
+//------------------------------------------------------------------------
+
+class ImageOutputDev: public OutputDev {
+public:
+
+  // Does not take ownership of <sinkA>.
+  ImageOutputDev(ImageSink *sinkA);
+  virtual ~ImageOutputDev();
+
+  virtual GBool upsideDown() { return gTrue; }
+  virtual GBool useDrawChar() { return gFalse; }
+  virtual GBool interpretType3Chars() { return gFalse; }
+
+  virtual void startPage(int pageNum, GfxState *state);
+
+  virtual void drawImageMask(GfxState *state, Object *ref, Stream *str,
+			     int width, int height, GBool invert,
+			     GBool interpolate, GBool inlineImg);
+  virtual void drawImage(GfxState *state, Object *ref, Stream *str,
+			 int width, int height, GfxImageColorMap *colorMap,
+			 GBool interpolate, int *maskColors, GBool inlineImg);
+  virtual void drawMaskedImage(GfxState *state, Object *ref, Stream *str,
+			       int width, int height,
+			       GfxImageColorMap *colorMap, GBool interpolate,
+			       Stream *maskStr, int maskWidth, int maskHeight,
+			       GBool maskInvert, GBool maskInterpolate);
+  virtual void drawSoftMaskedImage(GfxState *state, Object *ref, Stream *str,
+				   int width, int height,
+				   GfxImageColorMap *colorMap,
+				   GBool interpolate,
+				   Stream *maskStr,
+				   int maskWidth, int maskHeight,
+				   GfxImageColorMap *maskColorMap,
+				   GBool maskInterpolate);
+
+private:
+
+  void initInfo(ImageInfo *info, GfxState *state, Object *ref,
+		ImageKind kind, int width, int height);
+  Stream *getPassThroughStream(Stream *str, GfxImageColorMap *colorMap,
+			       ImageFormat *format);
+  void writeImage(GfxState *state, Object *ref, ImageKind kind,
+		  Stream *str, int width, int height,
+		  GfxImageColorMap *colorMap, GBool inlineImg);
+  void writeMask(GfxState *state, Object *ref, ImageKind kind,
+		 Stream *str, int width, int height, GBool invert,
+		 GBool inlineImg);
+  void copyStream(Stream *str);
+
+  ImageSink *sink;
+  int pageNum;
+};
+
+#endif
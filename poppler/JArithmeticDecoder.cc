@@ -87,6 +87,7 @@ int JArithmeticDecoder::switchTab[47] = {
 
 JArithmeticDecoder::JArithmeticDecoder() {
   str = NULL;
+  dataPtr = dataEnd = NULL;
   dataLen = 0;
   limitStream = gFalse;
 }
@@ -98,6 +99,9 @@ inline Guint JArithmeticDecoder::readByte() {
       return 0xff;
     }
   }
+  if (dataPtr) {
+    return dataPtr < dataEnd ? *dataPtr++ : 0xff;
+  }
   return (Guint)str->getChar() & 0xff;
 }
 
@@ -53,9 +53,15 @@ public:
   ~JArithmeticDecoder();
 
   void setStream(Stream *strA)
-    { str = strA; dataLen = 0; limitStream = gFalse; }
+    { str = strA; dataPtr = NULL; dataLen = 0; limitStream = gFalse; }
   void setStream(Stream *strA, int dataLenA)
-    { str = strA; dataLen = dataLenA; limitStream = gTrue; }
+    { str = strA; dataPtr = NULL; dataLen = dataLenA; limitStream = gTrue; }
+
+  // Read the data from the <bufLen> bytes at <buf> instead of a
+  // stream.
+  void setBuffer(const Guchar *buf, int bufLen, int dataLenA)
+    { str = NULL; dataPtr = buf; dataEnd = buf + bufLen;
+      dataLen = dataLenA; limitStream = gTrue; }
 
   // Start decoding on a new stream.  This fills the byte buffers and
   // runs INITDEC.
@@ -100,6 +106,8 @@ private:
   Guint prev;			// for the integer decoder
 
   Stream *str;
+  const Guchar *dataPtr;	// next byte, if reading from a buffer
+  const Guchar *dataEnd;
   int dataLen;
   GBool limitStream;
 };
@@ -30,10 +30,16 @@
 
 #include <stdlib.h>
 #include <limits.h>
+#include "gmem.h"
 #include "GooList.h"
+#if MULTITHREADED
+#include "GooMutex.h"
+#endif
 #include "Error.h"
 #include "JArithmeticDecoder.h"
 #include "JBIG2Stream.h"
+#include "XRef.h"
+#include "PopplerCache.h"
 
 //~ share these tables
 #include "Stream-CCITT.h"
@@ -673,6 +679,7 @@ public:
   void clearToOne();
   int getWidth() { return w; }
   int getHeight() { return h; }
+  int getLineSize() { return line; }
   int getPixel(int x, int y)
     { return (x < 0 || x >= w || y < 0 || y >= h) ? 0 :
              (data[y * line + (x >> 3)] >> (7 - (x & 7))) & 1; }
@@ -1135,11 +1142,125 @@ JBIG2CodeTable::~JBIG2CodeTable() {
   gfree(table);
 }
 
+//------------------------------------------------------------------------
+// JBIG2GlobalSegments
+//------------------------------------------------------------------------
+
+// The segments decoded from a JBIG2Globals stream, for all the
+// JBIG2Streams of a document that use it.  Page streams only read
+// them: retained arithmetic decoder stats are copied before use, and
+// discarded segments are only dropped from the stream's own list.
+class JBIG2GlobalSegments {
+public:
+
+  // Takes ownership of <segmentsA>.
+  JBIG2GlobalSegments(GooList *segmentsA);
+  void incRefCnt();
+  void decRefCnt();
+  GooList *getSegments() { return segments; }
+  size_t getBytes() { return bytes; }
+
+private:
+
+  ~JBIG2GlobalSegments();
+
+  GooList *segments;		// [JBIG2Segment]
+  size_t bytes;			// estimate of the memory held by <segments>
+  int refCnt;
+#if MULTITHREADED
+  GooMutex mutex;
+#endif
+};
+
+JBIG2GlobalSegments::JBIG2GlobalSegments(GooList *segmentsA) {
+  JBIG2Segment *seg;
+  JBIG2Bitmap *bitmap;
+  int i;
+  Guint j;
+
+  segments = segmentsA;
+  bytes = 0;
+  for (i = 0; i < segments->getLength(); ++i) {
+    seg = (JBIG2Segment *)segments->get(i);
+    bytes += sizeof(JBIG2Segment);
+    switch (seg->getType()) {
+    case jbig2SegBitmap:
+      bytes += ((JBIG2Bitmap *)seg)->getDataSize();
+      break;
+    case jbig2SegSymbolDict:
+      for (j = 0; j < ((JBIG2SymbolDict *)seg)->getSize(); ++j) {
+	if ((bitmap = ((JBIG2SymbolDict *)seg)->getBitmap(j))) {
+	  bytes += sizeof(JBIG2Bitmap) + bitmap->getDataSize();
+	}
+      }
+      break;
+    case jbig2SegPatternDict:
+      for (j = 0; j < ((JBIG2PatternDict *)seg)->getSize(); ++j) {
+	if ((bitmap = ((JBIG2PatternDict *)seg)->getBitmap(j))) {
+	  bytes += sizeof(JBIG2Bitmap) + bitmap->getDataSize();
+	}
+      }
+      break;
+    case jbig2SegCodeTable:
+      break;
+    }
+  }
+  refCnt = 1;
+#if MULTITHREADED
+  gInitMutex(&mutex);
+#endif
+}
+
+JBIG2GlobalSegments::~JBIG2GlobalSegments() {
+  deleteGooList(segments, JBIG2Segment);
+#if MULTITHREADED
+  gDestroyMutex(&mutex);
+#endif
+}
+
+void JBIG2GlobalSegments::incRefCnt() {
+#if MULTITHREADED
+  gLockMutex(&mutex);
+#endif
+  ++refCnt;
+#if MULTITHREADED
+  gUnlockMutex(&mutex);
+#endif
+}
+
+void JBIG2GlobalSegments::decRefCnt() {
+  GBool done;
+
+#if MULTITHREADED
+  gLockMutex(&mutex);
+#endif
+  done = --refCnt == 0;
+#if MULTITHREADED
+  gUnlockMutex(&mutex);
+#endif
+  if (done) {
+    delete this;
+  }
+}
+
+// Entry of the XRef's decoded data cache, keyed by the globals stream.
+class JBIG2GlobalsCacheItem: public PopplerCacheItem {
+public:
+
+  JBIG2GlobalsCacheItem(JBIG2GlobalSegments *globalsA)
+    { globals = globalsA; globals->incRefCnt(); }
+  ~JBIG2GlobalsCacheItem() { globals->decRefCnt(); }
+  virtual size_t getBytes() const { return globals->getBytes(); }
+
+  JBIG2GlobalSegments *globals;
+};
+
 //------------------------------------------------------------------------
 // JBIG2Stream
 //------------------------------------------------------------------------
 
-JBIG2Stream::JBIG2Stream(Stream *strA, Object *globalsStreamA):
+JBIG2Stream::JBIG2Stream(Stream *strA, Object *globalsStreamA,
+			 Object *globalsStreamRefA):
   FilterStream(strA)
 {
   pageBitmap = NULL;
@@ -1165,7 +1286,9 @@ JBIG2Stream::JBIG2Stream(Stream *strA, Object *globalsStreamA):
   mmrDecoder = new JBIG2MMRDecoder();
 
   globalsStreamA->copy(&globalsStream);
+  globalsStreamRefA->copy(&globalsStreamRef);
   segments = globalSegments = NULL;
+  sharedGlobals = NULL;
   curStr = NULL;
   dataPtr = dataEnd = NULL;
 }
@@ -1173,6 +1296,7 @@ JBIG2Stream::JBIG2Stream(Stream *strA, Object *globalsStreamA):
 JBIG2Stream::~JBIG2Stream() {
   close();
   globalsStream.free();
+  globalsStreamRef.free();
   delete arithDecoder;
   delete genericRegionStats;
   delete refinementRegionStats;
@@ -1196,17 +1320,50 @@ JBIG2Stream::~JBIG2Stream() {
 }
 
 void JBIG2Stream::reset() {
+  GMemScope memScope(gMemTagStreams);
+  JBIG2GlobalsCacheItem *item;
+  XRef *xref;
+  int num, gen;
+
+  // the segments of a globals stream that is an indirect object are
+  // decoded once per document
+  xref = NULL;
+  num = gen = 0;
+  if (globalsStream.isStream() && globalsStreamRef.isRef()) {
+    xref = globalsStream.streamGetDict()->getXRef();
+    num = globalsStreamRef.getRefNum();
+    gen = globalsStreamRef.getRefGen();
+  }
+  if (xref &&
+      (item = (JBIG2GlobalsCacheItem *)xref->lookupDecodedData(num, gen))) {
+    sharedGlobals = item->globals;
+    sharedGlobals->incRefCnt();
+    globalSegments = new GooList(sharedGlobals->getSegments()->getLength());
+    globalSegments->append(sharedGlobals->getSegments());
+
   // read the globals stream
-  globalSegments = new GooList();
-  if (globalsStream.isStream()) {
-    segments = globalSegments;
-    curStr = globalsStream.getStream();
-    curStr->reset();
-    arithDecoder->setStream(curStr);
-    huffDecoder->setStream(curStr);
-    mmrDecoder->setStream(curStr);
-    readSegments();
-    curStr->close();
+  } else {
+    globalSegments = new GooList();
+    if (globalsStream.isStream()) {
+      segments = globalSegments;
+      curStr = globalsStream.getStream();
+      curStr->reset();
+      arithDecoder->setStream(curStr);
+      huffDecoder->setStream(curStr);
+      mmrDecoder->setStream(curStr);
+      readSegments();
+      curStr->close();
+
+      // globals that start a page aren't shared, since the page bitmap
+      // belongs to this stream
+      if (xref && !pageBitmap) {
+	sharedGlobals = new JBIG2GlobalSegments(globalSegments);
+	xref->putDecodedData(num, gen,
+			     new JBIG2GlobalsCacheItem(sharedGlobals));
+	globalSegments = new GooList(sharedGlobals->getSegments()->getLength());
+	globalSegments->append(sharedGlobals->getSegments());
+      }
+    }
   }
 
   // read the main stream
@@ -1235,7 +1392,12 @@ void JBIG2Stream::close() {
     deleteGooList(segments, JBIG2Segment);
     segments = NULL;
   }
-  if (globalSegments) {
+  if (sharedGlobals) {
+    delete globalSegments;
+    globalSegments = NULL;
+    sharedGlobals->decRefCnt();
+    sharedGlobals = NULL;
+  } else if (globalSegments) {
     deleteGooList(globalSegments, JBIG2Segment);
     globalSegments = NULL;
   }
@@ -2764,13 +2926,11 @@ JBIG2Bitmap *JBIG2Stream::readGenericBitmap(GBool mmr, int w, int h,
 					    int *atx, int *aty,
 					    int mmrDataLength) {
   JBIG2Bitmap *bitmap;
-  GBool ltp;
-  Guint ltpCX, cx, cx0, cx1, cx2;
-  JBIG2BitmapPtr cxPtr0 = {0}, cxPtr1 = {0};
-  JBIG2BitmapPtr atPtr0 = {0}, atPtr1 = {0}, atPtr2 = {0}, atPtr3 = {0};
+  GBool ltp, templ0Nominal;
+  Guint ltpCX;
   int *refLine, *codingLine;
   int code1, code2, code3;
-  int x, y, a0i, b1i, blackPixels, pix, i;
+  int x, y, a0i, b1i, blackPixels, i;
 
   bitmap = new JBIG2Bitmap(0, w, h);
   if (!bitmap->isOk()) {
@@ -2991,8 +3151,15 @@ JBIG2Bitmap *JBIG2Stream::readGenericBitmap(GBool mmr, int w, int h,
       }
     }
 
+    // the nominal AT pixels of template 0 are taken from the same
+    // windows as the rest of the context
+    templ0Nominal = templ == 0 && !useSkip &&
+                    atx[0] == 3 && aty[0] == -1 &&
+                    atx[1] == -3 && aty[1] == -1 &&
+                    atx[2] == 2 && aty[2] == -2 &&
+                    atx[3] == -2 && aty[3] == -2;
+
     ltp = 0;
-    cx = cx0 = cx1 = cx2 = 0; // make gcc happy
     for (y = 0; y < h; ++y) {
 
       // check for a "typical" (duplicate) row
@@ -3008,151 +3175,10 @@ JBIG2Bitmap *JBIG2Stream::readGenericBitmap(GBool mmr, int w, int h,
 	}
       }
 
-      switch (templ) {
-      case 0:
-
-	// set up the context
-	bitmap->getPixelPtr(0, y-2, &cxPtr0);
-	cx0 = bitmap->nextPixel(&cxPtr0);
-	cx0 = (cx0 << 1) | bitmap->nextPixel(&cxPtr0);
-	bitmap->getPixelPtr(0, y-1, &cxPtr1);
-	cx1 = bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx2 = 0;
-	bitmap->getPixelPtr(atx[0], y + aty[0], &atPtr0);
-	bitmap->getPixelPtr(atx[1], y + aty[1], &atPtr1);
-	bitmap->getPixelPtr(atx[2], y + aty[2], &atPtr2);
-	bitmap->getPixelPtr(atx[3], y + aty[3], &atPtr3);
-
-	// decode the row
-	for (x = 0; x < w; ++x) {
-
-	  // build the context
-	  cx = (cx0 << 13) | (cx1 << 8) | (cx2 << 4) |
-	       (bitmap->nextPixel(&atPtr0) << 3) |
-	       (bitmap->nextPixel(&atPtr1) << 2) |
-	       (bitmap->nextPixel(&atPtr2) << 1) |
-	       bitmap->nextPixel(&atPtr3);
-
-	  // check for a skipped pixel
-	  if (useSkip && skip->getPixel(x, y)) {
-	    pix = 0;
-
-	  // decode the pixel
-	  } else if ((pix = arithDecoder->decodeBit(cx, genericRegionStats))) {
-	    bitmap->setPixel(x, y);
-	  }
-
-	  // update the context
-	  cx0 = ((cx0 << 1) | bitmap->nextPixel(&cxPtr0)) & 0x07;
-	  cx1 = ((cx1 << 1) | bitmap->nextPixel(&cxPtr1)) & 0x1f;
-	  cx2 = ((cx2 << 1) | pix) & 0x0f;
-	}
-	break;
-
-      case 1:
-
-	// set up the context
-	bitmap->getPixelPtr(0, y-2, &cxPtr0);
-	cx0 = bitmap->nextPixel(&cxPtr0);
-	cx0 = (cx0 << 1) | bitmap->nextPixel(&cxPtr0);
-	cx0 = (cx0 << 1) | bitmap->nextPixel(&cxPtr0);
-	bitmap->getPixelPtr(0, y-1, &cxPtr1);
-	cx1 = bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx2 = 0;
-	bitmap->getPixelPtr(atx[0], y + aty[0], &atPtr0);
-
-	// decode the row
-	for (x = 0; x < w; ++x) {
-
-	  // build the context
-	  cx = (cx0 << 9) | (cx1 << 4) | (cx2 << 1) |
-	       bitmap->nextPixel(&atPtr0);
-
-	  // check for a skipped pixel
-	  if (useSkip && skip->getPixel(x, y)) {
-	    pix = 0;
-
-	  // decode the pixel
-	  } else if ((pix = arithDecoder->decodeBit(cx, genericRegionStats))) {
-	    bitmap->setPixel(x, y);
-	  }
-
-	  // update the context
-	  cx0 = ((cx0 << 1) | bitmap->nextPixel(&cxPtr0)) & 0x0f;
-	  cx1 = ((cx1 << 1) | bitmap->nextPixel(&cxPtr1)) & 0x1f;
-	  cx2 = ((cx2 << 1) | pix) & 0x07;
-	}
-	break;
-
-      case 2:
-
-	// set up the context
-	bitmap->getPixelPtr(0, y-2, &cxPtr0);
-	cx0 = bitmap->nextPixel(&cxPtr0);
-	cx0 = (cx0 << 1) | bitmap->nextPixel(&cxPtr0);
-	bitmap->getPixelPtr(0, y-1, &cxPtr1);
-	cx1 = bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx2 = 0;
-	bitmap->getPixelPtr(atx[0], y + aty[0], &atPtr0);
-
-	// decode the row
-	for (x = 0; x < w; ++x) {
-
-	  // build the context
-	  cx = (cx0 << 7) | (cx1 << 3) | (cx2 << 1) |
-	       bitmap->nextPixel(&atPtr0);
-
-	  // check for a skipped pixel
-	  if (useSkip && skip->getPixel(x, y)) {
-	    pix = 0;
-
-	  // decode the pixel
-	  } else if ((pix = arithDecoder->decodeBit(cx, genericRegionStats))) {
-	    bitmap->setPixel(x, y);
-	  }
-
-	  // update the context
-	  cx0 = ((cx0 << 1) | bitmap->nextPixel(&cxPtr0)) & 0x07;
-	  cx1 = ((cx1 << 1) | bitmap->nextPixel(&cxPtr1)) & 0x0f;
-	  cx2 = ((cx2 << 1) | pix) & 0x03;
-	}
-	break;
-
-      case 3:
-
-	// set up the context
-	bitmap->getPixelPtr(0, y-1, &cxPtr1);
-	cx1 = bitmap->nextPixel(&cxPtr1);
-	cx1 = (cx1 << 1) | bitmap->nextPixel(&cxPtr1);
-	cx2 = 0;
-	bitmap->getPixelPtr(atx[0], y + aty[0], &atPtr0);
-
-	// decode the row
-	for (x = 0; x < w; ++x) {
-
-	  // build the context
-	  cx = (cx1 << 5) | (cx2 << 1) |
-	       bitmap->nextPixel(&atPtr0);
-
-	  // check for a skipped pixel
-	  if (useSkip && skip->getPixel(x, y)) {
-	    pix = 0;
-
-	  // decode the pixel
-	  } else if ((pix = arithDecoder->decodeBit(cx, genericRegionStats))) {
-	    bitmap->setPixel(x, y);
-	  }
-
-	  // update the context
-	  cx1 = ((cx1 << 1) | bitmap->nextPixel(&cxPtr1)) & 0x1f;
-	  cx2 = ((cx2 << 1) | pix) & 0x0f;
-	}
-	break;
+      if (templ0Nominal) {
+	readGenericTempl0Row(bitmap, y);
+      } else {
+	readGenericRow(bitmap, y, templ, useSkip, skip, atx, aty);
       }
     }
   }
@@ -3160,6 +3186,173 @@ JBIG2Bitmap *JBIG2Stream::readGenericBitmap(GBool mmr, int w, int h,
   return bitmap;
 }
 
+// Layout of the generic region contexts: for the rows two above, one
+// above and the current row, the context bit of the rightmost pixel
+// taken from the row and, for the rows above, that pixel's x offset
+// and the mask of all the row's pixels; plus the bits that move one
+// place up when the context advances to the next pixel.
+static const struct {
+  int pos2, dx2;
+  Guint mask2;
+  int pos1, dx1;
+  Guint mask1;
+  int pos0;
+  Guint shiftMask;
+} genericContexts[4] = {
+  { 13, 1, 0x07,  8, 2, 0x1f, 4, 0x6f70 },
+  {  9, 2, 0x0f,  4, 2, 0x1f, 1, 0x0ef6 },
+  {  7, 1, 0x07,  3, 1, 0x0f, 1, 0x01ba },
+  {  0, 0, 0x00,  5, 1, 0x1f, 1, 0x01ee }
+};
+
+static inline Guint genericRowByte(Guchar *row, int i, int lineSize) {
+  return (row && i < lineSize) ? row[i] : 0;
+}
+
+// Reads row <y> of an arithmetic coded generic region.  The rows above
+// are read through sliding windows: while the pixels of byte <xb> of
+// the row are decoded, bits 23..0 of line1 and line2 hold bytes xb-1,
+// xb and xb+1 of the rows one and two above, so that pixel x + dx, for
+// x = 8 * xb + m, is bit 15 - m - dx.  The context is shifted along one
+// pixel at a time, taking in one new pixel from each row.
+void JBIG2Stream::readGenericRow(JBIG2Bitmap *bitmap, int y, int templ,
+				 GBool useSkip, JBIG2Bitmap *skip,
+				 int *atx, int *aty) {
+  JBIG2BitmapPtr atPtr0 = {0}, atPtr1 = {0}, atPtr2 = {0}, atPtr3 = {0};
+  Guchar *row, *row1, *row2;
+  Guint line1, line2, cx, at, shiftMask;
+  int pos2, dx2, pos1, dx1, pos0, atLine, atShift;
+  int w, lineSize, x, xb, m, pix;
+
+  w = bitmap->getWidth();
+  lineSize = bitmap->getLineSize();
+  row = bitmap->getDataPtr() + y * lineSize;
+  row1 = y >= 1 ? row - lineSize : (Guchar *)NULL;
+  row2 = y >= 2 && templ != 3 ? row - 2 * lineSize : (Guchar *)NULL;
+  pos2 = genericContexts[templ].pos2;
+  dx2 = genericContexts[templ].dx2;
+  pos1 = genericContexts[templ].pos1;
+  dx1 = genericContexts[templ].dx1;
+  pos0 = genericContexts[templ].pos0;
+  shiftMask = genericContexts[templ].shiftMask;
+
+  line1 = (genericRowByte(row1, 0, lineSize) << 8) |
+          genericRowByte(row1, 1, lineSize);
+  line2 = (genericRowByte(row2, 0, lineSize) << 8) |
+          genericRowByte(row2, 1, lineSize);
+  cx = (((line2 >> (15 - dx2)) & genericContexts[templ].mask2) << pos2) |
+       (((line1 >> (15 - dx1)) & genericContexts[templ].mask1) << pos1);
+
+  // the single AT pixel of templates 1 to 3 usually lies within the
+  // windows, whose bits 31..24 still hold byte xb-2
+  atLine = 0;
+  atShift = 0;
+  if (templ != 0 && atx[0] >= -16 && atx[0] <= 8 &&
+      (aty[0] == -1 || (aty[0] == -2 && templ != 3))) {
+    atLine = -aty[0];
+    atShift = 15 - atx[0];
+  } else {
+    bitmap->getPixelPtr(atx[0], y + aty[0], &atPtr0);
+  }
+  if (templ == 0) {
+    bitmap->getPixelPtr(atx[1], y + aty[1], &atPtr1);
+    bitmap->getPixelPtr(atx[2], y + aty[2], &atPtr2);
+    bitmap->getPixelPtr(atx[3], y + aty[3], &atPtr3);
+  }
+
+  for (x = 0, xb = 0; x < w; ++xb) {
+    if (xb > 0) {
+      line1 = (line1 << 8) | genericRowByte(row1, xb + 1, lineSize);
+      line2 = (line2 << 8) | genericRowByte(row2, xb + 1, lineSize);
+    }
+    for (m = 0; m < 8 && x < w; ++m, ++x) {
+
+      // the AT pixels may come from anywhere, this row included
+      if (templ == 0) {
+	at = (bitmap->nextPixel(&atPtr0) << 3) |
+	     (bitmap->nextPixel(&atPtr1) << 2) |
+	     (bitmap->nextPixel(&atPtr2) << 1) |
+	     bitmap->nextPixel(&atPtr3);
+      } else if (atLine == 1) {
+	at = (line1 >> (atShift - m)) & 1;
+      } else if (atLine == 2) {
+	at = (line2 >> (atShift - m)) & 1;
+      } else {
+	at = bitmap->nextPixel(&atPtr0);
+      }
+
+      // check for a skipped pixel
+      if (useSkip && skip->getPixel(x, y)) {
+	pix = 0;
+
+      // decode the pixel
+      } else if ((pix = arithDecoder->decodeBit(cx | at,
+						genericRegionStats))) {
+	row[xb] |= 0x80 >> m;
+      }
+
+      // update the context
+      cx = ((cx & shiftMask) << 1) |
+	   (((line2 >> (14 - m - dx2)) & 1) << pos2) |
+	   (((line1 >> (14 - m - dx1)) & 1) << pos1) |
+	   (pix << pos0);
+    }
+  }
+}
+
+// Reads row <y> of an arithmetic coded template 0 generic region with
+// the AT pixels in their nominal places, (3,-1), (-3,-1), (2,-2) and
+// (-2,-2), the way nearly all encoders leave them.  Like
+// readGenericRow, but the AT pixels are shifted in along with the rest
+// of the context.
+void JBIG2Stream::readGenericTempl0Row(JBIG2Bitmap *bitmap, int y) {
+  Guchar *row, *row1, *row2;
+  Guint line1, line2, cx, byte;
+  int w, lineSize, x, xb, m, n, pix;
+
+  w = bitmap->getWidth();
+  lineSize = bitmap->getLineSize();
+  row = bitmap->getDataPtr() + y * lineSize;
+  row1 = y >= 1 ? row - lineSize : (Guchar *)NULL;
+  row2 = y >= 2 ? row - 2 * lineSize : (Guchar *)NULL;
+
+  // context bits 15..13: (x-1..x+1, y-2); 12..8: (x-2..x+2, y-1);
+  // 7..4: (x-4..x-1, y); 3..0: the AT pixels (x+3, y-1), (x-3, y-1),
+  // (x+2, y-2) and (x-2, y-2)
+  line1 = (genericRowByte(row1, 0, lineSize) << 8) |
+          genericRowByte(row1, 1, lineSize);
+  line2 = (genericRowByte(row2, 0, lineSize) << 8) |
+          genericRowByte(row2, 1, lineSize);
+  cx = (((line2 >> 14) & 0x07) << 13) |
+       (((line1 >> 13) & 0x1f) << 8) |
+       (((line1 >> 12) & 1) << 3) |
+       (((line2 >> 13) & 1) << 1);
+
+  for (x = 0, xb = 0; x < w; ++xb, x += 8) {
+    if (xb > 0) {
+      line1 = (line1 << 8) | genericRowByte(row1, xb + 1, lineSize);
+      line2 = (line2 << 8) | genericRowByte(row2, xb + 1, lineSize);
+    }
+    n = w - x < 8 ? w - x : 8;
+    byte = 0;
+    for (m = 0; m < n; ++m) {
+      pix = arithDecoder->decodeBit(cx, genericRegionStats);
+      byte |= pix << (7 - m);
+
+      // the pixels leaving the row windows become the left AT pixels
+      cx = ((cx & 0x6f70) << 1) |
+	   (((line2 >> (13 - m)) & 1) << 13) |
+	   (((line1 >> (12 - m)) & 1) << 8) |
+	   (pix << 4) |
+	   (((line1 >> (11 - m)) & 1) << 3) |
+	   (((cx >> 12) & 1) << 2) |
+	   (((line2 >> (12 - m)) & 1) << 1) |
+	   ((cx >> 15) & 1);
+    }
+    row[xb] = (Guchar)byte;
+  }
+}
+
 void JBIG2Stream::readGenericRefinementRegionSeg(Guint segNum, GBool imm,
 						 GBool lossless, Guint length,
 						 Guint *refSegs,
@@ -33,6 +33,7 @@
 
 class GooList;
 class JBIG2Segment;
+class JBIG2GlobalSegments;
 class JBIG2Bitmap;
 class JArithmeticDecoder;
 class JArithmeticDecoderStats;
@@ -45,7 +46,10 @@ class JBIG2MMRDecoder;
 class JBIG2Stream: public FilterStream {
 public:
 
-  JBIG2Stream(Stream *strA, Object *globalsStreamA);
+  // <globalsStreamRefA> is the reference to <globalsStreamA>, if it
+  // has one: the segments decoded from it are then shared with the
+  // other streams of the document that use it.
+  JBIG2Stream(Stream *strA, Object *globalsStreamA, Object *globalsStreamRefA);
   virtual ~JBIG2Stream();
   virtual StreamKind getKind() { return strJBIG2; }
   virtual void reset();
@@ -100,6 +104,10 @@ private:
 				 GBool useSkip, JBIG2Bitmap *skip,
 				 int *atx, int *aty,
 				 int mmrDataLength);
+  void readGenericRow(JBIG2Bitmap *bitmap, int y, int templ,
+		      GBool useSkip, JBIG2Bitmap *skip,
+		      int *atx, int *aty);
+  void readGenericTempl0Row(JBIG2Bitmap *bitmap, int y);
   void readGenericRefinementRegionSeg(Guint segNum, GBool imm,
 				      GBool lossless, Guint length,
 				      Guint *refSegs,
@@ -128,12 +136,15 @@ private:
   GBool readLong(int *x);
 
   Object globalsStream;
+  Object globalsStreamRef;
   Guint pageW, pageH, curPageH;
   Guint pageDefPixel;
   JBIG2Bitmap *pageBitmap;
   Guint defCombOp;
   GooList *segments;		// [JBIG2Segment]
   GooList *globalSegments;	// [JBIG2Segment]
+  JBIG2GlobalSegments *sharedGlobals; // owner of the <globalSegments>,
+				//   if they came from the XRef's cache
   Stream *curStr;
   Guchar *dataPtr;
   Guchar *dataEnd;
@@ -21,6 +21,11 @@
 //========================================================================
 
 #include <limits.h>
+#include <string.h>
+#if MULTITHREADED
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 #ifdef USE_GCC_PRAGMAS
 #pragma implementation
@@ -72,6 +77,13 @@
 
 //------------------------------------------------------------------------
 
+// code-blocks are decoded on up to jpxMaxThreads threads, with at least
+// jpxMinCodeBlocksPerThread code-blocks for each
+#define jpxMaxThreads               8
+#define jpxMinCodeBlocksPerThread  16
+
+//------------------------------------------------------------------------
+
 // arithmetic decoder context for the significance propagation and
 // cleanup passes:
 //     [horiz][vert][diag][subband]
@@ -176,6 +188,140 @@ static const Guint signContext[5][5][2] = {
 
 //------------------------------------------------------------------------
 
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12)
+
+// The 1D transforms of a level are run on four rows or four columns at
+// a time, one in each 32-bit lane.  The 9-7 filter steps are done in
+// double precision in every lane, just like the scalar code, so the
+// output is the same.
+#define HAVE_JPX_VECTOR 1
+
+typedef int JPXVector __attribute__((vector_size(16)));
+typedef double JPXDoubleVector __attribute__((vector_size(32)));
+
+// (int)(k * v)
+static inline JPXVector jpxScale(JPXVector v, double k) {
+  return __builtin_convertvector(k * __builtin_convertvector(v,
+							     JPXDoubleVector),
+				 JPXVector);
+}
+
+// (int)(v - k * (l + r))
+static inline JPXVector jpxLift(JPXVector v, JPXVector l, JPXVector r,
+				double k) {
+  return __builtin_convertvector(__builtin_convertvector(v, JPXDoubleVector)
+				 - k * __builtin_convertvector(l + r,
+							       JPXDoubleVector),
+				 JPXVector);
+}
+
+// Same as JPXStream::inverseTransform1D, for the four lines starting at
+// <data>, <lineStep> ints apart.  The length must be at least 2.  <buf>
+// has room for i1 - i0 + 8 vectors.
+static void jpxInverseTransform1DVector(Guint transform, int *data,
+					Guint stride, Guint lineStep,
+					Guint i0, Guint i1, JPXVector *buf) {
+  int *p;
+  Guint offset, end, i;
+
+  offset = 3 + (i0 & 1);
+  end = offset + i1 - i0;
+
+  //----- gather
+  p = data;
+  if (lineStep == 1) {
+    for (i = 0; i < i1 - i0; ++i, p += stride) {
+      memcpy(&buf[offset + i], p, sizeof(JPXVector));
+    }
+  } else {
+    for (i = 0; i < i1 - i0; ++i, p += stride) {
+      buf[offset + i] = (JPXVector){p[0], p[lineStep],
+				    p[2 * lineStep], p[3 * lineStep]};
+    }
+  }
+
+  //----- extend right
+  buf[end] = buf[end - 2];
+  if (i1 - i0 == 2) {
+    buf[end+1] = buf[offset + 1];
+    buf[end+2] = buf[offset];
+    buf[end+3] = buf[offset + 1];
+  } else {
+    buf[end+1] = buf[end - 3];
+    if (i1 - i0 == 3) {
+      buf[end+2] = buf[offset + 1];
+      buf[end+3] = buf[offset + 2];
+    } else {
+      buf[end+2] = buf[end - 4];
+      if (i1 - i0 == 4) {
+	buf[end+3] = buf[offset + 1];
+      } else {
+	buf[end+3] = buf[end - 5];
+      }
+    }
+  }
+
+  //----- extend left
+  buf[offset - 1] = buf[offset + 1];
+  buf[offset - 2] = buf[offset + 2];
+  buf[offset - 3] = buf[offset + 3];
+  if (offset == 4) {
+    buf[0] = buf[offset + 4];
+  }
+
+  //----- 9-7 irreversible filter
+
+  if (transform == 0) {
+    for (i = 1; i <= end + 2; i += 2) {
+      buf[i] = jpxScale(buf[i], idwtKappa);
+    }
+    for (i = 0; i <= end + 3; i += 2) {
+      buf[i] = jpxScale(buf[i], idwtIKappa);
+    }
+    for (i = 1; i <= end + 2; i += 2) {
+      buf[i] = jpxLift(buf[i], buf[i-1], buf[i+1], idwtDelta);
+    }
+    for (i = 2; i <= end + 1; i += 2) {
+      buf[i] = jpxLift(buf[i], buf[i-1], buf[i+1], idwtGamma);
+    }
+    for (i = 3; i <= end; i += 2) {
+      buf[i] = jpxLift(buf[i], buf[i-1], buf[i+1], idwtBeta);
+    }
+    for (i = 4; i <= end - 1; i += 2) {
+      buf[i] = jpxLift(buf[i], buf[i-1], buf[i+1], idwtAlpha);
+    }
+
+  //----- 5-3 reversible filter
+
+  } else {
+    for (i = 3; i <= end; i += 2) {
+      buf[i] -= (buf[i-1] + buf[i+1] + 2) >> 2;
+    }
+    for (i = 4; i < end; i += 2) {
+      buf[i] += (buf[i-1] + buf[i+1]) >> 1;
+    }
+  }
+
+  //----- scatter
+  p = data;
+  if (lineStep == 1) {
+    for (i = 0; i < i1 - i0; ++i, p += stride) {
+      memcpy(p, &buf[offset + i], sizeof(JPXVector));
+    }
+  } else {
+    for (i = 0; i < i1 - i0; ++i, p += stride) {
+      p[0] = buf[offset + i][0];
+      p[lineStep] = buf[offset + i][1];
+      p[2 * lineStep] = buf[offset + i][2];
+      p[3 * lineStep] = buf[offset + i][3];
+    }
+  }
+}
+
+#endif
+
+//------------------------------------------------------------------------
+
 // floor(x / y)
 #define jpxFloorDiv(x, y) ((x) / (y))
 
@@ -267,6 +413,7 @@ JPXStream::~JPXStream() {
 }
 
 void JPXStream::reset() {
+  GMemScope memScope(gMemTagStreams);
   str->reset();
   if (readBoxes()) {
     curY = img.yOffset;
@@ -332,12 +479,8 @@ void JPXStream::close() {
 			for (k = 0; k < subband->nXCBs * subband->nYCBs; ++k) {
 			  cb = &subband->cbs[k];
 			  gfree(cb->coeffs);
-			  if (cb->arithDecoder) {
-			    delete cb->arithDecoder;
-			  }
-			  if (cb->stats) {
-			    delete cb->stats;
-			  }
+			  gfree(cb->data);
+			  gfree(cb->packets);
 			}
 			gfree(subband->cbs);
 		      }
@@ -1380,6 +1523,7 @@ GBool JPXStream::readCodestream(Guint len) {
   }
 
   //----- finish decoding the image
+  decodeCodeBlocks();
   for (i = 0; i < img.nXTiles * img.nYTiles; ++i) {
     tile = &img.tiles[i];
     for (comp = 0; comp < img.nComps; ++comp) {
@@ -1796,7 +1940,12 @@ GBool JPXStream::readTilePart() {
       } else {
 	n = tileComp->y1 - tileComp->y0;
       }
+#if HAVE_JPX_VECTOR
+      // room for n + 8 vectors, 16-byte aligned
+      tileComp->buf = (int *)gmallocn(n + 9, sizeof(JPXVector));
+#else
       tileComp->buf = (int *)gmallocn(n + 8, sizeof(int));
+#endif
       for (r = 0; r <= tileComp->nDecompLevels; ++r) {
 	resLevel = &tileComp->resLevels[r];
 	k = r == 0 ? tileComp->nDecompLevels
@@ -1909,8 +2058,10 @@ GBool JPXStream::readTilePart() {
 		  cb->coeffs[cbi].len = 0;
 		  cb->coeffs[cbi].mag = 0;
 		}
-		cb->arithDecoder = NULL;
-		cb->stats = NULL;
+		cb->data = NULL;
+		cb->dataSize = 0;
+		cb->packets = NULL;
+		cb->nPackets = 0;
 		++cb;
 	      }
 	    }
@@ -2135,10 +2286,7 @@ GBool JPXStream::readTilePartData(Guint tileIdx,
 	for (cbX = 0; cbX < subband->nXCBs; ++cbX) {
 	  cb = &subband->cbs[cbY * subband->nXCBs + cbX];
 	  if (cb->included) {
-	    if (!readCodeBlockData(tileComp, resLevel, precinct, subband,
-				   tile->res, sb, cb)) {
-	      return gFalse;
-	    }
+	    readCodeBlockData(cb);
 	    tilePartLen -= cb->dataLen;
 	    cb->seen = gTrue;
 	  }
@@ -2222,320 +2370,456 @@ GBool JPXStream::readTilePartData(Guint tileIdx,
   return gFalse;
 }
 
-GBool JPXStream::readCodeBlockData(JPXTileComp *tileComp,
-				   JPXResLevel *resLevel,
-				   JPXPrecinct *precinct,
-				   JPXSubband *subband,
-				   Guint res, Guint sb,
-				   JPXCodeBlock *cb) {
+// Append the data of the current packet to the code-block, to be
+// decoded by decodeCodeBlocks.
+void JPXStream::readCodeBlockData(JPXCodeBlock *cb) {
+  JPXCodeBlockPacket *packet;
+  int n;
+
+  cb->packets = (JPXCodeBlockPacket *)greallocn(cb->packets, cb->nPackets + 1,
+						sizeof(JPXCodeBlockPacket));
+  packet = &cb->packets[cb->nPackets++];
+  packet->nCodingPasses = cb->nCodingPasses;
+  packet->dataLen = cb->dataLen;
+  cb->data = (Guchar *)greallocn(cb->data, cb->dataSize + cb->dataLen, 1);
+  n = str->doGetChars(cb->dataLen, cb->data + cb->dataSize);
+  if (n < 0) {
+    n = 0;
+  }
+  // the arithmetic decoder reads 0xff past the end of the stream
+  memset(cb->data + cb->dataSize + n, 0xff, cb->dataLen - n);
+  cb->dataSize += cb->dataLen;
+}
+
+// Run the coding passes of all packets of <cb>, packet by packet, as
+// if reading them from the codestream.
+static void decodeCodeBlock(JPXTileComp *tileComp, Guint res, Guint sb,
+			    JPXCodeBlock *cb,
+			    JArithmeticDecoder *arithDecoder,
+			    JArithmeticDecoderStats *stats) {
   JPXCoeff *coeff0, *coeff1, *coeff;
   Guint horiz, vert, diag, all, cx, xorBit;
   int horizSign, vertSign;
-  Guint i, x, y0, y1, y2;
+  Guint pkt, i, x, y0, y1, y2;
 
-  if (cb->arithDecoder) {
-    cover(63);
-    cb->arithDecoder->restart(cb->dataLen);
-  } else {
-    cover(64);
-    cb->arithDecoder = new JArithmeticDecoder();
-    cb->arithDecoder->setStream(str, cb->dataLen);
-    cb->arithDecoder->start();
-    cb->stats = new JArithmeticDecoderStats(jpxNContexts);
-    cb->stats->setEntry(jpxContextSigProp, 4, 0);
-    cb->stats->setEntry(jpxContextRunLength, 3, 0);
-    cb->stats->setEntry(jpxContextUniform, 46, 0);
-  }
-
-  for (i = 0; i < cb->nCodingPasses; ++i) {
-    switch (cb->nextPass) {
-
-    //----- significance propagation pass
-    case jpxPassSigProp:
-      cover(65);
-      for (y0 = cb->y0, coeff0 = cb->coeffs;
-	   y0 < cb->y1;
-	   y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
-	for (x = cb->x0, coeff1 = coeff0;
-	     x < cb->x1;
-	     ++x, ++coeff1) {
-	  for (y1 = 0, coeff = coeff1;
-	       y1 < 4 && y0+y1 < cb->y1;
-	       ++y1, coeff += tileComp->cbW) {
-	    if (!(coeff->flags & jpxCoeffSignificant)) {
-	      horiz = vert = diag = 0;
-	      horizSign = vertSign = 2;
-	      if (x > cb->x0) {
-		if (coeff[-1].flags & jpxCoeffSignificant) {
-		  ++horiz;
-		  horizSign += (coeff[-1].flags & jpxCoeffSign) ? -1 : 1;
-		}
-		if (y0+y1 > cb->y0) {
-		  diag += (coeff[-(int)tileComp->cbW - 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-		if (y0+y1 < cb->y1 - 1) {
-		  diag += (coeff[tileComp->cbW - 1].flags
-			   >> jpxCoeffSignificantB) & 1;
+  stats->reset();
+  stats->setEntry(jpxContextSigProp, 4, 0);
+  stats->setEntry(jpxContextRunLength, 3, 0);
+  stats->setEntry(jpxContextUniform, 46, 0);
+
+  for (pkt = 0; pkt < cb->nPackets; ++pkt) {
+    if (pkt > 0) {
+      cover(63);
+      arithDecoder->restart(cb->packets[pkt].dataLen);
+    } else {
+      cover(64);
+      arithDecoder->setBuffer(cb->data, cb->dataSize,
+			      cb->packets[pkt].dataLen);
+      arithDecoder->start();
+    }
+
+    for (i = 0; i < cb->packets[pkt].nCodingPasses; ++i) {
+      switch (cb->nextPass) {
+
+      //----- significance propagation pass
+      case jpxPassSigProp:
+	cover(65);
+	for (y0 = cb->y0, coeff0 = cb->coeffs;
+	     y0 < cb->y1;
+	     y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
+	  for (x = cb->x0, coeff1 = coeff0;
+	       x < cb->x1;
+	       ++x, ++coeff1) {
+	    for (y1 = 0, coeff = coeff1;
+		 y1 < 4 && y0+y1 < cb->y1;
+		 ++y1, coeff += tileComp->cbW) {
+	      if (!(coeff->flags & jpxCoeffSignificant)) {
+		horiz = vert = diag = 0;
+		horizSign = vertSign = 2;
+		if (x > cb->x0) {
+		  if (coeff[-1].flags & jpxCoeffSignificant) {
+		    ++horiz;
+		    horizSign += (coeff[-1].flags & jpxCoeffSign) ? -1 : 1;
+		  }
+		  if (y0+y1 > cb->y0) {
+		    diag += (coeff[-(int)tileComp->cbW - 1].flags
+			     >> jpxCoeffSignificantB) & 1;
+		  }
+		  if (y0+y1 < cb->y1 - 1) {
+		    diag += (coeff[tileComp->cbW - 1].flags
+			     >> jpxCoeffSignificantB) & 1;
+		  }
 		}
-	      }
-	      if (x < cb->x1 - 1) {
-		if (coeff[1].flags & jpxCoeffSignificant) {
-		  ++horiz;
-		  horizSign += (coeff[1].flags & jpxCoeffSign) ? -1 : 1;
+		if (x < cb->x1 - 1) {
+		  if (coeff[1].flags & jpxCoeffSignificant) {
+		    ++horiz;
+		    horizSign += (coeff[1].flags & jpxCoeffSign) ? -1 : 1;
+		  }
+		  if (y0+y1 > cb->y0) {
+		    diag += (coeff[-(int)tileComp->cbW + 1].flags
+			     >> jpxCoeffSignificantB) & 1;
+		  }
+		  if (y0+y1 < cb->y1 - 1) {
+		    diag += (coeff[tileComp->cbW + 1].flags
+			     >> jpxCoeffSignificantB) & 1;
+		  }
 		}
 		if (y0+y1 > cb->y0) {
-		  diag += (coeff[-(int)tileComp->cbW + 1].flags
-			   >> jpxCoeffSignificantB) & 1;
+		  if (coeff[-(int)tileComp->cbW].flags & jpxCoeffSignificant) {
+		    ++vert;
+		    vertSign += (coeff[-(int)tileComp->cbW].flags & jpxCoeffSign)
+				? -1 : 1;
+		  }
 		}
 		if (y0+y1 < cb->y1 - 1) {
-		  diag += (coeff[tileComp->cbW + 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-	      }
-	      if (y0+y1 > cb->y0) {
-		if (coeff[-(int)tileComp->cbW].flags & jpxCoeffSignificant) {
-		  ++vert;
-		  vertSign += (coeff[-(int)tileComp->cbW].flags & jpxCoeffSign)
-		              ? -1 : 1;
+		  if (coeff[tileComp->cbW].flags & jpxCoeffSignificant) {
+		    ++vert;
+		    vertSign += (coeff[tileComp->cbW].flags & jpxCoeffSign)
+				? -1 : 1;
+		  }
 		}
-	      }
-	      if (y0+y1 < cb->y1 - 1) {
-		if (coeff[tileComp->cbW].flags & jpxCoeffSignificant) {
-		  ++vert;
-		  vertSign += (coeff[tileComp->cbW].flags & jpxCoeffSign)
-		              ? -1 : 1;
+		cx = sigPropContext[horiz][vert][diag][res == 0 ? 1 : sb];
+		if (cx != 0) {
+		  if (arithDecoder->decodeBit(cx, stats)) {
+		    coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
+		    coeff->mag = (coeff->mag << 1) | 1;
+		    cx = signContext[horizSign][vertSign][0];
+		    xorBit = signContext[horizSign][vertSign][1];
+		    if (arithDecoder->decodeBit(cx, stats) ^ xorBit) {
+		      coeff->flags |= jpxCoeffSign;
+		    }
+		  }
+		  ++coeff->len;
+		  coeff->flags |= jpxCoeffTouched;
 		}
 	      }
-	      cx = sigPropContext[horiz][vert][diag][res == 0 ? 1 : sb];
-	      if (cx != 0) {
-		if (cb->arithDecoder->decodeBit(cx, cb->stats)) {
-		  coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
-		  coeff->mag = (coeff->mag << 1) | 1;
-		  cx = signContext[horizSign][vertSign][0];
-		  xorBit = signContext[horizSign][vertSign][1];
-		  if (cb->arithDecoder->decodeBit(cx, cb->stats) ^ xorBit) {
-		    coeff->flags |= jpxCoeffSign;
+	    }
+	  }
+	}
+	++cb->nextPass;
+	break;
+
+      //----- magnitude refinement pass
+      case jpxPassMagRef:
+	cover(66);
+	for (y0 = cb->y0, coeff0 = cb->coeffs;
+	     y0 < cb->y1;
+	     y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
+	  for (x = cb->x0, coeff1 = coeff0;
+	       x < cb->x1;
+	       ++x, ++coeff1) {
+	    for (y1 = 0, coeff = coeff1;
+		 y1 < 4 && y0+y1 < cb->y1;
+		 ++y1, coeff += tileComp->cbW) {
+	      if ((coeff->flags & jpxCoeffSignificant) &&
+		  !(coeff->flags & jpxCoeffTouched)) {
+		if (coeff->flags & jpxCoeffFirstMagRef) {
+		  all = 0;
+		  if (x > cb->x0) {
+		    all += (coeff[-1].flags >> jpxCoeffSignificantB) & 1;
+		    if (y0+y1 > cb->y0) {
+		      all += (coeff[-(int)tileComp->cbW - 1].flags
+			      >> jpxCoeffSignificantB) & 1;
+		    }
+		    if (y0+y1 < cb->y1 - 1) {
+		      all += (coeff[tileComp->cbW - 1].flags
+			      >> jpxCoeffSignificantB) & 1;
+		    }
 		  }
+		  if (x < cb->x1 - 1) {
+		    all += (coeff[1].flags >> jpxCoeffSignificantB) & 1;
+		    if (y0+y1 > cb->y0) {
+		      all += (coeff[-(int)tileComp->cbW + 1].flags
+			      >> jpxCoeffSignificantB) & 1;
+		    }
+		    if (y0+y1 < cb->y1 - 1) {
+		      all += (coeff[tileComp->cbW + 1].flags
+			      >> jpxCoeffSignificantB) & 1;
+		    }
+		  }
+		  if (y0+y1 > cb->y0) {
+		    all += (coeff[-(int)tileComp->cbW].flags
+			    >> jpxCoeffSignificantB) & 1;
+		  }
+		  if (y0+y1 < cb->y1 - 1) {
+		    all += (coeff[tileComp->cbW].flags
+			    >> jpxCoeffSignificantB) & 1;
+		  }
+		  cx = all ? 15 : 14;
+		} else {
+		  cx = 16;
 		}
+		coeff->mag = (coeff->mag << 1) |
+			     arithDecoder->decodeBit(cx, stats);
 		++coeff->len;
 		coeff->flags |= jpxCoeffTouched;
+		coeff->flags &= ~jpxCoeffFirstMagRef;
 	      }
 	    }
 	  }
 	}
-      }
-      ++cb->nextPass;
-      break;
+	++cb->nextPass;
+	break;
 
-    //----- magnitude refinement pass
-    case jpxPassMagRef:
-      cover(66);
-      for (y0 = cb->y0, coeff0 = cb->coeffs;
-	   y0 < cb->y1;
-	   y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
-	for (x = cb->x0, coeff1 = coeff0;
-	     x < cb->x1;
-	     ++x, ++coeff1) {
-	  for (y1 = 0, coeff = coeff1;
-	       y1 < 4 && y0+y1 < cb->y1;
-	       ++y1, coeff += tileComp->cbW) {
-	    if ((coeff->flags & jpxCoeffSignificant) &&
-		!(coeff->flags & jpxCoeffTouched)) {
-	      if (coeff->flags & jpxCoeffFirstMagRef) {
-		all = 0;
+      //----- cleanup pass
+      case jpxPassCleanup:
+	cover(67);
+	for (y0 = cb->y0, coeff0 = cb->coeffs;
+	     y0 < cb->y1;
+	     y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
+	  for (x = cb->x0, coeff1 = coeff0;
+	       x < cb->x1;
+	       ++x, ++coeff1) {
+	    y1 = 0;
+	    if (y0 + 3 < cb->y1 &&
+		!(coeff1->flags & jpxCoeffTouched) &&
+		!(coeff1[tileComp->cbW].flags & jpxCoeffTouched) &&
+		!(coeff1[2 * tileComp->cbW].flags & jpxCoeffTouched) &&
+		!(coeff1[3 * tileComp->cbW].flags & jpxCoeffTouched) &&
+		(x == cb->x0 || y0 == cb->y0 ||
+		 !(coeff1[-(int)tileComp->cbW - 1].flags
+		   & jpxCoeffSignificant)) &&
+		(y0 == cb->y0 ||
+		 !(coeff1[-(int)tileComp->cbW].flags
+		   & jpxCoeffSignificant)) &&
+		(x == cb->x1 - 1 || y0 == cb->y0 ||
+		 !(coeff1[-(int)tileComp->cbW + 1].flags
+		   & jpxCoeffSignificant)) &&
+		(x == cb->x0 ||
+		 (!(coeff1[-1].flags & jpxCoeffSignificant) &&
+		  !(coeff1[tileComp->cbW - 1].flags
+		    & jpxCoeffSignificant) &&
+		  !(coeff1[2 * tileComp->cbW - 1].flags
+		    & jpxCoeffSignificant) && 
+		  !(coeff1[3 * tileComp->cbW - 1].flags
+		    & jpxCoeffSignificant))) &&
+		(x == cb->x1 - 1 ||
+		 (!(coeff1[1].flags & jpxCoeffSignificant) &&
+		  !(coeff1[tileComp->cbW + 1].flags
+		    & jpxCoeffSignificant) &&
+		  !(coeff1[2 * tileComp->cbW + 1].flags
+		    & jpxCoeffSignificant) &&
+		  !(coeff1[3 * tileComp->cbW + 1].flags
+		    & jpxCoeffSignificant))) &&
+		(x == cb->x0 || y0+4 == cb->y1 ||
+		 !(coeff1[4 * tileComp->cbW - 1].flags & jpxCoeffSignificant)) &&
+		(y0+4 == cb->y1 ||
+		 !(coeff1[4 * tileComp->cbW].flags & jpxCoeffSignificant)) &&
+		(x == cb->x1 - 1 || y0+4 == cb->y1 ||
+		 !(coeff1[4 * tileComp->cbW + 1].flags
+		   & jpxCoeffSignificant))) {
+	      if (arithDecoder->decodeBit(jpxContextRunLength, stats)) {
+		y1 = arithDecoder->decodeBit(jpxContextUniform, stats);
+		y1 = (y1 << 1) |
+		     arithDecoder->decodeBit(jpxContextUniform, stats);
+		for (y2 = 0, coeff = coeff1;
+		     y2 < y1;
+		     ++y2, coeff += tileComp->cbW) {
+		  ++coeff->len;
+		}
+		coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
+		coeff->mag = (coeff->mag << 1) | 1;
+		++coeff->len;
+		cx = signContext[2][2][0];
+		xorBit = signContext[2][2][1];
+		if (arithDecoder->decodeBit(cx, stats) ^ xorBit) {
+		  coeff->flags |= jpxCoeffSign;
+		}
+		++y1;
+	      } else {
+		for (y1 = 0, coeff = coeff1;
+		     y1 < 4;
+		     ++y1, coeff += tileComp->cbW) {
+		  ++coeff->len;
+		}
+		y1 = 4;
+	      }
+	    }
+	    for (coeff = &coeff1[y1 << tileComp->codeBlockW];
+		 y1 < 4 && y0 + y1 < cb->y1;
+		 ++y1, coeff += tileComp->cbW) {
+	      if (!(coeff->flags & jpxCoeffTouched)) {
+		horiz = vert = diag = 0;
+		horizSign = vertSign = 2;
 		if (x > cb->x0) {
-		  all += (coeff[-1].flags >> jpxCoeffSignificantB) & 1;
+		  if (coeff[-1].flags & jpxCoeffSignificant) {
+		    ++horiz;
+		    horizSign += (coeff[-1].flags & jpxCoeffSign) ? -1 : 1;
+		  }
 		  if (y0+y1 > cb->y0) {
-		    all += (coeff[-(int)tileComp->cbW - 1].flags
-			    >> jpxCoeffSignificantB) & 1;
+		    diag += (coeff[-(int)tileComp->cbW - 1].flags
+			     >> jpxCoeffSignificantB) & 1;
 		  }
 		  if (y0+y1 < cb->y1 - 1) {
-		    all += (coeff[tileComp->cbW - 1].flags
-			    >> jpxCoeffSignificantB) & 1;
+		    diag += (coeff[tileComp->cbW - 1].flags
+			     >> jpxCoeffSignificantB) & 1;
 		  }
 		}
 		if (x < cb->x1 - 1) {
-		  all += (coeff[1].flags >> jpxCoeffSignificantB) & 1;
+		  if (coeff[1].flags & jpxCoeffSignificant) {
+		    ++horiz;
+		    horizSign += (coeff[1].flags & jpxCoeffSign) ? -1 : 1;
+		  }
 		  if (y0+y1 > cb->y0) {
-		    all += (coeff[-(int)tileComp->cbW + 1].flags
-			    >> jpxCoeffSignificantB) & 1;
+		    diag += (coeff[-(int)tileComp->cbW + 1].flags
+			     >> jpxCoeffSignificantB) & 1;
 		  }
 		  if (y0+y1 < cb->y1 - 1) {
-		    all += (coeff[tileComp->cbW + 1].flags
-			    >> jpxCoeffSignificantB) & 1;
+		    diag += (coeff[tileComp->cbW + 1].flags
+			     >> jpxCoeffSignificantB) & 1;
 		  }
 		}
 		if (y0+y1 > cb->y0) {
-		  all += (coeff[-(int)tileComp->cbW].flags
-			  >> jpxCoeffSignificantB) & 1;
+		  if (coeff[-(int)tileComp->cbW].flags & jpxCoeffSignificant) {
+		    ++vert;
+		    vertSign += (coeff[-(int)tileComp->cbW].flags & jpxCoeffSign)
+				? -1 : 1;
+		  }
 		}
 		if (y0+y1 < cb->y1 - 1) {
-		  all += (coeff[tileComp->cbW].flags
-			  >> jpxCoeffSignificantB) & 1;
+		  if (coeff[tileComp->cbW].flags & jpxCoeffSignificant) {
+		    ++vert;
+		    vertSign += (coeff[tileComp->cbW].flags & jpxCoeffSign)
+				? -1 : 1;
+		  }
+		}
+		cx = sigPropContext[horiz][vert][diag][res == 0 ? 1 : sb];
+		if (arithDecoder->decodeBit(cx, stats)) {
+		  coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
+		  coeff->mag = (coeff->mag << 1) | 1;
+		  cx = signContext[horizSign][vertSign][0];
+		  xorBit = signContext[horizSign][vertSign][1];
+		  if (arithDecoder->decodeBit(cx, stats) ^ xorBit) {
+		    coeff->flags |= jpxCoeffSign;
+		  }
 		}
-		cx = all ? 15 : 14;
+		++coeff->len;
 	      } else {
-		cx = 16;
+		coeff->flags &= ~jpxCoeffTouched;
 	      }
-	      coeff->mag = (coeff->mag << 1) |
-		           cb->arithDecoder->decodeBit(cx, cb->stats);
-	      ++coeff->len;
-	      coeff->flags |= jpxCoeffTouched;
-	      coeff->flags &= ~jpxCoeffFirstMagRef;
 	    }
 	  }
 	}
+	cb->nextPass = jpxPassSigProp;
+	break;
       }
-      ++cb->nextPass;
-      break;
+    }
 
-    //----- cleanup pass
-    case jpxPassCleanup:
-      cover(67);
-      for (y0 = cb->y0, coeff0 = cb->coeffs;
-	   y0 < cb->y1;
-	   y0 += 4, coeff0 += 4 << tileComp->codeBlockW) {
-	for (x = cb->x0, coeff1 = coeff0;
-	     x < cb->x1;
-	     ++x, ++coeff1) {
-	  y1 = 0;
-	  if (y0 + 3 < cb->y1 &&
-	      !(coeff1->flags & jpxCoeffTouched) &&
-	      !(coeff1[tileComp->cbW].flags & jpxCoeffTouched) &&
-	      !(coeff1[2 * tileComp->cbW].flags & jpxCoeffTouched) &&
-	      !(coeff1[3 * tileComp->cbW].flags & jpxCoeffTouched) &&
-	      (x == cb->x0 || y0 == cb->y0 ||
-	       !(coeff1[-(int)tileComp->cbW - 1].flags
-		 & jpxCoeffSignificant)) &&
-	      (y0 == cb->y0 ||
-	       !(coeff1[-(int)tileComp->cbW].flags
-		 & jpxCoeffSignificant)) &&
-	      (x == cb->x1 - 1 || y0 == cb->y0 ||
-	       !(coeff1[-(int)tileComp->cbW + 1].flags
-		 & jpxCoeffSignificant)) &&
-	      (x == cb->x0 ||
-	       (!(coeff1[-1].flags & jpxCoeffSignificant) &&
-		!(coeff1[tileComp->cbW - 1].flags
-		  & jpxCoeffSignificant) &&
-		!(coeff1[2 * tileComp->cbW - 1].flags
-		  & jpxCoeffSignificant) && 
-		!(coeff1[3 * tileComp->cbW - 1].flags
-		  & jpxCoeffSignificant))) &&
-	      (x == cb->x1 - 1 ||
-	       (!(coeff1[1].flags & jpxCoeffSignificant) &&
-		!(coeff1[tileComp->cbW + 1].flags
-		  & jpxCoeffSignificant) &&
-		!(coeff1[2 * tileComp->cbW + 1].flags
-		  & jpxCoeffSignificant) &&
-		!(coeff1[3 * tileComp->cbW + 1].flags
-		  & jpxCoeffSignificant))) &&
-	      (x == cb->x0 || y0+4 == cb->y1 ||
-	       !(coeff1[4 * tileComp->cbW - 1].flags & jpxCoeffSignificant)) &&
-	      (y0+4 == cb->y1 ||
-	       !(coeff1[4 * tileComp->cbW].flags & jpxCoeffSignificant)) &&
-	      (x == cb->x1 - 1 || y0+4 == cb->y1 ||
-	       !(coeff1[4 * tileComp->cbW + 1].flags
-		 & jpxCoeffSignificant))) {
-	    if (cb->arithDecoder->decodeBit(jpxContextRunLength, cb->stats)) {
-	      y1 = cb->arithDecoder->decodeBit(jpxContextUniform, cb->stats);
-	      y1 = (y1 << 1) |
-		   cb->arithDecoder->decodeBit(jpxContextUniform, cb->stats);
-	      for (y2 = 0, coeff = coeff1;
-		   y2 < y1;
-		   ++y2, coeff += tileComp->cbW) {
-		++coeff->len;
-	      }
-	      coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
-	      coeff->mag = (coeff->mag << 1) | 1;
-	      ++coeff->len;
-	      cx = signContext[2][2][0];
-	      xorBit = signContext[2][2][1];
-	      if (cb->arithDecoder->decodeBit(cx, cb->stats) ^ xorBit) {
-		coeff->flags |= jpxCoeffSign;
-	      }
-	      ++y1;
-	    } else {
-	      for (y1 = 0, coeff = coeff1;
-		   y1 < 4;
-		   ++y1, coeff += tileComp->cbW) {
-		++coeff->len;
-	      }
-	      y1 = 4;
-	    }
-	  }
-	  for (coeff = &coeff1[y1 << tileComp->codeBlockW];
-	       y1 < 4 && y0 + y1 < cb->y1;
-	       ++y1, coeff += tileComp->cbW) {
-	    if (!(coeff->flags & jpxCoeffTouched)) {
-	      horiz = vert = diag = 0;
-	      horizSign = vertSign = 2;
-	      if (x > cb->x0) {
-		if (coeff[-1].flags & jpxCoeffSignificant) {
-		  ++horiz;
-		  horizSign += (coeff[-1].flags & jpxCoeffSign) ? -1 : 1;
-		}
-		if (y0+y1 > cb->y0) {
-		  diag += (coeff[-(int)tileComp->cbW - 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-		if (y0+y1 < cb->y1 - 1) {
-		  diag += (coeff[tileComp->cbW - 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-	      }
-	      if (x < cb->x1 - 1) {
-		if (coeff[1].flags & jpxCoeffSignificant) {
-		  ++horiz;
-		  horizSign += (coeff[1].flags & jpxCoeffSign) ? -1 : 1;
-		}
-		if (y0+y1 > cb->y0) {
-		  diag += (coeff[-(int)tileComp->cbW + 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-		if (y0+y1 < cb->y1 - 1) {
-		  diag += (coeff[tileComp->cbW + 1].flags
-			   >> jpxCoeffSignificantB) & 1;
-		}
-	      }
-	      if (y0+y1 > cb->y0) {
-		if (coeff[-(int)tileComp->cbW].flags & jpxCoeffSignificant) {
-		  ++vert;
-		  vertSign += (coeff[-(int)tileComp->cbW].flags & jpxCoeffSign)
-		              ? -1 : 1;
-		}
-	      }
-	      if (y0+y1 < cb->y1 - 1) {
-		if (coeff[tileComp->cbW].flags & jpxCoeffSignificant) {
-		  ++vert;
-		  vertSign += (coeff[tileComp->cbW].flags & jpxCoeffSign)
-		              ? -1 : 1;
-		}
+    arithDecoder->cleanup();
+  }
+}
+
+struct JPXCodeBlockJob {
+  JPXTileComp *tileComp;
+  Guint res, sb;
+  JPXCodeBlock *cb;
+};
+
+struct JPXCodeBlockJobList {
+  JPXCodeBlockJob *jobs;
+  int nJobs;
+  int next;			// next job to take
+};
+
+static void *decodeCodeBlocksThread(void *arg) {
+  GMemScope memScope(gMemTagStreams);
+  JPXCodeBlockJobList *list = (JPXCodeBlockJobList *)arg;
+  JPXCodeBlockJob *job;
+  JArithmeticDecoder *arithDecoder;
+  JArithmeticDecoderStats *stats;
+  int i;
+
+  arithDecoder = new JArithmeticDecoder();
+  stats = new JArithmeticDecoderStats(jpxNContexts);
+#if MULTITHREADED
+  while ((i = __sync_fetch_and_add(&list->next, 1)) < list->nJobs) {
+#else
+  while ((i = list->next++) < list->nJobs) {
+#endif
+    job = &list->jobs[i];
+    decodeCodeBlock(job->tileComp, job->res, job->sb, job->cb,
+		    arithDecoder, stats);
+  }
+  delete stats;
+  delete arithDecoder;
+  return NULL;
+}
+
+// Decode the code-blocks of all tiles.  Each one only depends on its
+// own data, so they are spread over the CPUs.
+void JPXStream::decodeCodeBlocks() {
+  JPXCodeBlockJobList list;
+  JPXCodeBlockJob *job;
+  JPXTile *tile;
+  JPXTileComp *tileComp;
+  JPXPrecinct *precinct;
+  JPXSubband *subband;
+  Guint i, comp, r, pre, sb, k;
+#if MULTITHREADED
+  pthread_t *threads;
+  int nThreads, nStarted, j;
+#endif
+
+  list.jobs = NULL;
+  list.nJobs = 0;
+  list.next = 0;
+  for (i = 0; i < img.nXTiles * img.nYTiles; ++i) {
+    tile = &img.tiles[i];
+    for (comp = 0; comp < img.nComps; ++comp) {
+      tileComp = &tile->tileComps[comp];
+      for (r = 0; r <= tileComp->nDecompLevels; ++r) {
+	for (pre = 0; pre < 1; ++pre) {
+	  precinct = &tileComp->resLevels[r].precincts[pre];
+	  for (sb = 0; sb < (Guint)(r == 0 ? 1 : 3); ++sb) {
+	    subband = &precinct->subbands[sb];
+	    for (k = 0; k < subband->nXCBs * subband->nYCBs; ++k) {
+	      if (!subband->cbs[k].nPackets) {
+		continue;
 	      }
-	      cx = sigPropContext[horiz][vert][diag][res == 0 ? 1 : sb];
-	      if (cb->arithDecoder->decodeBit(cx, cb->stats)) {
-		coeff->flags |= jpxCoeffSignificant | jpxCoeffFirstMagRef;
-		coeff->mag = (coeff->mag << 1) | 1;
-		cx = signContext[horizSign][vertSign][0];
-		xorBit = signContext[horizSign][vertSign][1];
-		if (cb->arithDecoder->decodeBit(cx, cb->stats) ^ xorBit) {
-		  coeff->flags |= jpxCoeffSign;
-		}
+	      if (!(list.nJobs & 255)) {
+		list.jobs = (JPXCodeBlockJob *)greallocn(list.jobs,
+							 list.nJobs + 256,
+							 sizeof(JPXCodeBlockJob));
 	      }
-	      ++coeff->len;
-	    } else {
-	      coeff->flags &= ~jpxCoeffTouched;
+	      job = &list.jobs[list.nJobs++];
+	      job->tileComp = tileComp;
+	      job->res = r;
+	      job->sb = sb;
+	      job->cb = &subband->cbs[k];
 	    }
 	  }
 	}
       }
-      cb->nextPass = jpxPassSigProp;
-      break;
     }
   }
 
-  cb->arithDecoder->cleanup();
-  return gTrue;
+#if MULTITHREADED
+  nThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (nThreads > jpxMaxThreads) {
+    nThreads = jpxMaxThreads;
+  }
+  if (nThreads > list.nJobs / jpxMinCodeBlocksPerThread) {
+    nThreads = list.nJobs / jpxMinCodeBlocksPerThread;
+  }
+  threads = (pthread_t *)gmallocn(nThreads > 1 ? nThreads - 1 : 1,
+				  sizeof(pthread_t));
+  nStarted = 0;
+  for (j = 0; j < nThreads - 1; ++j) {
+    if (pthread_create(&threads[nStarted], NULL,
+		       &decodeCodeBlocksThread, &list) == 0) {
+      ++nStarted;
+    }
+  }
+  decodeCodeBlocksThread(&list);
+  for (j = 0; j < nStarted; ++j) {
+    pthread_join(threads[j], NULL);
+  }
+  gfree(threads);
+#else
+  decodeCodeBlocksThread(&list);
+#endif
+
+  gfree(list.jobs);
 }
 
 // Inverse quantization, and wavelet transform (IDWT).  This also does
@@ -2667,7 +2951,10 @@ void JPXStream::inverseTransformLevel(JPXTileComp *tileComp,
   double mu;
   int val;
   int *dataPtr;
-  Guint xo, yo;
+#if HAVE_JPX_VECTOR
+  JPXVector *vecBuf;
+#endif
+  Guint xo, yo, w;
   Guint x, y, sb, cbX, cbY;
   int xx, yy;
 
@@ -2760,18 +3047,42 @@ void JPXStream::inverseTransformLevel(JPXTileComp *tileComp,
     }
   }
 
+  w = tileComp->x1 - tileComp->x0;
+#if HAVE_JPX_VECTOR
+  vecBuf = (JPXVector *)(((size_t)tileComp->buf + 15) & ~(size_t)15);
+#endif
+
   //----- horizontal (row) transforms
   dataPtr = tileComp->data;
-  for (y = 0; y < ny1 - ny0; ++y) {
+  y = 0;
+#if HAVE_JPX_VECTOR
+  if (nx1 - nx0 > 1) {
+    for (; y + 4 <= ny1 - ny0; y += 4) {
+      jpxInverseTransform1DVector(tileComp->transform, dataPtr, 1, w,
+				  nx0, nx1, vecBuf);
+      dataPtr += 4 * w;
+    }
+  }
+#endif
+  for (; y < ny1 - ny0; ++y) {
     inverseTransform1D(tileComp, dataPtr, 1, nx0, nx1);
-    dataPtr += tileComp->x1 - tileComp->x0;
+    dataPtr += w;
   }
 
   //----- vertical (column) transforms
   dataPtr = tileComp->data;
-  for (x = 0; x < nx1 - nx0; ++x) {
-    inverseTransform1D(tileComp, dataPtr,
-		       tileComp->x1 - tileComp->x0, ny0, ny1);
+  x = 0;
+#if HAVE_JPX_VECTOR
+  if (ny1 - ny0 > 1) {
+    for (; x + 4 <= nx1 - nx0; x += 4) {
+      jpxInverseTransform1DVector(tileComp->transform, dataPtr, w, 1,
+				  ny0, ny1, vecBuf);
+      dataPtr += 4;
+    }
+  }
+#endif
+  for (; x < nx1 - nx0; ++x) {
+    inverseTransform1D(tileComp, dataPtr, w, ny0, ny1);
     ++dataPtr;
   }
 }
@@ -17,9 +17,6 @@
 #include "Object.h"
 #include "Stream.h"
 
-class JArithmeticDecoder;
-class JArithmeticDecoderStats;
-
 //------------------------------------------------------------------------
 
 enum JPXColorSpaceType {
@@ -117,6 +114,11 @@ struct JPXCoeff {
 
 //------------------------------------------------------------------------
 
+struct JPXCodeBlockPacket {
+  Guint nCodingPasses;		// number of coding passes in the packet
+  Guint dataLen;		// packet data length
+};
+
 struct JPXCodeBlock {
   //----- size
   Guint x0, y0, x1, y1;		// bounds
@@ -136,12 +138,15 @@ struct JPXCodeBlock {
   Guint nCodingPasses;		// number of coding passes in this pkt
   Guint dataLen;		// pkt data length
 
+  //----- data from all packets, decoded once the codestream is read
+  Guchar *data;			// the packet data, concatenated
+  Guint dataSize;		// number of bytes in <data>
+  JPXCodeBlockPacket *packets;	// the packets that included this
+				//   code-block
+  Guint nPackets;		// number of entries in <packets>
+
   //----- coefficient data
   JPXCoeff *coeffs;		// the coefficients
-  JArithmeticDecoder		// arithmetic decoder
-    *arithDecoder;
-  JArithmeticDecoderStats	// arithmetic decoder stats
-    *stats;
 };
 
 //------------------------------------------------------------------------
@@ -294,12 +299,8 @@ private:
   GBool readTilePart();
   GBool readTilePartData(Guint tileIdx,
 			 Guint tilePartLen, GBool tilePartToEOC);
-  GBool readCodeBlockData(JPXTileComp *tileComp,
-			  JPXResLevel *resLevel,
-			  JPXPrecinct *precinct,
-			  JPXSubband *subband,
-			  Guint res, Guint sb,
-			  JPXCodeBlock *cb);
+  void readCodeBlockData(JPXCodeBlock *cb);
+  void decodeCodeBlocks();
   void inverseTransform(JPXTileComp *tileComp);
   void inverseTransformLevel(JPXTileComp *tileComp,
 			     Guint r, JPXResLevel *resLevel,
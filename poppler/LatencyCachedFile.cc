@@ -0,0 +1,46 @@
+//========================================================================
+//
+// LatencyCachedFile.cc
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#include "LatencyCachedFile.h"
+
+#include <unistd.h>
+
+//------------------------------------------------------------------------
+// LatencyCachedFileLoader
+//------------------------------------------------------------------------
+
+LatencyCachedFileLoader::LatencyCachedFileLoader(CachedFileLoader *loaderA,
+						 int latencyA)
+{
+  loader = loaderA;
+  latency = latencyA;
+}
+
+LatencyCachedFileLoader::~LatencyCachedFileLoader()
+{
+  delete loader;
+}
+
+size_t LatencyCachedFileLoader::init(GooString *uri, CachedFile *cachedFile)
+{
+  if (latency > 0) {
+    usleep(latency);
+  }
+  return loader->init(uri, cachedFile);
+}
+
+int LatencyCachedFileLoader::load(const std::vector<ByteRange> &ranges,
+				  CachedFileWriter *writer)
+{
+  if (latency > 0) {
+    usleep(latency);
+  }
+  return loader->load(ranges, writer);
+}
@@ -0,0 +1,41 @@
+//========================================================================
+//
+// LatencyCachedFile.h
+//
+// Caching files support.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef LATENCYCACHEDFILE_H
+#define LATENCYCACHEDFILE_H
+
+#include "CachedFile.h"
+
+//------------------------------------------------------------------------
+// LatencyCachedFileLoader
+//
+// Wraps another loader and sleeps <latency> microseconds before each
+// call to it, to stand in for remote or slow block storage when
+// measuring how many round trips a document takes.
+//------------------------------------------------------------------------
+
+class LatencyCachedFileLoader : public CachedFileLoader {
+
+public:
+
+  // Takes ownership of <loaderA>.
+  LatencyCachedFileLoader(CachedFileLoader *loaderA, int latencyA);
+  ~LatencyCachedFileLoader();
+  size_t init(GooString *uri, CachedFile *cachedFile);
+  int load(const std::vector<ByteRange> &ranges, CachedFileWriter *writer);
+
+private:
+
+  CachedFileLoader *loader;
+  int latency;			// in microseconds
+
+};
+
+#endif
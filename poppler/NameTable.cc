@@ -0,0 +1,313 @@
+//========================================================================
+//
+// NameTable.cc
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifdef USE_GCC_PRAGMAS
+#pragma implementation
+#endif
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gmem.h"
+#include "NameTable.h"
+
+#if MULTITHREADED
+#include <pthread.h>
+static pthread_mutex_t nameTableMutex = PTHREAD_MUTEX_INITIALIZER;
+#  define lockNameTable   pthread_mutex_lock(&nameTableMutex)
+#  define unlockNameTable pthread_mutex_unlock(&nameTableMutex)
+// entries and tables are published to readers that don't take the lock
+#  define loadPtr(p)     __atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#  define storePtr(p, e) __atomic_store_n(&(p), (e), __ATOMIC_RELEASE)
+#else
+#  define lockNameTable
+#  define unlockNameTable
+#  define loadPtr(p)     (p)
+#  define storePtr(p, e) ((p) = (e))
+#endif
+
+//------------------------------------------------------------------------
+
+struct NameTableEntry {
+  Guint hash;
+  char name[1];			// actually longer
+};
+
+// Open addressing table of entries, at most half full.  When it fills
+// up, a table twice the size replaces it.  Readers may still be probing
+// the old one, so it is kept, on the <prev> list, until the names are
+// freed.
+struct NameTableSlots {
+  NameTableSlots *prev;
+  Guint size;			// a power of 2
+  Guint len;
+  NameTableEntry *entries[1];	// actually <size>
+};
+
+#define nameTableInitialSize 4096
+
+// names are carved out of large chunks; each chunk starts with a
+// pointer to the previous one
+#define nameChunkSize 65536
+
+static NameTableSlots *nameTable = NULL;
+static char *nameChunks = NULL;
+static char *nameChunk = NULL;
+static size_t nameChunkFree = 0;
+static int nameTableRefCnt = 0;
+
+static inline Guint hashName(const char *name, size_t *len) {
+  const char *p;
+  Guint h;
+
+  h = 2166136261u;
+  for (p = name; *p; ++p) {
+    h = (h ^ (Guchar)*p) * 16777619u;
+  }
+  *len = p - name;
+  return h;
+}
+
+static inline NameTableEntry *findEntry(NameTableSlots *t, const char *name,
+					Guint h) {
+  NameTableEntry *e;
+  Guint i;
+
+  if (!t) {
+    return NULL;
+  }
+  for (i = h & (t->size - 1);
+       (e = loadPtr(t->entries[i]));
+       i = (i + 1) & (t->size - 1)) {
+    if (e->hash == h && !strcmp(e->name, name)) {
+      return e;
+    }
+  }
+  return NULL;
+}
+
+static void *nameTableAlloc(size_t size) {
+  void *p;
+
+  if (!(p = malloc(size))) {
+    fprintf(stderr, "Out of memory\n");
+    exit(1);
+  }
+  return p;
+}
+
+static NameTableEntry *newEntry(const char *name, size_t len) {
+  char *chunk;
+  size_t size;
+
+  // keep entries pointer aligned
+  size = (offsetof(NameTableEntry, name) + len + 1 + sizeof(void *) - 1) &
+         ~(sizeof(void *) - 1);
+  if (size > nameChunkFree) {
+    if (size > nameChunkSize / 4) {
+      // a chunk of its own, leaving the current one in use
+      chunk = (char *)nameTableAlloc(sizeof(char *) + size);
+      *(char **)chunk = nameChunks;
+      nameChunks = chunk;
+      return (NameTableEntry *)(chunk + sizeof(char *));
+    }
+    chunk = (char *)nameTableAlloc(nameChunkSize);
+    *(char **)chunk = nameChunks;
+    nameChunks = chunk;
+    nameChunk = chunk + sizeof(char *);
+    nameChunkFree = nameChunkSize - sizeof(char *);
+  }
+  chunk = nameChunk;
+  nameChunk += size;
+  nameChunkFree -= size;
+  return (NameTableEntry *)chunk;
+}
+
+static NameTableSlots *newSlots(Guint size) {
+  NameTableSlots *t;
+
+  t = (NameTableSlots *)nameTableAlloc(offsetof(NameTableSlots, entries) +
+				       size * sizeof(NameTableEntry *));
+  t->prev = NULL;
+  t->size = size;
+  t->len = 0;
+  memset(t->entries, 0, size * sizeof(NameTableEntry *));
+  return t;
+}
+
+static void insertEntry(NameTableSlots *t, NameTableEntry *e) {
+  Guint i;
+
+  for (i = e->hash & (t->size - 1);
+       t->entries[i];
+       i = (i + 1) & (t->size - 1)) ;
+  storePtr(t->entries[i], e);
+  ++t->len;
+}
+
+// Called with the lock held.
+static void growNameTable() {
+  NameTableSlots *t;
+  Guint i;
+
+  if (!nameTable) {
+    storePtr(nameTable, newSlots(nameTableInitialSize));
+    return;
+  }
+  t = newSlots(2 * nameTable->size);
+  for (i = 0; i < nameTable->size; ++i) {
+    if (nameTable->entries[i]) {
+      insertEntry(t, nameTable->entries[i]);
+    }
+  }
+  t->prev = nameTable;
+  storePtr(nameTable, t);
+}
+
+// Called with the lock held, when no objects use the names any more.
+static void freeNameTable() {
+  NameTableSlots *t;
+  char *chunk;
+
+  while ((t = nameTable)) {
+    nameTable = t->prev;
+    free(t);
+  }
+  while ((chunk = nameChunks)) {
+    nameChunks = *(char **)chunk;
+    free(chunk);
+  }
+  nameChunk = NULL;
+  nameChunkFree = 0;
+}
+
+const char *NameTable::intern(const char *name) {
+  NameTableEntry *e;
+  size_t len;
+  Guint h;
+
+  h = hashName(name, &len);
+  if ((e = findEntry(loadPtr(nameTable), name, h))) {
+    return e->name;
+  }
+  lockNameTable;
+  // another thread may have added it in the meantime, possibly to a
+  // table that has replaced the one searched above
+  if (!(e = findEntry(nameTable, name, h))) {
+    if (!nameTable || 2 * (nameTable->len + 1) > nameTable->size) {
+      growNameTable();
+    }
+    e = newEntry(name, len);
+    e->hash = h;
+    memcpy(e->name, name, len + 1);
+    insertEntry(nameTable, e);
+  }
+  unlockNameTable;
+  return e->name;
+}
+
+const char *NameTable::lookup(const char *name) {
+  NameTableEntry *e;
+  size_t len;
+  Guint h;
+
+  // a table that has been replaced still has every name added before
+  h = hashName(name, &len);
+  e = findEntry(loadPtr(nameTable), name, h);
+  return e ? e->name : (const char *)NULL;
+}
+
+void NameTable::retain() {
+  lockNameTable;
+  ++nameTableRefCnt;
+  unlockNameTable;
+}
+
+void NameTable::release() {
+  lockNameTable;
+  if (--nameTableRefCnt == 0) {
+    freeNameTable();
+  }
+  unlockNameTable;
+}
+
+//------------------------------------------------------------------------
+// NameIndex
+//------------------------------------------------------------------------
+
+// Fibonacci hashing of the address; the top bits are the best mixed.
+#define nameIndexHash(name, shift) \
+  ((Guint)((Guint)((size_t)(name) >> 3) * 2654435769u) >> (shift))
+
+NameIndex::NameIndex() {
+  size = 16;
+  shift = 32 - 4;
+  len = 0;
+  keys = (const char **)gmallocn(size, sizeof(const char *));
+  vals = (int *)gmallocn(size, sizeof(int));
+  memset(keys, 0, size * sizeof(const char *));
+}
+
+NameIndex::~NameIndex() {
+  gfree(keys);
+  gfree(vals);
+}
+
+int NameIndex::lookup(const char *name) {
+  int h;
+
+  for (h = nameIndexHash(name, shift); keys[h]; h = (h + 1) & (size - 1)) {
+    if (keys[h] == name) {
+      return vals[h];
+    }
+  }
+  return -1;
+}
+
+void NameIndex::add(const char *name, int val) {
+  int h;
+
+  if (2 * (len + 1) > size) {
+    grow();
+  }
+  for (h = nameIndexHash(name, shift); keys[h]; h = (h + 1) & (size - 1)) {
+    if (keys[h] == name) {
+      vals[h] = val;
+      return;
+    }
+  }
+  keys[h] = name;
+  vals[h] = val;
+  ++len;
+}
+
+void NameIndex::grow() {
+  const char **oldKeys;
+  int *oldVals;
+  int oldSize, i, h;
+
+  oldKeys = keys;
+  oldVals = vals;
+  oldSize = size;
+  size *= 2;
+  --shift;
+  keys = (const char **)gmallocn(size, sizeof(const char *));
+  vals = (int *)gmallocn(size, sizeof(int));
+  memset(keys, 0, size * sizeof(const char *));
+  for (i = 0; i < oldSize; ++i) {
+    if (oldKeys[i]) {
+      for (h = nameIndexHash(oldKeys[i], shift); keys[h];
+	   h = (h + 1) & (size - 1)) ;
+      keys[h] = oldKeys[i];
+      vals[h] = oldVals[i];
+    }
+  }
+  gfree(oldKeys);
+  gfree(oldVals);
+}
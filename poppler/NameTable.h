@@ -0,0 +1,76 @@
+//========================================================================
+//
+// NameTable.h
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef NAMETABLE_H
+#define NAMETABLE_H
+
+#ifdef USE_GCC_PRAGMAS
+#pragma interface
+#endif
+
+#include "gtypes.h"
+
+//------------------------------------------------------------------------
+// NameTable
+//
+// Interned PDF names (and content stream operators). Equal names share
+// one string, so name objects and dictionary keys can be compared by
+// pointer. The table is global and grows as needed. Each PDFDoc holds
+// a reference to it; when the last one is gone, all names are freed.
+// Lookups take no lock; additions are serialized when MULTITHREADED.
+//------------------------------------------------------------------------
+
+class NameTable {
+public:
+
+  // Return the shared copy of <name>, adding it if necessary.
+  static const char *intern(const char *name);
+
+  // Return the shared copy of <name>, or NULL if no object or
+  // dictionary has used it yet.
+  static const char *lookup(const char *name);
+
+  // Add and drop a reference to the table. Dropping the last one
+  // frees the names, so no object using them may be left.
+  static void retain();
+  static void release();
+};
+
+//------------------------------------------------------------------------
+// NameIndex
+//
+// Open addressing hash from interned names to non-negative ints,
+// keyed by address.
+//------------------------------------------------------------------------
+
+class NameIndex {
+public:
+
+  NameIndex();
+  ~NameIndex();
+
+  // Return the value stored for the interned <name>, or -1.
+  int lookup(const char *name);
+
+  // Map the interned <name> to <val>, replacing any earlier value.
+  void add(const char *name, int val);
+
+  int getLength() { return len; }
+
+private:
+
+  void grow();
+
+  const char **keys;
+  int *vals;
+  int size;			// number of slots, a power of 2
+  int shift;			// 32 - log2(size)
+  int len;			// number of used slots
+};
+
+#endif
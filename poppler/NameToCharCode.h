@@ -28,6 +28,9 @@ public:
   void add(const char *name, CharCode c);
   CharCode lookup(const char *name);
 
+  // Return the number of names added.
+  int getLength() { return len; }
+
 private:
 
   int hash(const char *name);
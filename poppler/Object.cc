@@ -89,9 +89,6 @@ Object *Object::copy(Object *obj) {
   case objString:
     obj->string = string->copy();
     break;
-  case objName:
-    obj->name = copyString(name);
-    break;
   case objArray:
     array->incRef();
     break;
@@ -101,14 +98,11 @@ Object *Object::copy(Object *obj) {
   case objStream:
     stream->incRef();
     break;
-  case objCmd:
-    obj->cmd = copyString(cmd);
-    break;
   default:
     break;
   }
 #ifdef DEBUG_MEM
-  ++numAlloc[type];
+  incObjAlloc(type);
 #endif
   return obj;
 }
@@ -123,9 +117,6 @@ void Object::free() {
   case objString:
     delete string;
     break;
-  case objName:
-    gfree(name);
-    break;
   case objArray:
     if (!array->decRef()) {
       delete array;
@@ -141,14 +132,11 @@ void Object::free() {
       delete stream;
     }
     break;
-  case objCmd:
-    gfree(cmd);
-    break;
   default:
     break;
   }
 #ifdef DEBUG_MEM
-  --numAlloc[type];
+  decObjAlloc(type);
 #endif
   type = objNone;
 }
@@ -38,6 +38,7 @@
 #include "GooString.h"
 #include "GooLikely.h"
 #include "Error.h"
+#include "NameTable.h"
 
 #define OBJECT_TYPE_CHECK(wanted_type) \
     if (unlikely(type != wanted_type)) { \
@@ -103,7 +104,14 @@ enum ObjType {
 //------------------------------------------------------------------------
 
 #ifdef DEBUG_MEM
-#define initObj(t) zeroUnion(); ++numAlloc[type = t]
+#if MULTITHREADED
+#define incObjAlloc(t) __sync_fetch_and_add(&numAlloc[t], 1)
+#define decObjAlloc(t) __sync_fetch_and_sub(&numAlloc[t], 1)
+#else
+#define incObjAlloc(t) ++numAlloc[t]
+#define decObjAlloc(t) --numAlloc[t]
+#endif
+#define initObj(t) zeroUnion(); incObjAlloc(type = t)
 #else
 #define initObj(t) zeroUnion(); type = t
 #endif
@@ -127,7 +135,7 @@ public:
   Object *initString(GooString *stringA)
     { initObj(objString); string = stringA; return this; }
   Object *initName(const char *nameA)
-    { initObj(objName); name = copyString(nameA); return this; }
+    { initObj(objName); name = NameTable::intern(nameA); return this; }
   Object *initNull()
     { initObj(objNull); return this; }
   Object *initArray(XRef *xref);
@@ -137,7 +145,7 @@ public:
   Object *initRef(int numA, int genA)
     { initObj(objRef); ref.num = numA; ref.gen = genA; return this; }
   Object *initCmd(const char *cmdA)
-    { initObj(objCmd); cmd = copyString(cmdA); return this; }
+    { initObj(objCmd); cmd = NameTable::intern(cmdA); return this; }
   Object *initError()
     { initObj(objError); return this; }
   Object *initEOF()
@@ -180,11 +188,11 @@ public:
 
   // Special type checking.
   GBool isName(const char *nameA)
-    { return type == objName && !strcmp(name, nameA); }
+    { return type == objName && (name == nameA || !strcmp(name, nameA)); }
   GBool isDict(const char *dictType);
   GBool isStream(const char *dictType);
   GBool isCmd(const char *cmdA)
-    { return type == objCmd && !strcmp(cmd, cmdA); }
+    { return type == objCmd && (cmd == cmdA || !strcmp(cmd, cmdA)); }
 
   // Accessors.
   GBool getBool() { OBJECT_TYPE_CHECK(objBool); return booln; }
@@ -210,7 +218,7 @@ public:
 
   // Dict accessors.
   int dictGetLength();
-  void dictAdd(char *key, Object *val);
+  void dictAdd(const char *key, Object *val);
   void dictSet(const char *key, Object *val);
   GBool dictIs(const char *dictType);
   Object *dictLookup(const char *key, Object *obj, std::set<int> *fetchOriginatorNums = NULL);
@@ -247,12 +255,12 @@ private:
     unsigned int uintg;		//   unsigned integer
     double real;		//   real
     GooString *string;		//   string
-    char *name;			//   name
+    const char *name;		//   name (interned)
     Array *array;		//   array
     Dict *dict;			//   dictionary
     Stream *stream;		//   stream
     Ref ref;			//   indirect reference
-    char *cmd;			//   command
+    const char *cmd;		//   command (interned)
   };
 
 #ifdef DEBUG_MEM
@@ -288,7 +296,7 @@ inline Object *Object::arrayGetNF(int i, Object *obj)
 inline int Object::dictGetLength()
   { OBJECT_TYPE_CHECK(objDict); return dict->getLength(); }
 
-inline void Object::dictAdd(char *key, Object *val)
+inline void Object::dictAdd(const char *key, Object *val)
   { OBJECT_TYPE_CHECK(objDict); dict->add(key, val); }
 
 inline void Object::dictSet(const char *key, Object *val)
@@ -34,6 +34,7 @@
 #include "GfxState.h"
 #include "OutputDev.h"
 #include "GooHash.h"
+#include "ProfileData.h"
 
 //------------------------------------------------------------------------
 // OutputDev
@@ -157,7 +158,7 @@ void OutputDev::markPoint(const char *name, Dict *properties) {
 
 void OutputDev::startProfile() {
   if (profileHash)
-    delete profileHash;
+    deleteGooHash(profileHash, ProfileData);
 
   profileHash = new GooHash (true);
 }
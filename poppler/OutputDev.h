@@ -276,6 +276,9 @@ public:
   virtual void psXObject(Stream * /*psStream*/, Stream * /*level1Stream*/) {}
 
   //----- Profiling
+  // While a profile is active, Gfx records a ProfileData per content
+  // stream operator. endProfile() hands the hash over to the caller,
+  // who frees it with deleteGooHash(hash, ProfileData).
   virtual void startProfile();
   virtual GooHash *getProfileHash() {return profileHash; }
   virtual GooHash *endProfile();
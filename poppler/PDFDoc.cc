@@ -27,6 +27,7 @@
 #include "Page.h"
 #include "Catalog.h"
 #include "Stream.h"
+#include "CachedFile.h"
 #include "XRef.h"
 #include "Linearization.h"
 #include "OutputDev.h"
@@ -41,6 +42,16 @@
 
 //------------------------------------------------------------------------
 
+#if MULTITHREADED
+#  define lockDoc   gLockMutex(&mutex)
+#  define unlockDoc gUnlockMutex(&mutex)
+#else
+#  define lockDoc
+#  define unlockDoc
+#endif
+
+//------------------------------------------------------------------------
+
 #define headerSearchSize 1024	// read this many bytes at beginning of
 				//   file to look for '%PDF'
 
@@ -57,6 +68,7 @@
 
 void PDFDoc::init()
 {
+  NameTable::retain();
   ok = gFalse;
   errCode = errNone;
   file = NULL;
@@ -68,6 +80,12 @@ void PDFDoc::init()
   startXRefPos = ~(Guint)0;
   secHdlr = NULL;
   pageCache = NULL;
+  fileSize = 0;
+  fileMTime = 0;
+  fileID = NULL;
+#if MULTITHREADED
+  gInitMutex(&mutex);
+#endif
 }
 
 PDFDoc::PDFDoc(const char *fileName, const char *ownerPassword, const char *userPassword) {
@@ -79,6 +97,12 @@ PDFDoc::PDFDoc(const char *fileName, const char *ownerPassword, const char *user
   struct stat buf;
   if (stat(fileName, &buf) == 0) {
      size = buf.st_size;
+     fileSize = buf.st_size;
+#ifdef __APPLE__
+     fileMTime = buf.st_mtimespec.tv_sec + buf.st_mtimespec.tv_nsec * 1e-9;
+#else
+     fileMTime = buf.st_mtim.tv_sec + buf.st_mtim.tv_nsec * 1e-9;
+#endif
   }
 
   // try to open file
@@ -100,6 +124,15 @@ PDFDoc::PDFDoc(const char *fileName, const char *ownerPassword, const char *user
   ok = setup(ownerPassword, userPassword);
 }
 
+PDFDoc::PDFDoc(BaseStream *strA, const char *ownerPassword, const char *userPassword) {
+  init();
+
+  str = strA;
+  fileSize = str->getLength();
+
+  ok = setup(ownerPassword, userPassword);
+}
+
 GBool PDFDoc::setup(const char *ownerPassword, const char *userPassword) {
   str->setPos(0, -1);
   if (str->getPos() < 0)
@@ -152,6 +185,16 @@ GBool PDFDoc::setup(const char *ownerPassword, const char *userPassword) {
     }
   }
 
+  // get the file ID
+  Object idObj, idStr;
+  xref->getTrailerDict()->dictLookup("ID", &idObj);
+  if (idObj.isArray() && idObj.arrayGetLength() > 0 &&
+      idObj.arrayGet(0, &idStr)->isString()) {
+    fileID = idStr.getString()->copy();
+  }
+  idStr.free();
+  idObj.free();
+
   // done
   return gTrue;
 }
@@ -166,6 +209,9 @@ PDFDoc::~PDFDoc() {
     gfree(pageCache);
   }
   delete secHdlr;
+  if (fileID) {
+    delete fileID;
+  }
   if (catalog) {
     delete catalog;
   }
@@ -184,6 +230,10 @@ PDFDoc::~PDFDoc() {
   if (file) {
     fclose(file);
   }
+#if MULTITHREADED
+  gDestroyMutex(&mutex);
+#endif
+  NameTable::release();
 }
 
 
@@ -293,10 +343,14 @@ void PDFDoc::displayPage(OutputDev *out, int page,
 			 GBool useMediaBox, GBool crop, GBool printing,
 			 GBool (*abortCheckCbk)(void *data),
 			 void *abortCheckCbkData) {
-  if (getPage(page))
-    getPage(page)->display(out, hDPI, vDPI,
-				    rotate, useMediaBox, crop, printing, catalog,
-				    abortCheckCbk, abortCheckCbkData);
+  Page *p;
+
+  lockDoc;
+  if ((p = findPage(page)))
+    p->display(out, hDPI, vDPI,
+	       rotate, useMediaBox, crop, printing, catalog,
+	       abortCheckCbk, abortCheckCbkData);
+  unlockDoc;
 }
 
 void PDFDoc::displayPages(OutputDev *out, int firstPage, int lastPage,
@@ -318,12 +372,22 @@ void PDFDoc::displayPageSlice(OutputDev *out, int page,
 			      int sliceX, int sliceY, int sliceW, int sliceH,
 			      GBool (*abortCheckCbk)(void *data),
 			      void *abortCheckCbkData) {
-  if (getPage(page))
-    getPage(page)->displaySlice(out, hDPI, vDPI,
-					 rotate, useMediaBox, crop,
-					 sliceX, sliceY, sliceW, sliceH,
-					 printing, catalog,
-					 abortCheckCbk, abortCheckCbkData);
+  Page *p;
+
+  lockDoc;
+  if ((p = findPage(page)))
+    p->displaySlice(out, hDPI, vDPI,
+		    rotate, useMediaBox, crop,
+		    sliceX, sliceY, sliceW, sliceH,
+		    printing, catalog,
+		    abortCheckCbk, abortCheckCbkData);
+  unlockDoc;
+}
+
+void PDFDoc::preloadObjectStreams(int nThreads) {
+  lockDoc;
+  xref->preloadObjectStreams(nThreads);
+  unlockDoc;
 }
 
 Linearization *PDFDoc::getLinearization()
@@ -435,6 +499,16 @@ Guint PDFDoc::getMainXRefEntriesOffset()
 }
 
 int PDFDoc::getNumPages()
+{
+  int n;
+
+  lockDoc;
+  n = countPages();
+  unlockDoc;
+  return n;
+}
+
+int PDFDoc::countPages()
 {
   if (isLinearized()) {
     int n;
@@ -446,6 +520,23 @@ int PDFDoc::getNumPages()
   return catalog->getNumPages();
 }
 
+// Fetch everything the hint tables say page <page> needs -- its own
+// objects and xref entries, and the shared object groups it uses -- in
+// a single batch.  Without this a CachedFile would go back to its
+// loader once per object read.
+void PDFDoc::loadPageRanges(int page)
+{
+  std::vector<ByteRange> *ranges;
+
+  if (str->getKind() != strCachedFile || !getHints()) {
+    return;
+  }
+  if ((ranges = getHints()->getPageRanges(page))) {
+    ((CachedFileStream *)str)->getCachedFile()->cache(*ranges);
+    delete ranges;
+  }
+}
+
 Page *PDFDoc::parsePage(int page)
 {
   Page *p = NULL;
@@ -482,16 +573,27 @@ Page *PDFDoc::parsePage(int page)
 
 Page *PDFDoc::getPage(int page)
 {
-  if ((page < 1) || page > getNumPages()) return NULL;
+  Page *p;
+
+  lockDoc;
+  p = findPage(page);
+  unlockDoc;
+  return p;
+}
+
+Page *PDFDoc::findPage(int page)
+{
+  if ((page < 1) || page > countPages()) return NULL;
 
   if (isLinearized()) {
     if (!pageCache) {
-      pageCache = (Page **) gmallocn(getNumPages(), sizeof(Page *));
-      for (int i = 0; i < getNumPages(); i++) {
+      pageCache = (Page **) gmallocn(countPages(), sizeof(Page *));
+      for (int i = 0; i < countPages(); i++) {
         pageCache[i] = NULL;
       }
     }
     if (!pageCache[page-1]) {
+      loadPageRanges(page);
       pageCache[page-1] = parsePage(page);
     }
     if (pageCache[page-1]) {
@@ -20,11 +20,16 @@
 #endif
 
 #include <stdio.h>
+#include <time.h>
 #include "XRef.h"
 #include "Catalog.h"
 #include "Page.h"
 #include "OptionalContent.h"
 
+#if MULTITHREADED
+#include "GooMutex.h"
+#endif
+
 class BaseStream;
 class OutputDev;
 class Outline;
@@ -41,6 +46,10 @@ public:
 
   PDFDoc(const char *fileName, const char *ownerPassword = NULL, const char *userPassword = NULL);
 
+  // Read the document from <strA>, e.g. a CachedFileStream; the
+  // PDFDoc takes ownership of it.
+  PDFDoc(BaseStream *strA, const char *ownerPassword = NULL, const char *userPassword = NULL);
+
   ~PDFDoc();
 
   // Was PDF document successfully opened?
@@ -59,6 +68,10 @@ public:
   // Get the xref table.
   XRef *getXRef() { return xref; }
 
+  // Decode all object streams up front on <nThreads> threads, see
+  // XRef::preloadObjectStreams.
+  void preloadObjectStreams(int nThreads);
+
   // Get catalog.
   Catalog *getCatalog() { return catalog; }
 
@@ -118,12 +131,23 @@ public:
   Object *getDocInfo(Object *obj) { return xref->getDocInfo(obj); }
   Object *getDocInfoNF(Object *obj) { return xref->getDocInfoNF(obj); }
 
+  // Get the size and modification time (in seconds, with the fraction
+  // where the file system keeps one) of the file, and the first string
+  // of the trailer's ID array (NULL if there is none), which together
+  // identify it for on-disk caches.
+  Guint getFileSize() { return fileSize; }
+  double getFileMTime() { return fileMTime; }
+  GooString *getFileID() { return fileID; }
+
   // Return the PDF version specified by the file.
   int getPDFMajorVersion() { return pdfMajorVersion; }
   int getPDFMinorVersion() { return pdfMinorVersion; }
 
 private:
+  void loadPageRanges(int page);
   Page *parsePage(int page);
+  Page *findPage(int page);
+  int countPages();
 
   // Get hints.
   Hints *getHints();
@@ -158,6 +182,15 @@ private:
   int fopenErrno;
 
   Guint startXRefPos;		// offset of last xref table
+  Guint fileSize;
+  double fileMTime;
+  GooString *fileID;
+
+#if MULTITHREADED
+  // Serializes page access, which shares the stream position, the xref
+  // and the page caches.
+  GooMutex mutex;
+#endif
 };
 
 #endif
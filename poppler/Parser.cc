@@ -27,6 +27,7 @@
 #endif
 
 #include <stddef.h>
+#include "gmem.h"
 #include "Object.h"
 #include "Array.h"
 #include "Dict.h"
@@ -53,6 +54,7 @@ Parser::~Parser() {
 Object *Parser::getObj(Object *obj, Guchar *fileKey,
            CryptAlgorithm encAlgorithm, int keyLength,
            int objNum, int objGen) {
+  GMemScope memScope(gMemTagObjects);
   std::set<int> fetchOriginatorNums;
   return getObj(obj, fileKey, encAlgorithm, keyLength, objNum, objGen, &fetchOriginatorNums);
 }
@@ -65,13 +67,13 @@ Object *Parser::getObj(Object *obj, std::set<int> *fetchOriginatorNums)
 Object *Parser::getObj(Object *obj, Guchar *fileKey,
 		       CryptAlgorithm encAlgorithm, int keyLength,
 		       int objNum, int objGen, std::set<int> *fetchOriginatorNums) {
-  char *key;
+  const char *key;
   Stream *str;
   Object obj2;
   int num;
+  DecryptObjKey objKey;
   DecryptStream *decrypt;
   GooString *s, *s2;
-  int c;
 
   // refill buffer after inline image data
   if (inlineImg == 2) {
@@ -102,11 +104,10 @@ Object *Parser::getObj(Object *obj, Guchar *fileKey,
 	error(getPos(), "Dictionary key must be a name object");
 	shift();
       } else {
-	// buf1 might go away in shift(), so construct the key
-	key = copyString(buf1.getName());
+	// names are interned, so the key outlives buf1
+	key = buf1.getName();
 	shift();
 	if (buf1.isEOF() || buf1.isError()) {
-	  gfree(key);
 	  break;
 	}
 	obj->dictAdd(key, getObj(&obj2, fileKey, encAlgorithm, keyLength, objNum, objGen, fetchOriginatorNums));
@@ -145,14 +146,11 @@ Object *Parser::getObj(Object *obj, Guchar *fileKey,
     s = buf1.getString();
     s2 = new GooString();
     obj2.initNull();
+    getObjKey(fileKey, encAlgorithm, keyLength, objNum, objGen, &objKey);
     decrypt = new DecryptStream(new MemStream(s->getCString(), 0,
 					      s->getLength(), &obj2),
-				fileKey, encAlgorithm, keyLength,
-				objNum, objGen);
-    decrypt->reset();
-    while ((c = decrypt->getChar()) != EOF) {
-      s2->append((char)c);
-    }
+				&objKey, encAlgorithm);
+    decrypt->fillGooString(s2);
     delete decrypt;
     obj->initString(s2);
     shift();
@@ -176,6 +174,7 @@ Stream *Parser::makeStream(Object *dict, Guchar *fileKey,
   Object obj;
   BaseStream *baseStr;
   Stream *str;
+  DecryptObjKey objKey;
   Guint pos, endPos, length;
 
   // get stream start position
@@ -244,8 +243,8 @@ Stream *Parser::makeStream(Object *dict, Guchar *fileKey,
 
   // handle decryption
   if (fileKey) {
-    str = new DecryptStream(str, fileKey, encAlgorithm, keyLength,
-			    objNum, objGen);
+    getObjKey(fileKey, encAlgorithm, keyLength, objNum, objGen, &objKey);
+    str = new DecryptStream(str, &objKey, encAlgorithm);
   }
 
   // get filters
@@ -254,6 +253,18 @@ Stream *Parser::makeStream(Object *dict, Guchar *fileKey,
   return str;
 }
 
+// <fileKey> is the key of <xref>, which caches the derived keys.
+void Parser::getObjKey(Guchar *fileKey, CryptAlgorithm encAlgorithm,
+		       int keyLength, int objNum, int objGen,
+		       DecryptObjKey *objKey) {
+  if (xref) {
+    xref->getObjKey(objNum, objGen, objKey);
+  } else {
+    Decrypt::makeObjKey(fileKey, encAlgorithm, keyLength, objNum, objGen,
+			objKey);
+  }
+}
+
 void Parser::shift(int objNum) {
   if (inlineImg > 0) {
     if (inlineImg < 2) {
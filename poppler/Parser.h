@@ -29,6 +29,8 @@
 
 #include "Lexer.h"
 
+struct DecryptObjKey;
+
 //------------------------------------------------------------------------
 // Parser
 //------------------------------------------------------------------------
@@ -70,6 +72,9 @@ private:
   Stream *makeStream(Object *dict, Guchar *fileKey,
 		     CryptAlgorithm encAlgorithm, int keyLength,
 		     int objNum, int objGen, std::set<int> *fetchOriginatorNums);
+  void getObjKey(Guchar *fileKey, CryptAlgorithm encAlgorithm,
+		 int keyLength, int objNum, int objGen,
+		 DecryptObjKey *objKey);
   void shift(int objNum = -1);
 };
 
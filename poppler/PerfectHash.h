@@ -0,0 +1,48 @@
+//========================================================================
+//
+// PerfectHash.h
+//
+// Lookups in the built-in tables of glyph names.
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef PERFECTHASH_H
+#define PERFECTHASH_H
+
+#include "gtypes.h"
+
+//------------------------------------------------------------------------
+
+// The built-in tables keyed by glyph name (nameToUnicodeTab, the
+// MacRoman reverse map, the builtin font widths) are generated in the
+// order of a minimal perfect hash over their names.  A name hashes to
+// one of <nBuckets> buckets, and the bucket's displacement from <disp>
+// picks the only slot of the <size>-entry table the name can be in.
+// So a lookup costs one pass over the name and one strcmp, and the
+// tables need no setup at run time.
+//
+// The tables and their <disp> arrays are generated by PerfectHash.py in
+// this directory.  To change a table, edit its entries (in any order)
+// and run 'python PerfectHash.py'; it reorders the tables in place and
+// updates their sizes.  If this function changes, hashName() and
+// hashSlot() in the script have to change with it.
+//
+// Returns the slot for <name>; the caller has to check that the entry
+// in that slot is <name>.
+static inline int perfectHashSlot(const char *name, const Gushort *disp,
+				  int nBuckets, int size) {
+  const char *p;
+  Guint h1, h2;
+
+  h1 = 2166136261U;
+  h2 = 0;
+  for (p = name; *p; ++p) {
+    h1 = (h1 ^ (*p & 0xff)) * 16777619U;
+    h2 = 31 * h2 + (*p & 0xff);
+  }
+  return (int)((h2 + disp[h1 % nBuckets] * (h1 | 1)) % size);
+}
+
+#endif
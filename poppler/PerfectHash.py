@@ -0,0 +1,219 @@
+#!/usr/bin/env python
+#========================================================================
+#
+# PerfectHash.py
+#
+# Regenerates the built-in glyph name tables in the order of the
+# perfect hash in PerfectHash.h.
+#
+# This file is licensed under the GPLv2 or later
+#
+#========================================================================
+#
+# Usage: python PerfectHash.py [poppler source dir]
+#
+# The tables are rewritten in place from their current contents, so to
+# add, remove or change a name, edit the entry anywhere in its table
+# (or, for the MacRoman reverse map, edit macRomanEncoding) and rerun
+# this script.  It updates:
+#
+#   NameToUnicodeTable.h     nameToUnicodeTab, nameToUnicodeDisp
+#   FontEncodingTables.cc/h  macRomanReverseTab, macRomanReverseDisp
+#   BuiltinFontTables.cc     the <font>WidthsTab / <font>WidthsDisp
+#                            arrays and their sizes in <font>Widths
+#
+# Running it on unchanged tables leaves the files unchanged.
+
+import os
+import re
+import sys
+
+mask = 0xffffffff
+
+# Must match perfectHashSlot() in PerfectHash.h.
+def hashName(name):
+  h1 = 2166136261
+  h2 = 0
+  for c in bytearray(name.encode('latin-1')):
+    h1 = ((h1 ^ c) * 16777619) & mask
+    h2 = (31 * h2 + c) & mask
+  return h1, h2
+
+def hashSlot(h1, h2, d, size):
+  return ((h2 + d * (h1 | 1)) & mask) % size
+
+# Returns (nBuckets, disp, order), where order[slot] is the index in
+# <names> of the name that goes in that slot.  Buckets are placed
+# largest first, each with the smallest displacement that sends all of
+# its names to free slots.  The result only depends on the set of
+# names, not on their order.
+def buildHash(names, namesPerBucket=4):
+  size = len(names)
+  nBuckets = max(1, (size + namesPerBucket - 1) // namesPerBucket)
+  hashes = [hashName(n) for n in names]
+  buckets = [[] for b in range(nBuckets)]
+  for i in range(size):
+    buckets[hashes[i][0] % nBuckets].append(i)
+  disp = [0] * nBuckets
+  order = [None] * size
+  for b in sorted(range(nBuckets), key=lambda b: -len(buckets[b])):
+    if not buckets[b]:
+      continue
+    for d in range(65536):
+      slots = [hashSlot(hashes[i][0], hashes[i][1], d, size)
+               for i in buckets[b]]
+      if (len(set(slots)) == len(slots) and
+          all(order[s] is None for s in slots)):
+        break
+    else:
+      sys.exit('PerfectHash.py: no displacement found for a bucket')
+    disp[b] = d
+    for i, s in zip(buckets[b], slots):
+      order[s] = i
+  for i in range(size):
+    h1, h2 = hashes[i]
+    assert order[hashSlot(h1, h2, disp[h1 % nBuckets], size)] == i
+  return nBuckets, disp, order
+
+def formatNumbers(nums, perLine=12):
+  lines = []
+  for i in range(0, len(nums), perLine):
+    lines.append('  ' + ', '.join(['%d' % n for n in nums[i:i+perLine]]))
+  return ',\n'.join(lines)
+
+def unescape(s):
+  return re.sub(r'\\(.)', r'\1', s)
+
+def escape(s):
+  return s.replace('\\', '\\\\').replace('"', '\\"')
+
+def checkUnique(names, what):
+  if len(set(names)) != len(names):
+    sys.exit('PerfectHash.py: duplicate name in %s' % what)
+
+def readFile(name):
+  f = open(name, 'rb')
+  s = f.read().decode('latin-1')
+  f.close()
+  return s
+
+def writeFile(name, s):
+  if readFile(name) != s:
+    f = open(name, 'wb')
+    f.write(s.encode('latin-1'))
+    f.close()
+    print('wrote %s' % name)
+
+stringPat = r'"((?:[^"\\]|\\.)*)"'
+
+#------------------------------------------------------------------------
+# NameToUnicodeTable.h
+#------------------------------------------------------------------------
+
+def genNameToUnicode():
+  s = readFile('NameToUnicodeTable.h')
+  i = s.index('// The table is in the order')
+  j = s.index('nameToUnicodeTab[nameToUnicodeTabSize] = {', i)
+  k = s.index('\n};\n', j)
+  ents = [(u, unescape(n)) for u, n in
+          re.findall(r'\{(0x[0-9a-f]+), ' + stringPat + r'\}', s[j:k])]
+  names = [n for u, n in ents]
+  checkUnique(names, 'nameToUnicodeTab')
+  nBuckets, disp, order = buildHash(names)
+  out = s[:i]
+  out += ('// The table is in the order of a perfect hash over the names, see\n'
+          '// PerfectHash.h.\n'
+          '\n'
+          '#define nameToUnicodeTabSize %d\n'
+          '#define nameToUnicodeBuckets %d\n'
+          '\n'
+          'static const struct {\n'
+          '  Unicode u;\n'
+          '  const char *name;\n'
+          '} nameToUnicodeTab[nameToUnicodeTabSize] = {\n'
+          % (len(ents), nBuckets))
+  out += ',\n'.join(['  {%s, "%s"}' % (ents[x][0], escape(ents[x][1]))
+                     for x in order])
+  out += '\n};\n\n'
+  out += ('static const Gushort nameToUnicodeDisp[nameToUnicodeBuckets] = {\n'
+          + formatNumbers(disp) + '\n};\n')
+  writeFile('NameToUnicodeTable.h', out)
+
+#------------------------------------------------------------------------
+# FontEncodingTables.cc/h: the MacRoman reverse map
+#------------------------------------------------------------------------
+
+def genMacRomanReverse():
+  s = readFile('FontEncodingTables.cc')
+  i = s.index('const char *macRomanEncoding[256] = {')
+  j = s.index('\n};\n', i)
+  codes = re.findall(r'^  (NULL|' + stringPat + r'),?$', s[i:j], re.M)
+  assert len(codes) == 256
+  first = {}
+  for c in range(256):
+    if codes[c][0] != 'NULL':
+      first.setdefault(unescape(codes[c][1]), c)
+  names = sorted(first, key=lambda n: first[n])
+  nBuckets, disp, order = buildHash(names)
+  s = re.sub(r'(macRomanReverseTab\[macRomanReverseSize\] = \{\n).*?(\n\};)',
+             lambda m: m.group(1)
+                       + formatNumbers([first[names[x]] for x in order])
+                       + m.group(2),
+             s, count=1, flags=re.S)
+  s = re.sub(r'(macRomanReverseDisp\[macRomanReverseBuckets\] = \{\n).*?'
+             r'(\n\};)',
+             lambda m: m.group(1) + formatNumbers(disp) + m.group(2),
+             s, count=1, flags=re.S)
+  writeFile('FontEncodingTables.cc', s)
+  h = readFile('FontEncodingTables.h')
+  h = re.sub(r'(#define macRomanReverseSize +)\d+',
+             lambda m: m.group(1) + str(len(names)), h)
+  h = re.sub(r'(#define macRomanReverseBuckets +)\d+',
+             lambda m: m.group(1) + str(nBuckets), h)
+  writeFile('FontEncodingTables.h', h)
+
+#------------------------------------------------------------------------
+# BuiltinFontTables.cc
+#------------------------------------------------------------------------
+
+def genBuiltinFontWidths():
+  s = readFile('BuiltinFontTables.cc')
+  sizes = {}
+
+  def genTab(m):
+    base = m.group(1)
+    ents = [(unescape(n), w) for n, w in
+            re.findall(r'\{ ' + stringPat + r',\s*(\d+) \}', m.group(2))]
+    names = [n for n, w in ents]
+    checkUnique(names, base + 'WidthsTab')
+    nBuckets, disp, order = buildHash(names)
+    sizes[base] = (len(ents), nBuckets)
+    return ('static const BuiltinFontWidth %sWidthsTab[] = {\n' % base
+            + ',\n'.join(['  { %-36s %4s }'
+                          % ('"%s",' % escape(ents[x][0]), ents[x][1])
+                          for x in order])
+            + '\n};\n\nstatic const Gushort %sWidthsDisp[] = {\n' % base
+            + formatNumbers(disp) + '\n};')
+
+  s = re.sub(r'static const BuiltinFontWidth (\w+)WidthsTab\[\] = \{\n'
+             r'(.*?)\n\};\n\nstatic const Gushort \1WidthsDisp\[\] = \{\n'
+             r'.*?\n\};',
+             genTab, s, flags=re.S)
+
+  def genWidths(m):
+    base = m.group(1)
+    return ('%sWidthsTab, %d, %sWidthsDisp, %d'
+            % (base, sizes[base][0], base, sizes[base][1]))
+
+  s = re.sub(r'(\w+)WidthsTab, \d+, \1WidthsDisp, \d+', genWidths, s)
+  writeFile('BuiltinFontTables.cc', s)
+
+#------------------------------------------------------------------------
+
+if len(sys.argv) > 1:
+  os.chdir(sys.argv[1])
+else:
+  os.chdir(os.path.dirname(os.path.abspath(__file__)))
+genNameToUnicode()
+genMacRomanReverse()
+genBuiltinFontWidths()
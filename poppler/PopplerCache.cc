@@ -10,6 +10,8 @@
 //
 //========================================================================
 
+#include <string.h>
+#include "gmem.h"
 #include "PopplerCache.h"
 
 #include "XRef.h"
@@ -22,66 +24,168 @@ PopplerCacheItem::~PopplerCacheItem()
 {
 }
 
-PopplerCache::PopplerCache(int cacheSizeA)
+PopplerCache::PopplerCache(int cacheSizeA, size_t byteBudgetA)
 {
   cacheSize = cacheSizeA;
-  keys = new PopplerCacheKey*[cacheSize];
-  items = new PopplerCacheItem*[cacheSize];
-  lastValidCacheIndex = -1;
+  byteBudget = byteBudgetA;
+  tableSize = 16;
+  table = (Entry **)gmallocn(tableSize, sizeof(Entry *));
+  memset(table, 0, tableSize * sizeof(Entry *));
+  head = tail = NULL;
+  count = 0;
+  bytes = 0;
+  hits = misses = 0;
 }
 
 PopplerCache::~PopplerCache()
 {
-  for (int i = 0; i <= lastValidCacheIndex; ++i) {
-    delete keys[i];
-    delete items[i];
+  Entry *e, *next;
+
+  for (e = head; e; e = next) {
+    next = e->next;
+    delete e->key;
+    delete e->item;
+    delete e;
   }
-  delete[] keys;
-  delete[] items;
+  gfree(table);
 }
 
 PopplerCacheItem *PopplerCache::lookup(const PopplerCacheKey &key)
 {
-  if (lastValidCacheIndex < 0)
-    return 0;
+  unsigned int h;
+  int i;
+  Entry *e;
 
-  if (*keys[0] == key) {
-    return items[0];
-  }
-  for (int i = 1; i <= lastValidCacheIndex; i++) {
-    if (*keys[i] == key) {
-      PopplerCacheKey *keyHit = keys[i];
-      PopplerCacheItem *itemHit = items[i];
-
-      for (int j = i; j > 0; j--) {
-        keys[j] = keys[j - 1];
-        items[j] = items[j - 1];
+  h = key.hash();
+  for (i = h & (tableSize - 1); (e = table[i]); i = (i + 1) & (tableSize - 1)) {
+    if (e->hash == h && *e->key == key) {
+      ++hits;
+      if (e != head) {
+        // move to the front of the LRU list
+        e->prev->next = e->next;
+        if (e->next) {
+          e->next->prev = e->prev;
+        } else {
+          tail = e->prev;
+        }
+        e->prev = NULL;
+        e->next = head;
+        head->prev = e;
+        head = e;
       }
-      
-      keys[0] = keyHit;
-      items[0] = itemHit;
-      return itemHit;
+      return e->item;
     }
   }
+  ++misses;
   return 0;
 }
 
 void PopplerCache::put(PopplerCacheKey *key, PopplerCacheItem *item)
 {
-  int movingStartIndex = lastValidCacheIndex + 1;
-  if (lastValidCacheIndex == cacheSize - 1) {
-    delete keys[lastValidCacheIndex];
-    delete items[lastValidCacheIndex];
-    movingStartIndex = cacheSize - 1;
+  Entry **oldTable;
+  int oldTableSize, i;
+  Entry *e;
+
+  if (2 * (count + 1) > tableSize) {
+    oldTable = table;
+    oldTableSize = tableSize;
+    tableSize *= 2;
+    table = (Entry **)gmallocn(tableSize, sizeof(Entry *));
+    memset(table, 0, tableSize * sizeof(Entry *));
+    for (i = 0; i < oldTableSize; ++i) {
+      if (oldTable[i]) {
+        insertSlot(oldTable[i]);
+      }
+    }
+    gfree(oldTable);
+  }
+
+  e = new Entry;
+  e->key = key;
+  e->item = item;
+  e->hash = key->hash();
+  e->bytes = item->getBytes();
+  e->prev = NULL;
+  e->next = head;
+  if (head) {
+    head->prev = e;
+  } else {
+    tail = e;
+  }
+  head = e;
+  insertSlot(e);
+  ++count;
+  bytes += e->bytes;
+  trim();
+}
+
+void PopplerCache::setLimits(int cacheSizeA, size_t byteBudgetA)
+{
+  cacheSize = cacheSizeA;
+  byteBudget = byteBudgetA;
+  trim();
+}
+
+void PopplerCache::trim()
+{
+  while (count > 0 && (count > cacheSize ||
+                       (byteBudget && bytes > byteBudget && tail != head))) {
+    removeEntry(tail);
+  }
+}
+
+void PopplerCache::removeEntry(Entry *e)
+{
+  removeSlot(e);
+  if (e->prev) {
+    e->prev->next = e->next;
+  } else {
+    head = e->next;
+  }
+  if (e->next) {
+    e->next->prev = e->prev;
   } else {
-    lastValidCacheIndex++;
+    tail = e->prev;
   }
-  for (int i = movingStartIndex; i > 0; i--) {
-    keys[i] = keys[i - 1];
-    items[i] = items[i - 1];
+  --count;
+  bytes -= e->bytes;
+  delete e->key;
+  delete e->item;
+  delete e;
+}
+
+void PopplerCache::insertSlot(Entry *e)
+{
+  int i;
+
+  for (i = e->hash & (tableSize - 1); table[i]; i = (i + 1) & (tableSize - 1)) ;
+  table[i] = e;
+}
+
+int PopplerCache::findSlot(Entry *e)
+{
+  int i;
+
+  for (i = e->hash & (tableSize - 1); table[i] != e; i = (i + 1) & (tableSize - 1)) ;
+  return i;
+}
+
+void PopplerCache::removeSlot(Entry *e)
+{
+  int i, j, k;
+
+  // shift later entries of the probe sequence back into the hole, so
+  // that no tombstones are needed
+  i = findSlot(e);
+  table[i] = NULL;
+  for (j = (i + 1) & (tableSize - 1); table[j]; j = (j + 1) & (tableSize - 1)) {
+    k = table[j]->hash & (tableSize - 1);
+    if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+      table[i] = table[j];
+      table[j] = NULL;
+      i = j;
+    }
   }
-  keys[0] = key;
-  items[0] = item;
 }
 
 int PopplerCache::size()
@@ -91,17 +195,25 @@ int PopplerCache::size()
 
 int PopplerCache::numberOfItems()
 {
-  return lastValidCacheIndex + 1;
+  return count;
+}
+
+PopplerCache::Entry *PopplerCache::nthEntry(int index)
+{
+  Entry *e;
+
+  for (e = head; e && index > 0; e = e->next, --index) ;
+  return e;
 }
     
 PopplerCacheItem *PopplerCache::item(int index)
 {
-  return items[index];
+  return nthEntry(index)->item;
 }
     
 PopplerCacheKey *PopplerCache::key(int index)
 {
-  return keys[index];
+  return nthEntry(index)->key;
 }
 
 class ObjectKey : public PopplerCacheKey {
@@ -116,6 +228,11 @@ class ObjectKey : public PopplerCacheKey {
       return k->num == num && k->gen == gen;
     }
 
+    unsigned int hash() const
+    {
+      return (unsigned int)num * 0x9e3779b1u + (unsigned int)gen;
+    }
+
     int num, gen;
 };
 
@@ -13,12 +13,17 @@
 #ifndef POPPLER_CACHE_H
 #define POPPLER_CACHE_H
 
+#include <stddef.h>
 #include "Object.h"
 
 class PopplerCacheItem
 {
   public:
    virtual ~PopplerCacheItem();
+
+   /* Approximate memory held by the item, counted against the byte
+      budget of the cache. Items returning 0 only count as one entry. */
+   virtual size_t getBytes() const { return 0; }
 };
 
 class PopplerCacheKey
@@ -26,12 +31,20 @@ class PopplerCacheKey
   public:
     virtual ~PopplerCacheKey();
     virtual bool operator==(const PopplerCacheKey &key) const = 0;
+
+    /* Equal keys must have equal hashes */
+    virtual unsigned int hash() const = 0;
 };
 
+/* An LRU cache: entries are found through an open addressing hash table
+   and kept in a list from the most to the least recently used one, so
+   lookups and insertions take constant time. */
 class PopplerCache
 {
   public:
-    PopplerCache(int cacheSizeA);
+    /* At most cacheSizeA entries and, if byteBudgetA is not 0, about
+       byteBudgetA bytes (the most recently used entry is always kept) */
+    PopplerCache(int cacheSizeA, size_t byteBudgetA = 0);
     ~PopplerCache();
     
     /* The item returned is owned by the cache */
@@ -39,26 +52,56 @@ class PopplerCache
     
     /* The key and item pointers ownership is taken by the cache */
     void put(PopplerCacheKey *key, PopplerCacheItem *item);
+
+    /* Change the limits, dropping the least recently used entries
+       that no longer fit */
+    void setLimits(int cacheSizeA, size_t byteBudgetA);
     
     /* The max size of the cache */
     int size();
     
     /* The number of items in the cache */
     int numberOfItems();
+
+    /* The bytes reported by the items in the cache */
+    size_t numberOfBytes() { return bytes; }
+
+    /* Lookups since the cache was created */
+    unsigned long getHits() { return hits; }
+    unsigned long getMisses() { return misses; }
     
-    /* The n-th item in the cache */
+    /* The n-th item in the cache, from the most recently used one */
     PopplerCacheItem *item(int index);
     
-    /* The n-th key in the cache */
+    /* The n-th key in the cache, from the most recently used one */
     PopplerCacheKey *key(int index);
   
   private:
     PopplerCache(const PopplerCache &cache); // not allowed
+
+    struct Entry {
+      PopplerCacheKey *key;
+      PopplerCacheItem *item;
+      unsigned int hash;
+      size_t bytes;
+      Entry *prev, *next;	// LRU list, most recently used first
+    };
+
+    Entry *nthEntry(int index);
+    int findSlot(Entry *e);
+    void insertSlot(Entry *e);
+    void removeSlot(Entry *e);
+    void removeEntry(Entry *e);
+    void trim();
   
-    PopplerCacheKey **keys;
-    PopplerCacheItem **items;
-    int lastValidCacheIndex;
+    Entry **table;		// open addressing, linear probing
+    int tableSize;		// a power of 2
+    Entry *head, *tail;
+    int count;
+    size_t bytes;
     int cacheSize;
+    size_t byteBudget;
+    unsigned long hits, misses;
 };
 
 class PopplerObjectCache
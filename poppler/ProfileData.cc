@@ -0,0 +1,37 @@
+//========================================================================
+//
+// ProfileData.cc
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifdef USE_GCC_PRAGMAS
+#pragma implementation
+#endif
+
+#include "ProfileData.h"
+
+//------------------------------------------------------------------------
+// ProfileData
+//------------------------------------------------------------------------
+
+ProfileData::ProfileData() {
+  count = 0;
+  total = 0;
+  self = 0;
+  min = 0;
+  max = 0;
+}
+
+void ProfileData::addElement(double elapsed, double selfA) {
+  if (count == 0 || elapsed < min) {
+    min = elapsed;
+  }
+  if (elapsed > max) {
+    max = elapsed;
+  }
+  ++count;
+  total += elapsed;
+  self += selfA;
+}
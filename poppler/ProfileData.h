@@ -0,0 +1,47 @@
+//========================================================================
+//
+// ProfileData.h
+//
+// This file is licensed under the GPLv2 or later
+//
+//========================================================================
+
+#ifndef PROFILEDATA_H
+#define PROFILEDATA_H
+
+#ifdef USE_GCC_PRAGMAS
+#pragma interface
+#endif
+
+//------------------------------------------------------------------------
+// ProfileData
+//------------------------------------------------------------------------
+
+// Timings of one content stream operator, as collected by Gfx into
+// OutputDev's profile hash (keyed by operator name).
+class ProfileData {
+public:
+
+  ProfileData();
+
+  // Record one invocation. <self> is <elapsed> less the time spent in
+  // operators run on its behalf, i.e. the contents of a form XObject
+  // for 'Do', or Type 3 glyph procedures for the text operators.
+  void addElement(double elapsed, double self);
+
+  int getCount() { return count; }
+  double getTotal() { return total; }
+  double getSelf() { return self; }
+  double getMin() { return min; }
+  double getMax() { return max; }
+
+private:
+
+  int count;			// number of invocations
+  double total;			// total time, in seconds
+  double self;			// total time less nested operators
+  double min;			// shortest invocation
+  double max;			// longest invocation
+};
+
+#endif
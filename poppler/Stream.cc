@@ -45,6 +45,7 @@
 #include "Lexer.h"
 #include "GfxState.h"
 #include "Stream.h"
+#include "CachedFile.h"
 #include "JBIG2Stream.h"
 #include "JPXStream.h"
 #include "Stream-CCITT.h"
@@ -103,6 +104,7 @@ GooString *Stream::getPSFilter(int psLevel, char *indent) {
 }
 
 Stream *Stream::addFilters(Object *dict) {
+  GMemScope memScope(gMemTagStreams);
   Object obj, obj2;
   Object params, params2;
   Stream *str;
@@ -155,7 +157,7 @@ Stream *Stream::makeFilter(const char *name, Stream *str, Object *params) {
   GBool endOfLine, byteAlign, endOfBlock, black;
   int columns, rows;
   int colorXform;
-  Object globals, obj;
+  Object globals, globalsRef, obj;
 
   if (!strcmp(name, "ASCIIHexDecode") || !strcmp(name, "AHx")) {
     str = new ASCIIHexStream(str);
@@ -275,9 +277,11 @@ Stream *Stream::makeFilter(const char *name, Stream *str, Object *params) {
   } else if (!strcmp(name, "JBIG2Decode")) {
     if (params->isDict()) {
       params->dictLookup("JBIG2Globals", &globals);
+      params->dictLookupNF("JBIG2Globals", &globalsRef);
     }
-    str = new JBIG2Stream(str, &globals);
+    str = new JBIG2Stream(str, &globals, &globalsRef);
     globals.free();
+    globalsRef.free();
   } else if (!strcmp(name, "JPXDecode")) {
     str = new JPXStream(str);
   } else {
@@ -324,6 +328,7 @@ void FilterStream::setPos(Guint pos, int dir) {
 //------------------------------------------------------------------------
 
 ImageStream::ImageStream(Stream *strA, int widthA, int nCompsA, int nBitsA) {
+  GMemScope memScope(gMemTagStreams);
   int imgLineSize;
 
   str = strA;
@@ -372,13 +377,23 @@ GBool ImageStream::getPixel(Guchar *pix) {
 
 Guchar *ImageStream::getLine() {
   Gulong buf, bitMask;
+  Guchar *packed;
   int bits;
-  int c;
+  int c, n;
   int i;
 
   if (nBits == 1) {
+    // read the packed line into the end of imgLine, which has room
+    // for 8 * n values, and spread it out from the front: byte i/8 is
+    // read before values i..i+7 are written over it; missing bytes
+    // read as EOF did, all 1 bits
+    n = (nVals + 7) >> 3;
+    packed = imgLine + 7 * n;
+    for (i = str->doGetChars(n, packed); i < n; ++i) {
+      packed[i] = 0xff;
+    }
     for (i = 0; i < nVals; i += 8) {
-      c = str->getChar();
+      c = *packed++;
       imgLine[i+0] = (Guchar)((c >> 7) & 1);
       imgLine[i+1] = (Guchar)((c >> 6) & 1);
       imgLine[i+2] = (Guchar)((c >> 5) & 1);
@@ -693,6 +708,96 @@ void FileStream::moveStart(int delta) {
   bufPos = start;
 }
 
+//------------------------------------------------------------------------
+// CachedFileStream
+//------------------------------------------------------------------------
+
+CachedFileStream::CachedFileStream(CachedFile *ccA, Guint startA,
+				   GBool limitedA, Guint lengthA,
+				   Object *dictA):
+    BaseStream(dictA, lengthA) {
+  cc = ccA;
+  start = startA;
+  limited = limitedA;
+  length = lengthA;
+  bufPtr = bufEnd = buf;
+  bufPos = start;
+  savePos = 0;
+  saved = gFalse;
+}
+
+CachedFileStream::~CachedFileStream() {
+  close();
+  cc->decRefCnt();
+}
+
+Stream *CachedFileStream::makeSubStream(Guint startA, GBool limitedA,
+					Guint lengthA, Object *dictA) {
+  cc->incRefCnt();
+  return new CachedFileStream(cc, startA, limitedA, lengthA, dictA);
+}
+
+void CachedFileStream::reset() {
+  savePos = (Guint)cc->tell();
+  cc->seek(start, SEEK_SET);
+  saved = gTrue;
+  bufPtr = bufEnd = buf;
+  bufPos = start;
+}
+
+void CachedFileStream::close() {
+  if (saved) {
+    cc->seek(savePos, SEEK_SET);
+    saved = gFalse;
+  }
+}
+
+GBool CachedFileStream::fillBuf() {
+  int n;
+
+  bufPos += bufEnd - buf;
+  bufPtr = bufEnd = buf;
+  if (limited && bufPos >= start + length) {
+    return gFalse;
+  }
+  if (limited && bufPos + cachedStreamBufSize > start + length) {
+    n = start + length - bufPos;
+  } else {
+    n = cachedStreamBufSize - (bufPos % cachedStreamBufSize);
+  }
+  // substreams share the CachedFile's position
+  cc->seek(bufPos, SEEK_SET);
+  n = cc->read(buf, 1, n);
+  bufEnd = buf + n;
+  if (bufPtr >= bufEnd) {
+    return gFalse;
+  }
+  return gTrue;
+}
+
+void CachedFileStream::setPos(Guint pos, int dir) {
+  Guint size;
+
+  if (dir >= 0) {
+    cc->seek(pos, SEEK_SET);
+    bufPos = pos;
+  } else {
+    cc->seek(0, SEEK_END);
+    size = (Guint)cc->tell();
+    if (pos > size)
+      pos = (Guint)size;
+    cc->seek(-(int)pos, SEEK_END);
+    bufPos = (Guint)cc->tell();
+  }
+  bufPtr = bufEnd = buf;
+}
+
+void CachedFileStream::moveStart(int delta) {
+  start += delta;
+  bufPtr = bufEnd = buf;
+  bufPos = start;
+}
+
 //------------------------------------------------------------------------
 // MemStream
 //------------------------------------------------------------------------
@@ -1236,20 +1341,22 @@ CCITTFaxStream::CCITTFaxStream(Stream *strA, int encodingA, GBool endOfLineA,
   columns = columnsA;
   if (columns < 1) {
     columns = 1;
-  } else if (columns > INT_MAX - 2) {
-    columns = INT_MAX - 2;
+  } else if (columns > INT_MAX - 7) {
+    columns = INT_MAX - 7;
   }
   rows = rowsA;
   endOfBlock = endOfBlockA;
   black = blackA;
   // 0 <= codingLine[0] < codingLine[1] < ... < codingLine[n] = columns
   // ---> max codingLine size = columns + 1
-  // refLine has one extra guard entry at the end
-  // ---> max refLine size = columns + 2
+  // refLine has two extra guard entries at the end
+  // ---> max refLine size = columns + 3
   codingLine = (int *)gmallocn_checkoverflow(columns + 1, sizeof(int));
-  refLine = (int *)gmallocn_checkoverflow(columns + 2, sizeof(int));
+  refLine = (int *)gmallocn_checkoverflow(columns + 3, sizeof(int));
+  rowBytes = (columns + 7) >> 3;
+  rowBuf = (Guchar *)gmallocn_checkoverflow(rowBytes, sizeof(Guchar));
 
-  if (codingLine != NULL && refLine != NULL) {
+  if (codingLine != NULL && refLine != NULL && rowBuf != NULL) {
     eof = gFalse;
     codingLine[0] = columns;
   } else {
@@ -1259,13 +1366,12 @@ CCITTFaxStream::CCITTFaxStream(Stream *strA, int encodingA, GBool endOfLineA,
   nextLine2D = encoding < 0;
   inputBits = 0;
   a0i = 0;
-  outputBits = 0;
-
-  buf = EOF;
+  rowIdx = rowBytes;
 }
 
 CCITTFaxStream::~CCITTFaxStream() {
   delete str;
+  gfree(rowBuf);
   gfree(refLine);
   gfree(codingLine);
 }
@@ -1277,16 +1383,16 @@ void CCITTFaxStream::unfilteredReset () {
   nextLine2D = encoding < 0;
   inputBits = 0;
   a0i = 0;
-  outputBits = 0;
-  buf = EOF;
+  rowIdx = rowBytes;
 }
 
 void CCITTFaxStream::reset() {
+  GMemScope memScope(gMemTagStreams);
   short code1;
 
   unfilteredReset();
 
-  if (codingLine != NULL && refLine != NULL) {
+  if (codingLine != NULL && refLine != NULL && rowBuf != NULL) {
     eof = gFalse;
     codingLine[0] = columns;
   } else {
@@ -1345,328 +1451,416 @@ inline void CCITTFaxStream::addPixelsNeg(int a1, int blackPixels) {
   }
 }
 
-int CCITTFaxStream::lookChar() {
-  short code1, code2, code3;
-  int b1i, blackPixels, i, bits;
-  GBool gotEOL;
+// The code tables for the first 12 bits of a white code and the first
+// 13 bits of a black code.
+static inline const CCITTCode *getWhiteCodeEntry(int code) {
+  if ((code >> 5) == 0) {
+    return &whiteTab1[code];
+  }
+  return &whiteTab2[code >> 3];
+}
 
-  if (buf != EOF) {
-    return buf;
+static inline const CCITTCode *getBlackCodeEntry(int code) {
+  if ((code >> 7) == 0) {
+    return &blackTab1[code];
   }
+  if ((code >> 9) == 0) {
+    return &blackTab2[(code >> 1) - 64];
+  }
+  return &blackTab3[code >> 7];
+}
 
-  // read the next row
-  if (outputBits == 0) {
+// The codes are looked up in the bits already in the input buffer
+// first.  A code that lies within them is the one read*Code would find
+// as well, as no code is the prefix of another one, and nothing needs
+// to be read from the stream for it.
 
-    // if at eof just return EOF
-    if (eof) {
-      return EOF;
+inline short CCITTFaxStream::getTwoDimCode() {
+  const CCITTCode *p;
+
+  p = &twoDimTab1[peekBits(7)];
+  if (p->bits > 0 && p->bits <= inputBits) {
+    inputBits -= p->bits;
+    return p->n;
+  }
+  return readTwoDimCode();
+}
+
+inline short CCITTFaxStream::getWhiteCode() {
+  const CCITTCode *p;
+
+  p = getWhiteCodeEntry(peekBits(12));
+  if (p->bits > 0 && p->bits <= inputBits) {
+    inputBits -= p->bits;
+    return p->n;
+  }
+  return readWhiteCode();
+}
+
+inline short CCITTFaxStream::getBlackCode() {
+  const CCITTCode *p;
+
+  p = getBlackCodeEntry(peekBits(13));
+  if (p->bits > 0 && p->bits <= inputBits) {
+    inputBits -= p->bits;
+    return p->n;
+  }
+  return readBlackCode();
+}
+
+int CCITTFaxStream::getChars(int nChars, Guchar *buffer) {
+  int n, m;
+
+  n = 0;
+  while (n < nChars && (rowIdx < rowBytes || readRow())) {
+    m = rowBytes - rowIdx;
+    if (m > nChars - n) {
+      m = nChars - n;
     }
+    memcpy(buffer + n, rowBuf + rowIdx, m);
+    rowIdx += m;
+    n += m;
+  }
+  return n;
+}
+
+Guchar *CCITTFaxStream::getRow() {
+  if (!readRow()) {
+    return NULL;
+  }
+  rowIdx = rowBytes;
+  return rowBuf;
+}
 
-    err = gFalse;
+// Decode the next row into rowBuf.  Returns false at end of stream.
+GBool CCITTFaxStream::readRow() {
+  short code1, code2, code3;
+  int b1i, blackPixels, i, x0, x1, b0, b1;
+  Guchar white, fill, m0, m1;
+  GBool gotEOL;
 
-    // 2-D encoding
-    if (nextLine2D) {
-      for (i = 0; codingLine[i] < columns; ++i) {
-	refLine[i] = codingLine[i];
-      }
-      refLine[i++] = columns;
-      refLine[i] = columns;
-      codingLine[0] = 0;
-      a0i = 0;
-      b1i = 0;
-      blackPixels = 0;
-      // invariant:
-      // refLine[b1i-1] <= codingLine[a0i] < refLine[b1i] < refLine[b1i+1]
-      //                                                             <= columns
-      // exception at left edge:
-      //   codingLine[a0i = 0] = refLine[b1i = 0] = 0 is possible
-      // exception at right edge:
-      //   refLine[b1i] = refLine[b1i+1] = columns is possible
-      while (codingLine[a0i] < columns) {
-	code1 = getTwoDimCode();
-	switch (code1) {
-	case twoDimPass:
-	  addPixels(refLine[b1i + 1], blackPixels);
-	  if (refLine[b1i + 1] < columns) {
+  if (eof) {
+    return gFalse;
+  }
+
+  err = gFalse;
+
+  // 2-D encoding
+  if (nextLine2D) {
+    for (i = 0; codingLine[i] < columns; ++i) {
+      refLine[i] = codingLine[i];
+    }
+    refLine[i++] = columns;
+    refLine[i++] = columns;
+    refLine[i] = columns;
+    codingLine[0] = 0;
+    a0i = 0;
+    b1i = 0;
+    blackPixels = 0;
+    // invariant:
+    // refLine[b1i-1] <= codingLine[a0i] < refLine[b1i] < refLine[b1i+1]
+    //                                                             <= columns
+    // exception at left edge:
+    //   codingLine[a0i = 0] = refLine[b1i = 0] = 0 is possible
+    // exception at right edge:
+    //   refLine[b1i] = refLine[b1i+1] = columns is possible
+    while (codingLine[a0i] < columns) {
+      code1 = getTwoDimCode();
+      switch (code1) {
+      case twoDimPass:
+	addPixels(refLine[b1i + 1], blackPixels);
+	if (refLine[b1i + 1] < columns) {
+	  b1i += 2;
+	}
+	break;
+      case twoDimHoriz:
+	code1 = code2 = 0;
+	if (blackPixels) {
+	  do {
+	    code1 += code3 = getBlackCode();
+	  } while (code3 >= 64);
+	  do {
+	    code2 += code3 = getWhiteCode();
+	  } while (code3 >= 64);
+	} else {
+	  do {
+	    code1 += code3 = getWhiteCode();
+	  } while (code3 >= 64);
+	  do {
+	    code2 += code3 = getBlackCode();
+	  } while (code3 >= 64);
+	}
+	addPixels(codingLine[a0i] + code1, blackPixels);
+	if (codingLine[a0i] < columns) {
+	  addPixels(codingLine[a0i] + code2, blackPixels ^ 1);
+	}
+	while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	  b1i += 2;
+	}
+	break;
+      case twoDimVertR3:
+	addPixels(refLine[b1i] + 3, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  ++b1i;
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
 	    b1i += 2;
 	  }
-	  break;
-	case twoDimHoriz:
-	  code1 = code2 = 0;
-	  if (blackPixels) {
-	    do {
-	      code1 += code3 = getBlackCode();
-	    } while (code3 >= 64);
-	    do {
-	      code2 += code3 = getWhiteCode();
-	    } while (code3 >= 64);
-	  } else {
-	    do {
-	      code1 += code3 = getWhiteCode();
-	    } while (code3 >= 64);
-	    do {
-	      code2 += code3 = getBlackCode();
-	    } while (code3 >= 64);
-	  }
-	  addPixels(codingLine[a0i] + code1, blackPixels);
-	  if (codingLine[a0i] < columns) {
-	    addPixels(codingLine[a0i] + code2, blackPixels ^ 1);
+	}
+	break;
+      case twoDimVertR2:
+	addPixels(refLine[b1i] + 2, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  ++b1i;
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	    b1i += 2;
 	  }
+	}
+	break;
+      case twoDimVertR1:
+	addPixels(refLine[b1i] + 1, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  ++b1i;
 	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
 	    b1i += 2;
 	  }
-	  break;
-	case twoDimVertR3:
-	  addPixels(refLine[b1i] + 3, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
-	    ++b1i;
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
+	}
+	break;
+      case twoDimVert0:
+	addPixels(refLine[b1i], blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  ++b1i;
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	    b1i += 2;
 	  }
-	  break;
-	case twoDimVertR2:
-	  addPixels(refLine[b1i] + 2, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
+	}
+	break;
+      case twoDimVertL3:
+	addPixelsNeg(refLine[b1i] - 3, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  if (b1i > 0) {
+	    --b1i;
+	  } else {
 	    ++b1i;
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
 	  }
-	  break;
-	case twoDimVertR1:
-	  addPixels(refLine[b1i] + 1, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
-	    ++b1i;
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	    b1i += 2;
 	  }
-	  break;
-	case twoDimVert0:
-	  addPixels(refLine[b1i], blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
+	}
+	break;
+      case twoDimVertL2:
+	addPixelsNeg(refLine[b1i] - 2, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  if (b1i > 0) {
+	    --b1i;
+	  } else {
 	    ++b1i;
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
 	  }
-	  break;
-	case twoDimVertL3:
-	  addPixelsNeg(refLine[b1i] - 3, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
-	    if (b1i > 0) {
-	      --b1i;
-	    } else {
-	      ++b1i;
-	    }
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	    b1i += 2;
 	  }
-	  break;
-	case twoDimVertL2:
-	  addPixelsNeg(refLine[b1i] - 2, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
-	    if (b1i > 0) {
-	      --b1i;
-	    } else {
-	      ++b1i;
-	    }
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
+	}
+	break;
+      case twoDimVertL1:
+	addPixelsNeg(refLine[b1i] - 1, blackPixels);
+	blackPixels ^= 1;
+	if (codingLine[a0i] < columns) {
+	  if (b1i > 0) {
+	    --b1i;
+	  } else {
+	    ++b1i;
 	  }
-	  break;
-	case twoDimVertL1:
-	  addPixelsNeg(refLine[b1i] - 1, blackPixels);
-	  blackPixels ^= 1;
-	  if (codingLine[a0i] < columns) {
-	    if (b1i > 0) {
-	      --b1i;
-	    } else {
-	      ++b1i;
-	    }
-	    while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
-	      b1i += 2;
-	    }
+	  while (refLine[b1i] <= codingLine[a0i] && refLine[b1i] < columns) {
+	    b1i += 2;
 	  }
-	  break;
-	case EOF:
-	  addPixels(columns, 0);
-	  eof = gTrue;
-	  break;
-	default:
-	  error(getPos(), "Bad 2D code %04x in CCITTFax stream", code1);
-	  addPixels(columns, 0);
-	  err = gTrue;
-	  break;
 	}
+	break;
+      case EOF:
+	addPixels(columns, 0);
+	eof = gTrue;
+	break;
+      default:
+	error(getPos(), "Bad 2D code %04x in CCITTFax stream", code1);
+	addPixels(columns, 0);
+	err = gTrue;
+	break;
       }
+    }
 
-    // 1-D encoding
-    } else {
-      codingLine[0] = 0;
-      a0i = 0;
-      blackPixels = 0;
-      while (codingLine[a0i] < columns) {
-	code1 = 0;
-	if (blackPixels) {
-	  do {
-	    code1 += code3 = getBlackCode();
-	  } while (code3 >= 64);
-	} else {
-	  do {
-	    code1 += code3 = getWhiteCode();
-	  } while (code3 >= 64);
-	}
-	addPixels(codingLine[a0i] + code1, blackPixels);
-	blackPixels ^= 1;
+  // 1-D encoding
+  } else {
+    codingLine[0] = 0;
+    a0i = 0;
+    blackPixels = 0;
+    while (codingLine[a0i] < columns) {
+      code1 = 0;
+      if (blackPixels) {
+	do {
+	  code1 += code3 = getBlackCode();
+	} while (code3 >= 64);
+      } else {
+	do {
+	  code1 += code3 = getWhiteCode();
+	} while (code3 >= 64);
       }
+      addPixels(codingLine[a0i] + code1, blackPixels);
+      blackPixels ^= 1;
     }
+  }
 
-    // byte-align the row
-    if (byteAlign) {
-      inputBits &= ~7;
-    }
+  // byte-align the row
+  if (byteAlign) {
+    inputBits &= ~7;
+  }
 
-    // check for end-of-line marker, skipping over any extra zero bits
-    gotEOL = gFalse;
-    if (!endOfBlock && row == rows - 1) {
-      eof = gTrue;
-    } else {
+  // check for end-of-line marker, skipping over any extra zero bits
+  gotEOL = gFalse;
+  if (!endOfBlock && row == rows - 1) {
+    eof = gTrue;
+  } else {
+    code1 = lookBits(12);
+    while (code1 == 0) {
+      eatBits(1);
       code1 = lookBits(12);
-      while (code1 == 0) {
-	eatBits(1);
-	code1 = lookBits(12);
-      }
-      if (code1 == 0x001) {
-	eatBits(12);
-	gotEOL = gTrue;
-      } else if (code1 == EOF) {
-	eof = gTrue;
-      }
     }
-
-    // get 2D encoding tag
-    if (!eof && encoding > 0) {
-      nextLine2D = !lookBits(1);
-      eatBits(1);
+    if (code1 == 0x001) {
+      eatBits(12);
+      gotEOL = gTrue;
+    } else if (code1 == EOF) {
+      eof = gTrue;
     }
+  }
 
-    // check for end-of-block marker
-    if (endOfBlock && gotEOL) {
-      code1 = lookBits(12);
-      if (code1 == 0x001) {
-	eatBits(12);
-	if (encoding > 0) {
-	  lookBits(1);
-	  eatBits(1);
-	}
-	if (encoding >= 0) {
-	  for (i = 0; i < 4; ++i) {
-	    code1 = lookBits(12);
-	    if (code1 != 0x001) {
-	      error(getPos(), "Bad RTC code in CCITTFax stream");
-	    }
-	    eatBits(12);
-	    if (encoding > 0) {
-	      lookBits(1);
-	      eatBits(1);
-	    }
+  // get 2D encoding tag
+  if (!eof && encoding > 0) {
+    nextLine2D = !lookBits(1);
+    eatBits(1);
+  }
+
+  // check for end-of-block marker
+  if (endOfBlock && gotEOL) {
+    code1 = lookBits(12);
+    if (code1 == 0x001) {
+      eatBits(12);
+      if (encoding > 0) {
+	lookBits(1);
+	eatBits(1);
+      }
+      if (encoding >= 0) {
+	for (i = 0; i < 4; ++i) {
+	  code1 = lookBits(12);
+	  if (code1 != 0x001) {
+	    error(getPos(), "Bad RTC code in CCITTFax stream");
+	  }
+	  eatBits(12);
+	  if (encoding > 0) {
+	    lookBits(1);
+	    eatBits(1);
 	  }
 	}
-	eof = gTrue;
       }
+      eof = gTrue;
+    }
 
-    // look for an end-of-line marker after an error -- we only do
-    // this if we know the stream contains end-of-line markers because
-    // the "just plow on" technique tends to work better otherwise
-    } else if (err && endOfLine) {
-      while (1) {
-	code1 = lookBits(13);
-	if (code1 == EOF) {
-	  eof = gTrue;
-	  return EOF;
-	}
-	if ((code1 >> 1) == 0x001) {
-	  break;
-	}
-	eatBits(1);
+  // look for an end-of-line marker after an error -- we only do
+  // this if we know the stream contains end-of-line markers because
+  // the "just plow on" technique tends to work better otherwise
+  } else if (err && endOfLine) {
+    while (1) {
+      code1 = lookBits(13);
+      if (code1 == EOF) {
+	eof = gTrue;
+	return gFalse;
       }
-      eatBits(12); 
-      if (encoding > 0) {
-	eatBits(1);
-	nextLine2D = !(code1 & 1);
+      if ((code1 >> 1) == 0x001) {
+	break;
       }
+      eatBits(1);
     }
-
-    // set up for output
-    if (codingLine[0] > 0) {
-      outputBits = codingLine[a0i = 0];
-    } else {
-      outputBits = codingLine[a0i = 1];
+    eatBits(12); 
+    if (encoding > 0) {
+      eatBits(1);
+      nextLine2D = !(code1 & 1);
     }
-
-    ++row;
   }
 
-  // get a byte
-  if (outputBits >= 8) {
-    buf = (a0i & 1) ? 0x00 : 0xff;
-    outputBits -= 8;
-    if (outputBits == 0 && codingLine[a0i] < columns) {
-      ++a0i;
-      outputBits = codingLine[a0i] - codingLine[a0i - 1];
-    }
-  } else {
-    bits = 8;
-    buf = 0;
-    do {
-      if (outputBits > bits) {
-	buf <<= bits;
-	if (!(a0i & 1)) {
-	  buf |= 0xff >> (8 - bits);
-	}
-	outputBits -= bits;
-	bits = 0;
+  ++row;
+
+  // set up for output: the runs alternate between white and black,
+  // starting with white, up to codingLine[i] = columns; white pixels
+  // are 1 bits, unless BlackIs1 is set, and the last byte is padded
+  // with 0 bits (1 bits with BlackIs1)
+  white = black ? 0x00 : 0xff;
+  fill = white ^ 0xff;
+  memset(rowBuf, fill, rowBytes);
+  x0 = 0;
+  for (i = 0; ; i += 2) {
+    x1 = codingLine[i];
+    if (x1 > x0) {
+      b0 = x0 >> 3;
+      b1 = (x1 - 1) >> 3;
+      m0 = 0xff >> (x0 & 7);
+      m1 = 0xff << (7 - ((x1 - 1) & 7));
+      if (b0 == b1) {
+	m0 &= m1;
+	rowBuf[b0] = (rowBuf[b0] & ~m0) | (white & m0);
       } else {
-	buf <<= outputBits;
-	if (!(a0i & 1)) {
-	  buf |= 0xff >> (8 - outputBits);
-	}
-	bits -= outputBits;
-	outputBits = 0;
-	if (codingLine[a0i] < columns) {
-	  ++a0i;
-	  outputBits = codingLine[a0i] - codingLine[a0i - 1];
-	} else if (bits > 0) {
-	  buf <<= bits;
-	  bits = 0;
+	rowBuf[b0] = (rowBuf[b0] & ~m0) | (white & m0);
+	if (b1 > b0 + 1) {
+	  memset(rowBuf + b0 + 1, white, b1 - b0 - 1);
 	}
+	rowBuf[b1] = (rowBuf[b1] & ~m1) | (white & m1);
       }
-    } while (bits);
+    }
+    if (x1 >= columns || codingLine[i + 1] >= columns) {
+      break;
+    }
+    x0 = codingLine[i + 1];
   }
-  if (black) {
-    buf ^= 0xff;
+  rowIdx = 0;
+
+  return gTrue;
+}
+
+// Read one more byte into the input buffer.
+inline GBool CCITTFaxStream::readInputByte() {
+  int c;
+
+  if ((c = str->getChar()) == EOF) {
+    return gFalse;
   }
-  return buf;
+  inputBuf = (inputBuf << 8) + c;
+  inputBits += 8;
+  return gTrue;
 }
 
-short CCITTFaxStream::getTwoDimCode() {
+// These read on, a byte at a time, until the input buffer holds a
+// whole code, and fall back to reading the code bit by bit at the end
+// of the stream or on bad codes.
+
+short CCITTFaxStream::readTwoDimCode() {
   short code;
   const CCITTCode *p;
   int n;
 
+  while (inputBits < 7 && readInputByte()) {
+    p = &twoDimTab1[peekBits(7)];
+    if (p->bits > 0 && p->bits <= inputBits) {
+      inputBits -= p->bits;
+      return p->n;
+    }
+  }
+
   code = 0; // make gcc happy
   if (endOfBlock) {
-    code = lookBits(7);
+    if ((code = lookBits(7)) == EOF) {
+      return EOF;
+    }
     p = &twoDimTab1[code];
     if (p->bits > 0) {
       eatBits(p->bits);
@@ -1674,7 +1868,9 @@ short CCITTFaxStream::getTwoDimCode() {
     }
   } else {
     for (n = 1; n <= 7; ++n) {
-      code = lookBits(n);
+      if ((code = lookBits(n)) == EOF) {
+	return EOF;
+      }
       if (n < 7) {
 	code <<= 7 - n;
       }
@@ -1689,22 +1885,26 @@ short CCITTFaxStream::getTwoDimCode() {
   return EOF;
 }
 
-short CCITTFaxStream::getWhiteCode() {
+short CCITTFaxStream::readWhiteCode() {
   short code;
   const CCITTCode *p;
   int n;
 
+  while (inputBits < 12 && readInputByte()) {
+    p = getWhiteCodeEntry(peekBits(12));
+    if (p->bits > 0 && p->bits <= inputBits) {
+      inputBits -= p->bits;
+      return p->n;
+    }
+  }
+
   code = 0; // make gcc happy
   if (endOfBlock) {
     code = lookBits(12);
     if (code == EOF) {
       return 1;
     }
-    if ((code >> 5) == 0) {
-      p = &whiteTab1[code];
-    } else {
-      p = &whiteTab2[code >> 3];
-    }
+    p = getWhiteCodeEntry(code);
     if (p->bits > 0) {
       eatBits(p->bits);
       return p->n;
@@ -1746,24 +1946,26 @@ short CCITTFaxStream::getWhiteCode() {
   return 1;
 }
 
-short CCITTFaxStream::getBlackCode() {
+short CCITTFaxStream::readBlackCode() {
   short code;
   const CCITTCode *p;
   int n;
 
+  while (inputBits < 13 && readInputByte()) {
+    p = getBlackCodeEntry(peekBits(13));
+    if (p->bits > 0 && p->bits <= inputBits) {
+      inputBits -= p->bits;
+      return p->n;
+    }
+  }
+
   code = 0; // make gcc happy
   if (endOfBlock) {
     code = lookBits(13);
     if (code == EOF) {
       return 1;
     }
-    if ((code >> 7) == 0) {
-      p = &blackTab1[code];
-    } else if ((code >> 9) == 0 && (code >> 7) != 0) {
-      p = &blackTab2[(code >> 1) - 64];
-    } else {
-      p = &blackTab3[code >> 7];
-    }
+    p = getBlackCodeEntry(code);
     if (p->bits > 0) {
       eatBits(p->bits);
       return p->n;
@@ -1926,6 +2128,258 @@ static const int dctZigZag[64] = {
   63
 };
 
+// Fill in the lookup table of <tbl>, for all codes of up to
+// dctHuffLookBits bits.  Each entry is matched the same way the
+// bit-by-bit loop in DCTStream::readHuffSym matches it, so broken
+// tables decode as they did before; entries that loop would read
+// outside of <sym> for are left to it.
+static void dctBuildHuffLookup(DCTHuffTable *tbl) {
+  Gushort code;
+  int p, len, k;
+
+  for (p = 0; p < (1 << dctHuffLookBits); ++p) {
+    tbl->lookup[p] = 0;
+    for (len = 1; len <= dctHuffLookBits; ++len) {
+      code = p >> (dctHuffLookBits - len);
+      if (code - tbl->firstCode[len] < tbl->numCodes[len]) {
+	code -= tbl->firstCode[len];
+	k = tbl->firstSym[len] + code;
+	if (k < 256) {
+	  tbl->lookup[p] = (len << 8) | tbl->sym[k];
+	}
+	break;
+      }
+    }
+  }
+}
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12)
+
+// The IDCT and the color conversion work on four 32-bit lanes at a
+// time.  GCC and clang map these vectors to SSE2 or NEON registers.
+// Every lane computes exactly what the scalar code computes, so the
+// output is the same.
+#define HAVE_DCT_VECTOR 1
+
+typedef int DCTVector __attribute__((vector_size(16)));
+typedef Gushort DCTShortVector __attribute__((vector_size(8)));
+typedef Guchar DCTByteVector __attribute__((vector_size(4)));
+
+// <mask> lanes are all 0 or all 1 bits: pick <a> where they're set
+static inline DCTVector dctSelect(DCTVector mask, DCTVector a, DCTVector b) {
+  return (a & mask) | (b & ~mask);
+}
+
+// clip to [0,255], like dctClip does for [-256,511]
+static inline DCTVector dctClipVector(DCTVector v) {
+  DCTVector over;
+
+  v &= ~(v >> 31);
+  over = v > 255;
+  return (v & ~over) | (over & 255);
+}
+
+// Transpose the 8x8 block held in <in>, where in[2*r+h] is columns
+// 4*h..4*h+3 of row r.
+static inline void dctTranspose(DCTVector *in, DCTVector *out) {
+  DCTVector t0, t1, t2, t3;
+  int r, c;
+
+  for (r = 0; r < 2; ++r) {
+    for (c = 0; c < 2; ++c) {
+      t0 = __builtin_shufflevector(in[8*r+c], in[8*r+c+2], 0, 4, 1, 5);
+      t1 = __builtin_shufflevector(in[8*r+c], in[8*r+c+2], 2, 6, 3, 7);
+      t2 = __builtin_shufflevector(in[8*r+c+4], in[8*r+c+6], 0, 4, 1, 5);
+      t3 = __builtin_shufflevector(in[8*r+c+4], in[8*r+c+6], 2, 6, 3, 7);
+      out[8*c+r] = __builtin_shufflevector(t0, t2, 0, 1, 4, 5);
+      out[8*c+r+2] = __builtin_shufflevector(t0, t2, 2, 3, 6, 7);
+      out[8*c+r+4] = __builtin_shufflevector(t1, t3, 0, 1, 4, 5);
+      out[8*c+r+6] = __builtin_shufflevector(t1, t3, 2, 3, 6, 7);
+    }
+  }
+}
+
+// One pass of DCTStream::transformDataUnit over the rows: p[2*k]
+// holds coefficient k of four rows.
+static inline void dctIDCTRows(DCTVector *p) {
+  DCTVector v0, v1, v2, v3, v4, v5, v6, v7, t, dcOnly, dc;
+
+  // rows with all-zero AC coefficients
+  dcOnly = (p[2] | p[4] | p[6] | p[8] | p[10] | p[12] | p[14]) == 0;
+  dc = (dctSqrt2 * p[0] + 512) >> 10;
+
+  // stage 4
+  v0 = (dctSqrt2 * p[0] + 128) >> 8;
+  v1 = (dctSqrt2 * p[8] + 128) >> 8;
+  v2 = p[4];
+  v3 = p[12];
+  v4 = (dctSqrt1d2 * (p[2] - p[14]) + 128) >> 8;
+  v7 = (dctSqrt1d2 * (p[2] + p[14]) + 128) >> 8;
+  v5 = p[6] << 4;
+  v6 = p[10] << 4;
+
+  // stage 3
+  t = (v0 - v1+ 1) >> 1;
+  v0 = (v0 + v1 + 1) >> 1;
+  v1 = t;
+  t = (v2 * dctSin6 + v3 * dctCos6 + 128) >> 8;
+  v2 = (v2 * dctCos6 - v3 * dctSin6 + 128) >> 8;
+  v3 = t;
+  t = (v4 - v6 + 1) >> 1;
+  v4 = (v4 + v6 + 1) >> 1;
+  v6 = t;
+  t = (v7 + v5 + 1) >> 1;
+  v5 = (v7 - v5 + 1) >> 1;
+  v7 = t;
+
+  // stage 2
+  t = (v0 - v3 + 1) >> 1;
+  v0 = (v0 + v3 + 1) >> 1;
+  v3 = t;
+  t = (v1 - v2 + 1) >> 1;
+  v1 = (v1 + v2 + 1) >> 1;
+  v2 = t;
+  t = (v4 * dctSin3 + v7 * dctCos3 + 2048) >> 12;
+  v4 = (v4 * dctCos3 - v7 * dctSin3 + 2048) >> 12;
+  v7 = t;
+  t = (v5 * dctSin1 + v6 * dctCos1 + 2048) >> 12;
+  v5 = (v5 * dctCos1 - v6 * dctSin1 + 2048) >> 12;
+  v6 = t;
+
+  // stage 1
+  p[0] = dctSelect(dcOnly, dc, v0 + v7);
+  p[14] = dctSelect(dcOnly, dc, v0 - v7);
+  p[2] = dctSelect(dcOnly, dc, v1 + v6);
+  p[12] = dctSelect(dcOnly, dc, v1 - v6);
+  p[4] = dctSelect(dcOnly, dc, v2 + v5);
+  p[10] = dctSelect(dcOnly, dc, v2 - v5);
+  p[6] = dctSelect(dcOnly, dc, v3 + v4);
+  p[8] = dctSelect(dcOnly, dc, v3 - v4);
+}
+
+// One pass of DCTStream::transformDataUnit over the columns: p[2*k]
+// holds coefficient k of four columns.
+static inline void dctIDCTColumns(DCTVector *p) {
+  DCTVector v0, v1, v2, v3, v4, v5, v6, v7, t, dcOnly, dc;
+
+  // columns with all-zero AC coefficients
+  dcOnly = (p[2] | p[4] | p[6] | p[8] | p[10] | p[12] | p[14]) == 0;
+  dc = (dctSqrt2 * p[0] + 8192) >> 14;
+
+  // stage 4
+  v0 = (dctSqrt2 * p[0] + 2048) >> 12;
+  v1 = (dctSqrt2 * p[8] + 2048) >> 12;
+  v2 = p[4];
+  v3 = p[12];
+  v4 = (dctSqrt1d2 * (p[2] - p[14]) + 2048) >> 12;
+  v7 = (dctSqrt1d2 * (p[2] + p[14]) + 2048) >> 12;
+  v5 = p[6];
+  v6 = p[10];
+
+  // stage 3
+  t = (v0 - v1 + 1) >> 1;
+  v0 = (v0 + v1 + 1) >> 1;
+  v1 = t;
+  t = (v2 * dctSin6 + v3 * dctCos6 + 2048) >> 12;
+  v2 = (v2 * dctCos6 - v3 * dctSin6 + 2048) >> 12;
+  v3 = t;
+  t = (v4 - v6 + 1) >> 1;
+  v4 = (v4 + v6 + 1) >> 1;
+  v6 = t;
+  t = (v7 + v5 + 1) >> 1;
+  v5 = (v7 - v5 + 1) >> 1;
+  v7 = t;
+
+  // stage 2
+  t = (v0 - v3 + 1) >> 1;
+  v0 = (v0 + v3 + 1) >> 1;
+  v3 = t;
+  t = (v1 - v2 + 1) >> 1;
+  v1 = (v1 + v2 + 1) >> 1;
+  v2 = t;
+  t = (v4 * dctSin3 + v7 * dctCos3 + 2048) >> 12;
+  v4 = (v4 * dctCos3 - v7 * dctSin3 + 2048) >> 12;
+  v7 = t;
+  t = (v5 * dctSin1 + v6 * dctCos1 + 2048) >> 12;
+  v5 = (v5 * dctCos1 - v6 * dctSin1 + 2048) >> 12;
+  v6 = t;
+
+  // stage 1
+  p[0] = dctSelect(dcOnly, dc, v0 + v7);
+  p[14] = dctSelect(dcOnly, dc, v0 - v7);
+  p[2] = dctSelect(dcOnly, dc, v1 + v6);
+  p[12] = dctSelect(dcOnly, dc, v1 - v6);
+  p[4] = dctSelect(dcOnly, dc, v2 + v5);
+  p[10] = dctSelect(dcOnly, dc, v2 - v5);
+  p[6] = dctSelect(dcOnly, dc, v3 + v4);
+  p[8] = dctSelect(dcOnly, dc, v3 - v4);
+}
+
+// Convert four YCbCr pixels to RGB, or, with <inv> set, to the CMY
+// part of CMYK.
+static inline void dctYCbCrToRGB(DCTVector *p0, DCTVector *p1,
+				 DCTVector *p2, GBool inv) {
+  DCTVector pY, pCb, pCr, pR, pG, pB;
+
+  pY = *p0;
+  pCb = *p1 - 128;
+  pCr = *p2 - 128;
+  pR = dctClipVector(((pY << 16) + dctCrToR * pCr + 32768) >> 16);
+  pG = dctClipVector(((pY << 16) + dctCbToG * pCb + dctCrToG * pCr +
+		      32768) >> 16);
+  pB = dctClipVector(((pY << 16) + dctCbToB * pCb + 32768) >> 16);
+  if (inv) {
+    pR = 255 - pR;
+    pG = 255 - pG;
+    pB = 255 - pB;
+  }
+  *p0 = pR;
+  *p1 = pG;
+  *p2 = pB;
+}
+
+// Color convert <n> pixels of a row, <n> being a multiple of 4.
+static void dctConvertRow(Guchar *r0, Guchar *r1, Guchar *r2,
+			  int n, GBool inv) {
+  DCTByteVector b0, b1, b2;
+  DCTVector p0, p1, p2;
+  int i;
+
+  for (i = 0; i < n; i += 4) {
+    memcpy(&b0, r0 + i, 4);
+    memcpy(&b1, r1 + i, 4);
+    memcpy(&b2, r2 + i, 4);
+    p0 = __builtin_convertvector(b0, DCTVector);
+    p1 = __builtin_convertvector(b1, DCTVector);
+    p2 = __builtin_convertvector(b2, DCTVector);
+    dctYCbCrToRGB(&p0, &p1, &p2, inv);
+    b0 = __builtin_convertvector(p0, DCTByteVector);
+    b1 = __builtin_convertvector(p1, DCTByteVector);
+    b2 = __builtin_convertvector(p2, DCTByteVector);
+    memcpy(r0 + i, &b0, 4);
+    memcpy(r1 + i, &b1, 4);
+    memcpy(r2 + i, &b2, 4);
+  }
+}
+
+// Same for the int buffers of progressive mode.
+static void dctConvertRow(int *r0, int *r1, int *r2, int n, GBool inv) {
+  DCTVector p0, p1, p2;
+  int i;
+
+  for (i = 0; i < n; i += 4) {
+    memcpy(&p0, r0 + i, sizeof(p0));
+    memcpy(&p1, r1 + i, sizeof(p1));
+    memcpy(&p2, r2 + i, sizeof(p2));
+    dctYCbCrToRGB(&p0, &p1, &p2, inv);
+    memcpy(r0 + i, &p0, sizeof(p0));
+    memcpy(r1 + i, &p1, sizeof(p1));
+    memcpy(r2 + i, &p2, sizeof(p2));
+  }
+}
+
+#endif
+
 DCTStream::DCTStream(Stream *strA, int colorXformA):
     FilterStream(strA) {
   int i, j;
@@ -1961,6 +2415,8 @@ DCTStream::~DCTStream() {
 }
 
 void DCTStream::unfilteredReset() {
+  int i;
+
   str->reset();
 
   progressive = interleaved = gFalse;
@@ -1969,6 +2425,12 @@ void DCTStream::unfilteredReset() {
   numQuantTables = 0;
   numDCHuffTables = 0;
   numACHuffTables = 0;
+  // a scan may refer to a table that was never defined: make sure
+  // readHuffSym doesn't find stale lookup entries for it
+  for (i = 0; i < 4; ++i) {
+    memset(dcHuffTables[i].lookup, 0, sizeof(dcHuffTables[i].lookup));
+    memset(acHuffTables[i].lookup, 0, sizeof(acHuffTables[i].lookup));
+  }
   gotJFIFMarker = gFalse;
   gotAdobeMarker = gFalse;
   restartInterval = 0;
@@ -1976,6 +2438,7 @@ void DCTStream::unfilteredReset() {
 
 
 void DCTStream::reset() {
+  GMemScope memScope(gMemTagStreams);
   int i, j;
 
   unfilteredReset();
@@ -2161,7 +2624,9 @@ GBool DCTStream::readMCURow() {
   int data1[64];
   Guchar data2[64];
   Guchar *p1, *p2;
+#if !HAVE_DCT_VECTOR
   int pY, pCb, pCr, pR, pG, pB;
+#endif
   int h, v, horiz, vert, hSub, vSub;
   int x1, x2, y2, x3, y3, x4, y4, x5, y5, cc, i;
   int c;
@@ -2241,6 +2706,14 @@ GBool DCTStream::readMCURow() {
 
     // color space conversion
     if (colorXform) {
+#if HAVE_DCT_VECTOR
+      if (numComps == 3 || numComps == 4) {
+	for (y2 = 0; y2 < mcuHeight; ++y2) {
+	  dctConvertRow(&rowBuf[0][y2][x1], &rowBuf[1][y2][x1],
+			&rowBuf[2][y2][x1], mcuWidth, numComps == 4);
+	}
+      }
+#else
       // convert YCbCr to RGB
       if (numComps == 3) {
 	for (y2 = 0; y2 < mcuHeight; ++y2) {
@@ -2272,6 +2745,7 @@ GBool DCTStream::readMCURow() {
 	  }
 	}
       }
+#endif
     }
   }
   return gTrue;
@@ -2563,10 +3037,13 @@ void DCTStream::decodeImage() {
   int dataIn[64];
   Guchar dataOut[64];
   Gushort *quantTable;
+#if !HAVE_DCT_VECTOR
   int pY, pCb, pCr, pR, pG, pB;
+  int *p0;
+#endif
   int x1, y1, x2, y2, x3, y3, x4, y4, x5, y5, cc, i;
   int h, v, horiz, vert, hSub, vSub;
-  int *p0, *p1, *p2;
+  int *p1, *p2;
 
   for (y1 = 0; y1 < bufHeight; y1 += mcuHeight) {
     for (x1 = 0; x1 < bufWidth; x1 += mcuWidth) {
@@ -2649,6 +3126,16 @@ void DCTStream::decodeImage() {
 
       // color space conversion
       if (colorXform) {
+#if HAVE_DCT_VECTOR
+	if (numComps == 3 || numComps == 4) {
+	  for (y2 = 0; y2 < mcuHeight; ++y2) {
+	    dctConvertRow(&frameBuf[0][(y1+y2) * bufWidth + x1],
+			  &frameBuf[1][(y1+y2) * bufWidth + x1],
+			  &frameBuf[2][(y1+y2) * bufWidth + x1],
+			  mcuWidth, numComps == 4);
+	  }
+	}
+#else
 	// convert YCbCr to RGB
 	if (numComps == 3) {
 	  for (y2 = 0; y2 < mcuHeight; ++y2) {
@@ -2688,6 +3175,7 @@ void DCTStream::decodeImage() {
 	    }
 	  }
 	}
+#endif
       }
     }
   }
@@ -2703,6 +3191,49 @@ void DCTStream::decodeImage() {
 // paper.
 void DCTStream::transformDataUnit(Gushort *quantTable,
 				  int dataIn[64], Guchar dataOut[64]) {
+#if HAVE_DCT_VECTOR
+  DCTVector d[16], t[16], ac;
+  DCTShortVector q;
+  DCTByteVector b;
+  int dc, i;
+
+  // dequant
+  ac = (DCTVector){0, 0, 0, 0};
+  for (i = 0; i < 16; ++i) {
+    memcpy(&d[i], dataIn + 4 * i, sizeof(d[i]));
+    memcpy(&q, quantTable + 4 * i, sizeof(q));
+    d[i] *= __builtin_convertvector(q, DCTVector);
+    ac |= i ? d[i] : d[i] & (DCTVector){0, -1, -1, -1};
+  }
+
+  // a block without AC coefficients takes the all-zero AC shortcuts
+  // of the first row and of every column, and comes out flat
+  if (!(ac[0] | ac[1] | ac[2] | ac[3])) {
+    dc = (dctSqrt2 * d[0][0] + 512) >> 10;
+    dc = (dctSqrt2 * dc + 8192) >> 14;
+    dc = 128 + ((dc + 8) >> 4);
+    memset(dataOut, dc < 0 ? 0 : dc > 255 ? 255 : dc, 64);
+    return;
+  }
+
+  // inverse DCT on rows: transpose, so that each vector holds one
+  // coefficient of four rows
+  dctTranspose(d, t);
+  dctIDCTRows(t);
+  dctIDCTRows(t + 1);
+
+  // inverse DCT on columns
+  dctTranspose(t, d);
+  dctIDCTColumns(d);
+  dctIDCTColumns(d + 1);
+
+  // convert to 8-bit integers
+  for (i = 0; i < 16; ++i) {
+    b = __builtin_convertvector(dctClipVector(128 + ((d[i] + 8) >> 4)),
+				DCTByteVector);
+    memcpy(dataOut + 4 * i, &b, 4);
+  }
+#else
   int v0, v1, v2, v3, v4, v5, v6, v7, t;
   int *p;
   int i;
@@ -2852,12 +3383,27 @@ void DCTStream::transformDataUnit(Gushort *quantTable,
   for (i = 0; i < 64; ++i) {
     dataOut[i] = dctClip[dctClipOffset + 128 + ((dataIn[i] + 8) >> 4)];
   }
+#endif
 }
 
 int DCTStream::readHuffSym(DCTHuffTable *table) {
   Gushort code;
   int bit;
   int codeBits;
+  int e;
+
+  // codes of up to dctHuffLookBits bits are found with one lookup
+  if (inputBits < dctHuffLookBits) {
+    fillInputBuf();
+  }
+  if (inputBits >= dctHuffLookBits) {
+    e = table->lookup[(inputBuf >> (inputBits - dctHuffLookBits)) &
+		      ((1 << dctHuffLookBits) - 1)];
+    if (e) {
+      inputBits -= e >> 8;
+      return e & 0xff;
+    }
+  }
 
   code = 0;
   codeBits = 0;
@@ -2883,6 +3429,19 @@ int DCTStream::readAmp(int size) {
   int amp, bit;
   int bits;
 
+  if (size > 0 && size <= 16) {
+    if (inputBits < size) {
+      fillInputBuf();
+    }
+    if (inputBits >= size) {
+      inputBits -= size;
+      amp = (inputBuf >> inputBits) & ((1 << size) - 1);
+      if (amp < (1 << (size - 1)))
+	amp -= (1 << size) - 1;
+      return amp;
+    }
+  }
+
   amp = 0;
   for (bits = 0; bits < size; ++bits) {
     if ((bit = readBit()) == EOF)
@@ -2918,6 +3477,25 @@ int DCTStream::readBit() {
   return bit;
 }
 
+// Move whole bytes of entropy coded data into the input buffer, as
+// long as they fit.  This stops in front of 0xff, i.e., stuffed bytes
+// and markers, which are left to readBit(), so no more of the stream
+// is consumed than readBit() would consume by itself, apart from data
+// bytes that the marker readers skip anyway.
+void DCTStream::fillInputBuf() {
+  int c;
+
+  while (inputBits <= 24) {
+    c = str->lookChar();
+    if (c == EOF || c == 0xff) {
+      break;
+    }
+    str->getChar();
+    inputBuf = (inputBuf << 8) | c;
+    inputBits += 8;
+  }
+}
+
 GBool DCTStream::readHeader() {
   GBool doScan;
   int n;
@@ -3185,6 +3763,7 @@ GBool DCTStream::readHuffmanTables() {
     for (i = 0; i < sym; ++i)
       tbl->sym[i] = str->getChar();
     length -= sym;
+    dctBuildHuffLookup(tbl);
   }
   return gTrue;
 }
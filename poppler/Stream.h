@@ -33,6 +33,7 @@
 #endif
 
 #include <stdio.h>
+#include <string.h>
 #include "gtypes.h"
 #include "Object.h"
 
@@ -412,12 +413,19 @@ private:
   virtual GBool hasGetChars() { return true; }
   virtual int getChars(int nChars, Guchar *buffer)
     {
-      for (int i = 0; i < nChars; ++i) {
-        const int c = doGetChar();
-        if (likely(c != EOF)) buffer[i] = c;
-        else return i;
+      int n, m;
+
+      n = 0;
+      while (n < nChars && (bufPtr < bufEnd || fillBuf())) {
+        m = (int)(bufEnd - bufPtr);
+        if (m > nChars - n) {
+          m = nChars - n;
+        }
+        memcpy(buffer + n, bufPtr, m);
+        bufPtr += m;
+        n += m;
       }
-      return nChars;
+      return n;
     }
 
   FILE *f;
@@ -440,6 +448,7 @@ private:
 class CachedFileStream: public BaseStream {
 public:
 
+  // Takes over one reference to <ccA>.
   CachedFileStream(CachedFile *ccA, Guint startA, GBool limitedA,
 	     Guint lengthA, Object *dictA);
   virtual ~CachedFileStream();
@@ -460,6 +469,8 @@ public:
   virtual int getUnfilteredChar () { return getChar(); }
   virtual void unfilteredReset () { reset(); }
 
+  CachedFile *getCachedFile() { return cc; }
+
 private:
 
   GBool fillBuf();
@@ -695,15 +706,26 @@ public:
   virtual StreamKind getKind() { return strCCITTFax; }
   virtual void reset();
   virtual int getChar()
-    { int c = lookChar(); buf = EOF; return c; }
-  virtual int lookChar();
+    { return (rowIdx < rowBytes || readRow()) ? rowBuf[rowIdx++] : EOF; }
+  virtual int lookChar()
+    { return (rowIdx < rowBytes || readRow()) ? rowBuf[rowIdx] : EOF; }
   virtual GooString *getPSFilter(int psLevel, char *indent);
   virtual GBool isBinary(GBool last = gTrue);
 
   virtual void unfilteredReset ();
 
+  // Decodes the next row and returns it, packed eight pixels to a
+  // byte, in getRowBytes() bytes.  Whatever is left of the current row
+  // from getChar/getChars is skipped.  Returns NULL at end of stream.
+  // The row stays valid until the next read.
+  Guchar *getRow();
+  int getRowBytes() { return rowBytes; }
+
 private:
 
+  virtual GBool hasGetChars() { return true; }
+  virtual int getChars(int nChars, Guchar *buffer);
+
   int encoding;			// 'K' parameter
   GBool endOfLine;		// 'EndOfLine' parameter
   GBool byteAlign;		// 'EncodedByteAlign' parameter
@@ -714,21 +736,32 @@ private:
   GBool eof;			// true if at eof
   GBool nextLine2D;		// true if next line uses 2D encoding
   int row;			// current row
-  int inputBuf;			// input buffer
+  Guint inputBuf;		// input buffer
   int inputBits;		// number of bits in input buffer
   int *codingLine;		// coding line changing elements
   int *refLine;			// reference line changing elements
   int a0i;			// index into codingLine
   GBool err;			// error on current line
-  int outputBits;		// remaining ouput bits
-  int buf;			// character buffer
+  Guchar *rowBuf;		// the current row, packed
+  int rowBytes;			// bytes per row
+  int rowIdx;			// next byte of rowBuf to return
 
+  GBool readRow();
   void addPixels(int a1, int black);
   void addPixelsNeg(int a1, int black);
   short getTwoDimCode();
   short getWhiteCode();
   short getBlackCode();
+  short readTwoDimCode();
+  short readWhiteCode();
+  short readBlackCode();
+  GBool readInputByte();
   short lookBits(int n);
+  // the next <n> bits in the input buffer, padded with 0 bits if it
+  // holds fewer, without reading from the stream
+  int peekBits(int n)
+    { return (inputBits >= n ? inputBuf >> (inputBits - n)
+			     : inputBuf << (n - inputBits)) & ((1 << n) - 1); }
   void eatBits(int n) { if ((inputBits -= n) < 0) inputBits = 0; }
 };
 
@@ -754,12 +787,19 @@ struct DCTScanInfo {
   int ah, al;			// successive approximation parameters
 };
 
+// number of bits looked up at once when decoding Huffman codes
+#define dctHuffLookBits 8
+
 // DCT Huffman decoding table
 struct DCTHuffTable {
   Guchar firstSym[17];		// first symbol for this bit length
   Gushort firstCode[17];	// first code for this bit length
   Gushort numCodes[17];		// number of codes of this bit length
   Guchar sym[256];		// symbols
+  Gushort lookup[1 << dctHuffLookBits];
+				// (length << 8) | symbol of the code
+				//   starting with each dctHuffLookBits-bit
+				//   sequence, 0 if longer than that
 };
 
 class DCTStream: public FilterStream {
@@ -775,6 +815,8 @@ public:
   virtual GooString *getPSFilter(int psLevel, char *indent);
   virtual GBool isBinary(GBool last = gTrue);
   Stream *getRawStream() { return str; }
+  // The /ColorTransform parameter, until the stream is reset.
+  int getColorXform() { return colorXform; }
 
   virtual void unfilteredReset();
 
@@ -806,7 +848,7 @@ private:
   int restartCtr;		// MCUs left until restart
   int restartMarker;		// next restart marker
   int eobRun;			// number of EOBs left in the current run
-  int inputBuf;			// input buffer for variable length codes
+  Guint inputBuf;		// input buffer for variable length codes
   int inputBits;		// number of valid bits in input buffer
 
   void restart();
@@ -824,6 +866,7 @@ private:
   int readHuffSym(DCTHuffTable *table);
   int readAmp(int size);
   int readBit();
+  void fillInputBuf();
   GBool readHeader();
   GBool readBaselineSOF();
   GBool readProgressiveSOF();
@@ -21,6 +21,10 @@
 #include <math.h>
 #include <float.h>
 #include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "gmem.h"
 #include "GooString.h"
 #include "GooList.h"
@@ -207,10 +211,26 @@ TextWord::TextWord(GfxState *state, int rotA, double x0, double y0,
 	norm = NULL;
 }
 
+TextWord::TextWord(int rotA) {
+	rot = rotA;
+	charPos = charLen = 0;
+	font = NULL;
+	fontSize = 0;
+	text = NULL;
+	edge = NULL;
+	len = size = 0;
+	spaceAfter = gFalse;
+	next = NULL;
+	prev = NULL;
+	line = NULL;
+	norm = NULL;
+}
+
 TextWord::~TextWord() {
 	gfree(text);
 	gfree(edge);
-	gfree(norm);
+	if (norm != text)
+		gfree(norm);
 }
 
 void TextWord::addChar(GfxState *state, double x, double y,
@@ -1151,7 +1171,9 @@ int TextBlock::visitDepthFirst(TextBlock *blkList, int pos1,
 // TextPage
 //------------------------------------------------------------------------
 
-TextPage::TextPage(PDFDoc *doc, int pageNum) {
+TextPage::TextPage(PDFDoc *doc, int pageNum, double timeLimitA, int charLimitA,
+				   GBool (*abortCheckCbkA)(void *data),
+				   void *abortCheckCbkDataA) {
 	int rot;
 	curWord = NULL;
 	charPos = 0;
@@ -1168,21 +1190,103 @@ TextPage::TextPage(PDFDoc *doc, int pageNum) {
 	actualText = NULL;
 	selStart = NULL;
 	selEnd = NULL;
+	cacheData = NULL;
+	cacheDataLen = 0;
 	ok = gFalse;
-	doc->displayPage(this, pageNum, 72, 72, 0, gTrue, gFalse, gFalse);
+	incomplete = gFalse;
+	timeLimit = timeLimitA;
+	charLimit = charLimitA;
+	nChars = 0;
+	abortCheckCbk = abortCheckCbkA;
+	abortCheckCbkData = abortCheckCbkDataA;
+	buildTimer.start();
+	if (timeLimit > 0 || charLimit > 0 || abortCheckCbk)
+		doc->displayPage(this, pageNum, 72, 72, 0, gTrue, gFalse, gFalse,
+						 &budgetCheck, this);
+	else
+		doc->displayPage(this, pageNum, 72, 72, 0, gTrue, gFalse, gFalse);
 	coalesce();
     if (actualText) delete actualText;
 	deleteGooList(fonts, TextFontInfo);
+	countMemory();
 	ok = gTrue;
 }
 
+// Polled by Gfx every few operators. Once the budget is spent the answer
+// stays gTrue, so that nested content streams unwind too.
+GBool TextPage::budgetCheck(void *data) {
+	TextPage *page = (TextPage *)data;
+	if (!page->incomplete &&
+		((page->charLimit > 0 && page->nChars >= page->charLimit) ||
+		 (page->timeLimit > 0 && page->buildTimer.getElapsed() >= page->timeLimit) ||
+		 (page->abortCheckCbk && (*page->abortCheckCbk)(page->abortCheckCbkData))))
+		page->incomplete = gTrue;
+	return page->incomplete;
+}
+
+TextPage::TextPage(const char *cacheFileName, PDFDoc *doc, int pageNum) {
+	int rot;
+	// nothing is drawn into a page restored from the cache, but every
+	// member is set so that a page rejected halfway is safe to delete
+	selIdx1 = selIdx2 = selIdxSave = 0;
+	selStart = NULL;
+	selEnd = NULL;
+	pageWidth = pageHeight = 0;
+	blocks = NULL;
+	lastBlk = NULL;
+	primaryRot = 0;
+	primaryLR = gTrue;
+	incomplete = gFalse;
+	timeLimit = 0;
+	charLimit = 0;
+	nChars = 0;
+	abortCheckCbk = NULL;
+	abortCheckCbkData = NULL;
+	curWord = NULL;
+	charPos = 0;
+	curFont = NULL;
+	curFontSize = 0;
+	nest = 0;
+	nTinyChars = 0;
+	lastCharOverlap = gFalse;
+	for (rot = 0; rot < 4; ++rot)
+		pools[rot] = NULL;
+	fonts = NULL;
+	actualTextBMCLevel = 0;
+	actualText = NULL;
+	newActualTextSpan = gFalse;
+	actualText_x = actualText_y = 0;
+	actualText_dx = actualText_dy = 0;
+	cacheData = NULL;
+	cacheDataLen = 0;
+	memUsage = 0;
+	ok = readCache(cacheFileName, doc, pageNum);
+	countMemory();
+}
+
 TextPage::~TextPage() {
 	TextBlock *blk;
+	TextLine *line;
+	TextWord *word;
+	
+	if (cacheData) {
+		// text and edges live in the mapped file
+		for (blk = blocks; blk; blk = blk->next)
+			for (line = blk->lines; line; line = line->next)
+				for (word = line->words; word; word = word->next) {
+					if (word->norm == word->text)
+						word->norm = NULL;
+					word->text = NULL;
+					word->edge = NULL;
+				}
+	}
 	while (blocks) {
 		blk = blocks;
 		blocks = blocks->next;
 		delete blk;
 	}
+	if (cacheData)
+		munmap(cacheData, cacheDataLen);
 }
 
 void TextPage::startPage(int pageNum, GfxState *state) {
@@ -1200,6 +1304,7 @@ void TextPage::endPage() {
 }
 
 void TextPage::updateFont(GfxState *state) {
+	GMemScope memScope(gMemTagText);
 	GfxFont *gfxFont;
 	double *fm;
 	const char *name;
@@ -1270,6 +1375,12 @@ void TextPage::updateFont(GfxState *state) {
 void TextPage::drawChar(GfxState *state, double x, double y, double dx, double dy,
 						double originX, double originY, CharCode c, int nBytes, 
 						Unicode *u, int uLen) {
+	GMemScope memScope(gMemTagText);
+	// Gfx only polls between operators, so cut a long string short here
+	if (charLimit > 0 && nChars++ >= charLimit) {
+		incomplete = gTrue;
+		return;
+	}
 	if (actualTextBMCLevel == 0) {
 		addChar(state, x, y, dx, dy, c, nBytes, u, uLen);
 	} else {
@@ -1559,6 +1670,7 @@ void TextPage::addWord(TextWord *word) {
 }
 
 void TextPage::coalesce() {
+	GMemScope memScope(gMemTagText);
 	TextPool *pool;
 	TextWord *word0, *word1, *word2;
 	TextLine *line;
@@ -2200,6 +2312,7 @@ void TextPage::coalesce() {
 		lastBlk = NULL;
 	}
 	if (blkarray) gfree(blkarray);
+	if (blocks == NULL) return;
 	
 	blk1 = blocks;
 	blk1->xMinPre = blk1->xMin;
@@ -2240,9 +2353,21 @@ void TextPage::coalesce() {
 // Search Text
 //------------------------------------------------------------------------
 
+void TextWord::setNorm() {
+	// most words are already normalized, so they just share text
+	if (unicodeIsNormalizedNFKC(text, len)) {
+		norm = text;
+		normLen = len;
+	}
+	else {
+		norm = unicodeNormalizeNFKC(text, len, &normLen, NULL);
+		line->blk->page->memUsage += normLen * sizeof(Unicode);
+	}
+}
+
 GBool TextWord::startWith(Unicode *str, int length, GBool caseSen) {
 	if (norm == NULL)
-		norm = unicodeNormalizeNFKC(text, len, &normLen, NULL);
+		setNorm();
 	if (normLen < length)
 		return gFalse;
 	for (int i = 0; i < length; ++i)
@@ -2253,7 +2378,7 @@ GBool TextWord::startWith(Unicode *str, int length, GBool caseSen) {
 
 GBool TextWord::endWith(Unicode *str, int length, GBool caseSen) {
 	if (norm == NULL)
-		norm = unicodeNormalizeNFKC(text, len, &normLen, NULL);
+		setNorm();
 	if (normLen < length)
 		return gFalse;
 	for (int i = 0; i < length; ++i)
@@ -2265,7 +2390,7 @@ GBool TextWord::endWith(Unicode *str, int length, GBool caseSen) {
 
 GBool TextWord::strEq(Unicode *str, int length, GBool caseSen) {
 	if (norm == NULL)
-		norm = unicodeNormalizeNFKC(text, len, &normLen, NULL);
+		setNorm();
 	if (normLen != length)
 		return gFalse;
 	for (int i = 0; i < length; ++i)
@@ -2276,7 +2401,7 @@ GBool TextWord::strEq(Unicode *str, int length, GBool caseSen) {
 
 GBool TextWord::contain(Unicode *str, int length, GBool caseSen) {
 	if (norm == NULL)
-		norm = unicodeNormalizeNFKC(text, len, &normLen, NULL);
+		setNorm();
 	for (int i = 0; i + length <= normLen; ++i) {
 		int j;
 		for (j = 0; j < length; ++j)
@@ -2288,6 +2413,7 @@ GBool TextWord::contain(Unicode *str, int length, GBool caseSen) {
 }
 
 GooList *TextPage::searchText(Unicode *str, int length, GBool caseSen) {
+	GMemScope memScope(gMemTagText);
 	Unicode *strNorm = NULL;
 	int strNormLen = 0, nWords = 0;
 	GooList *result = new GooList();
@@ -2527,8 +2653,9 @@ void TextPage::startSelection(double x, double y) {
 	x *= pageWidth;
 	y *= pageHeight;
 	selStart = findNearest(x, y);
-	selIdx1 = calIdx(x, y, selStart);
 	selEnd = selStart;
+	if (selStart == NULL) return;
+	selIdx1 = calIdx(x, y, selStart);
 	selIdx2 = selIdx1;
 	selIdxSave = selIdx1;
 }
@@ -2622,6 +2749,36 @@ GooList *TextPage::getSelectedRegion() {
 	return result;
 }
 
+TextWord *TextPage::findWord(int index) {
+	if (blocks == NULL) return NULL;
+	for (TextWord *word = blocks->lines->words; word; word = word->nextWord())
+		if (word->index == index)
+			return word;
+	return NULL;
+}
+
+GBool TextPage::getSelection(TextSelection *sel) {
+	if (selStart == NULL) return gFalse;
+	sel->startWord = selStart->index;
+	sel->startIdx = selIdx1;
+	sel->endWord = selEnd->index;
+	sel->endIdx = selIdx2;
+	sel->saveIdx = selIdxSave;
+	return gTrue;
+}
+
+void TextPage::setSelection(TextSelection *sel) {
+	selStart = findWord(sel->startWord);
+	selEnd = findWord(sel->endWord);
+	if (selStart == NULL || selEnd == NULL) {
+		selStart = selEnd = NULL;
+		return;
+	}
+	selIdx1 = sel->startIdx;
+	selIdx2 = sel->endIdx;
+	selIdxSave = sel->saveIdx;
+}
+
 static inline void appendUni(Unicode *&buf, int &pos, int &size, Unicode *str, int len) {
 	if (pos + len > size) {
 		size = ((pos + len + 127) & ~0x7f);
@@ -2631,6 +2788,15 @@ static inline void appendUni(Unicode *&buf, int &pos, int &size, Unicode *str, i
 		buf[pos++] = str[i];
 }
 
+static inline void appendNorm(Unicode *&buf, int &pos, int &size, Unicode *str, int len) {
+	int n;
+	while ((n = unicodeNormalizeNFKCInto(str, len, buf + pos, size - pos)) > size - pos) {
+		size = (pos + n + 127) & ~0x7f;
+		buf = (Unicode *)greallocn(buf, size, sizeof(Unicode));
+	}
+	pos += n;
+}
+
 static inline void appendUniCh(Unicode *&buf, int &pos, int &size, Unicode ch) {
 	if (pos == size) {
 		size += 128;
@@ -2640,6 +2806,7 @@ static inline void appendUniCh(Unicode *&buf, int &pos, int &size, Unicode ch) {
 }
 
 Unicode *TextPage::getSelectedText(GBool normalize, int *length) {
+	GMemScope memScope(gMemTagText);
 	if (selStart == NULL) return NULL;
 	TextWord *begin, *end;
 	int bIdx, eIdx;
@@ -2670,21 +2837,11 @@ Unicode *TextPage::getSelectedText(GBool normalize, int *length) {
 		--eIdx;
 	}
 	if (begin == end) {
-		if (normalize) {
-			int nlen;
-			Unicode *tmp = unicodeNormalizeNFKC(begin->text + bIdx, eIdx - bIdx + 1, &nlen, NULL);
-			appendUni(result, *length, size, tmp, nlen);
-			gfree(tmp);
-		}
+		if (normalize) appendNorm(result, *length, size, begin->text + bIdx, eIdx - bIdx + 1);
 		else appendUni(result, *length, size, begin->text + bIdx, eIdx - bIdx + 1);
 	}
 	else {
-		if (normalize) {
-			int nlen;
-			Unicode *tmp = unicodeNormalizeNFKC(begin->text + bIdx, begin->len - bIdx, &nlen, NULL);
-			appendUni(result, *length, size, tmp, nlen);
-			gfree(tmp);
-		}
+		if (normalize) appendNorm(result, *length, size, begin->text + bIdx, begin->len - bIdx);
 		else appendUni(result, *length, size, begin->text + bIdx, begin->len - bIdx);
 		if (begin->spaceAfter) appendUniCh(result, *length, size, (Unicode)' ');
 		TextLine *line = begin->line;
@@ -2703,21 +2860,316 @@ Unicode *TextPage::getSelectedText(GBool normalize, int *length) {
 			if (begin == end) break;
 			if (normalize) {
 				if (begin->norm == NULL)
-					begin->norm = unicodeNormalizeNFKC(begin->text, begin->len, &begin->normLen, NULL);
+					begin->setNorm();
 				appendUni(result, *length, size, begin->norm, begin->normLen);
 			}
 			else appendUni(result, *length, size, begin->text, begin->len);
 			if (begin->spaceAfter) appendUniCh(result, *length, size, (Unicode)' ');
 		}
-		if (normalize) {
-			int nlen;
-			Unicode *tmp = unicodeNormalizeNFKC(end->text, eIdx + 1, &nlen, NULL);
-			appendUni(result, *length, size, tmp, nlen);
-			gfree(tmp);
-		}
+		if (normalize) appendNorm(result, *length, size, end->text, eIdx + 1);
 		else appendUni(result, *length, size, end->text, eIdx);
 	}
 	if (appendSpace)
 		appendUniCh(result, *length, size, (Unicode)' ');
 	return result;
 }
+
+void TextPage::countMemory() {
+	memUsage = sizeof(TextPage) + cacheDataLen;
+	for (TextBlock *blk = blocks; blk; blk = blk->next) {
+		memUsage += sizeof(TextBlock);
+		for (TextLine *line = blk->lines; line; line = line->next) {
+			memUsage += sizeof(TextLine);
+			for (TextWord *word = line->words; word; word = word->next) {
+				memUsage += sizeof(TextWord);
+				if (!cacheData)
+					memUsage += word->size * sizeof(Unicode) + (word->size + 1) * sizeof(double);
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------
+// Layout cache
+//------------------------------------------------------------------------
+
+// A cache file holds a TextCacheHeader followed by the block, line and
+// word records, all word edges and all word text, each array starting on
+// an 8-byte boundary. Records are stored in reading order, so the lines
+// of a block and the words of a line are consecutive.
+
+#define textCacheMagic 0x43545054	// "TPTC"
+#define textCacheVersion 2
+#define textCacheIDSize 32
+
+struct TextCacheHeader {
+	Guint magic;
+	Guint version;
+	Guint fileSize;
+	int pageNum;
+	double fileMTime;
+	int fileIDLen;			// length of the file ID, -1 if none
+	char fileID[textCacheIDSize];	// its first bytes
+	double pageWidth, pageHeight;
+	int nBlocks, nLines, nWords, nChars;
+};
+
+struct TextCacheBox {
+	double xMin, xMax, yMin, yMax;
+	double xMinPre, xMaxPre, yMinPre, yMaxPre;
+	double xMinPost, xMaxPost, yMinPost, yMaxPost;
+};
+
+struct TextCacheBlock {
+	TextCacheBox box;
+	int rot;
+	int nLines;
+};
+
+struct TextCacheLine {
+	TextCacheBox box;
+	double base;
+	int rot;
+	int nWords;
+};
+
+struct TextCacheWord {
+	TextCacheBox box;
+	int rot;
+	int len;
+	int index;
+	int spaceAfter;
+};
+
+#define textCacheAlign(n) (((n) + 7) & ~(size_t)7)
+
+#define copyBox(dst, src) \
+	((dst)->xMin = (src)->xMin, (dst)->xMax = (src)->xMax, \
+	 (dst)->yMin = (src)->yMin, (dst)->yMax = (src)->yMax, \
+	 (dst)->xMinPre = (src)->xMinPre, (dst)->xMaxPre = (src)->xMaxPre, \
+	 (dst)->yMinPre = (src)->yMinPre, (dst)->yMaxPre = (src)->yMaxPre, \
+	 (dst)->xMinPost = (src)->xMinPost, (dst)->xMaxPost = (src)->xMaxPost, \
+	 (dst)->yMinPost = (src)->yMinPost, (dst)->yMaxPost = (src)->yMaxPost)
+
+static void getCacheFileID(PDFDoc *doc, TextCacheHeader *hdr) {
+	GooString *id = doc->getFileID();
+	memset(hdr->fileID, 0, textCacheIDSize);
+	if (!id) {
+		hdr->fileIDLen = -1;
+		return;
+	}
+	hdr->fileIDLen = id->getLength();
+	memcpy(hdr->fileID, id->getCString(),
+		hdr->fileIDLen < textCacheIDSize ? hdr->fileIDLen : textCacheIDSize);
+}
+
+static GBool writePadded(FILE *f, const void *buf, size_t len) {
+	static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+	if (len && fwrite(buf, 1, len, f) != len)
+		return gFalse;
+	return textCacheAlign(len) == len ||
+		fwrite(zeros, 1, textCacheAlign(len) - len, f) == textCacheAlign(len) - len;
+}
+
+GBool TextPage::writeCache(const char *cacheFileName, PDFDoc *doc, int pageNum) {
+	TextCacheHeader hdr;
+	TextBlock *blk;
+	TextLine *line;
+	TextWord *word;
+	int b, l, w, e, c;
+	GBool res;
+	
+	if (!ok || incomplete) return gFalse;
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = textCacheMagic;
+	hdr.version = textCacheVersion;
+	hdr.fileSize = doc->getFileSize();
+	hdr.fileMTime = doc->getFileMTime();
+	getCacheFileID(doc, &hdr);
+	hdr.pageNum = pageNum;
+	hdr.pageWidth = pageWidth;
+	hdr.pageHeight = pageHeight;
+	for (blk = blocks; blk; blk = blk->next) {
+		++hdr.nBlocks;
+		for (line = blk->lines; line; line = line->next) {
+			++hdr.nLines;
+			for (word = line->words; word; word = word->next) {
+				++hdr.nWords;
+				hdr.nChars += word->len;
+			}
+		}
+	}
+	
+	TextCacheBlock *blkRecs = (TextCacheBlock *)gmallocn(hdr.nBlocks, sizeof(TextCacheBlock));
+	TextCacheLine *lineRecs = (TextCacheLine *)gmallocn(hdr.nLines, sizeof(TextCacheLine));
+	TextCacheWord *wordRecs = (TextCacheWord *)gmallocn(hdr.nWords, sizeof(TextCacheWord));
+	double *edges = (double *)gmallocn(hdr.nChars + hdr.nWords, sizeof(double));
+	Unicode *chars = (Unicode *)gmallocn(hdr.nChars, sizeof(Unicode));
+	b = l = w = e = c = 0;
+	for (blk = blocks; blk; blk = blk->next, ++b) {
+		copyBox(&blkRecs[b].box, blk);
+		blkRecs[b].rot = blk->rot;
+		blkRecs[b].nLines = 0;
+		for (line = blk->lines; line; line = line->next, ++l) {
+			++blkRecs[b].nLines;
+			copyBox(&lineRecs[l].box, line);
+			lineRecs[l].base = line->base;
+			lineRecs[l].rot = line->rot;
+			lineRecs[l].nWords = 0;
+			for (word = line->words; word; word = word->next, ++w) {
+				++lineRecs[l].nWords;
+				copyBox(&wordRecs[w].box, word);
+				wordRecs[w].rot = word->rot;
+				wordRecs[w].len = word->len;
+				wordRecs[w].index = word->index;
+				wordRecs[w].spaceAfter = word->spaceAfter;
+				memcpy(edges + e, word->edge, (word->len + 1) * sizeof(double));
+				e += word->len + 1;
+				memcpy(chars + c, word->text, word->len * sizeof(Unicode));
+				c += word->len;
+			}
+		}
+	}
+	
+	// write to a temporary file and rename it, so that readers never map
+	// a partially written cache
+	GooString *tmpName = GooString::format("{0:s}.{1:d}.{2:ulx}", cacheFileName,
+										   (int)getpid(), (Gulong)this);
+	FILE *f = fopen(tmpName->getCString(), "wb");
+	res = f &&
+		writePadded(f, &hdr, sizeof(hdr)) &&
+		writePadded(f, blkRecs, hdr.nBlocks * sizeof(TextCacheBlock)) &&
+		writePadded(f, lineRecs, hdr.nLines * sizeof(TextCacheLine)) &&
+		writePadded(f, wordRecs, hdr.nWords * sizeof(TextCacheWord)) &&
+		writePadded(f, edges, (hdr.nChars + hdr.nWords) * sizeof(double)) &&
+		writePadded(f, chars, hdr.nChars * sizeof(Unicode));
+	if (f && fclose(f) != 0)
+		res = gFalse;
+	if (res && rename(tmpName->getCString(), cacheFileName) != 0)
+		res = gFalse;
+	if (!res) {
+		error(-1, "Couldn't write layout cache '%s'", cacheFileName);
+		unlink(tmpName->getCString());
+	}
+	delete tmpName;
+	gfree(blkRecs);
+	gfree(lineRecs);
+	gfree(wordRecs);
+	gfree(edges);
+	gfree(chars);
+	return res;
+}
+
+GBool TextPage::readCache(const char *cacheFileName, PDFDoc *doc, int pageNum) {
+	GMemScope memScope(gMemTagText);
+	struct stat st;
+	int fd;
+	
+	if ((fd = open(cacheFileName, O_RDONLY)) < 0)
+		return gFalse;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(TextCacheHeader)) {
+		close(fd);
+		return gFalse;
+	}
+	cacheDataLen = st.st_size;
+	cacheData = mmap(NULL, cacheDataLen, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (cacheData == MAP_FAILED) {
+		cacheData = NULL;
+		return gFalse;
+	}
+	
+	const char *p = (const char *)cacheData;
+	const TextCacheHeader *hdr = (const TextCacheHeader *)p;
+	TextCacheHeader docHdr;
+	getCacheFileID(doc, &docHdr);
+	if (hdr->magic != textCacheMagic || hdr->version != textCacheVersion ||
+		hdr->fileSize != doc->getFileSize() ||
+		hdr->fileMTime != doc->getFileMTime() ||
+		hdr->fileIDLen != docHdr.fileIDLen ||
+		memcmp(hdr->fileID, docHdr.fileID, textCacheIDSize) != 0 ||
+		hdr->pageNum != pageNum ||
+		hdr->nBlocks < 0 || hdr->nLines < hdr->nBlocks ||
+		hdr->nWords < hdr->nLines || hdr->nChars < 0 ||
+		hdr->nBlocks > (int)(cacheDataLen / sizeof(TextCacheBlock)) ||
+		hdr->nLines > (int)(cacheDataLen / sizeof(TextCacheLine)) ||
+		hdr->nWords > (int)(cacheDataLen / sizeof(TextCacheWord)) ||
+		hdr->nChars > (int)(cacheDataLen / sizeof(Unicode)))
+		return gFalse;
+	size_t off = textCacheAlign(sizeof(TextCacheHeader));
+	const TextCacheBlock *blkRecs = (const TextCacheBlock *)(p + off);
+	off += textCacheAlign(hdr->nBlocks * sizeof(TextCacheBlock));
+	const TextCacheLine *lineRecs = (const TextCacheLine *)(p + off);
+	off += textCacheAlign(hdr->nLines * sizeof(TextCacheLine));
+	const TextCacheWord *wordRecs = (const TextCacheWord *)(p + off);
+	off += textCacheAlign(hdr->nWords * sizeof(TextCacheWord));
+	double *edges = (double *)(p + off);
+	off += textCacheAlign((hdr->nChars + hdr->nWords) * sizeof(double));
+	Unicode *chars = (Unicode *)(p + off);
+	off += textCacheAlign(hdr->nChars * sizeof(Unicode));
+	if (off != cacheDataLen)
+		return gFalse;
+	
+	// anything out of range means a damaged or foreign file; the caller
+	// then lays the page out afresh
+	pageWidth = hdr->pageWidth;
+	pageHeight = hdr->pageHeight;
+	int l = 0, w = 0, e = 0, c = 0, index = 0;
+	for (int b = 0; b < hdr->nBlocks; ++b) {
+		int rot = blkRecs[b].rot;
+		if (rot < 0 || rot > 3)
+			return gFalse;
+		TextBlock *blk = new TextBlock(this, rot);
+		delete blk->pool;
+		blk->pool = NULL;
+		copyBox(blk, &blkRecs[b].box);
+		blk->prev = lastBlk;
+		if (lastBlk)
+			lastBlk->next = blk;
+		else
+			blocks = blk;
+		lastBlk = blk;
+		if (blkRecs[b].nLines <= 0 || blkRecs[b].nLines > hdr->nLines - l)
+			return gFalse;
+		for (int i = 0; i < blkRecs[b].nLines; ++i, ++l) {
+			if (lineRecs[l].rot != rot)
+				return gFalse;
+			TextLine *line = new TextLine(blk, lineRecs[l].rot, lineRecs[l].base);
+			copyBox(line, &lineRecs[l].box);
+			line->prev = blk->lastLine;
+			if (blk->lastLine)
+				blk->lastLine->next = line;
+			else
+				blk->lines = line;
+			blk->lastLine = line;
+			if (lineRecs[l].nWords <= 0 || lineRecs[l].nWords > hdr->nWords - w)
+				return gFalse;
+			for (int j = 0; j < lineRecs[l].nWords; ++j, ++w) {
+				const TextCacheWord *rec = &wordRecs[w];
+				if (rec->rot != rot ||
+					rec->len < 0 || rec->len > hdr->nChars - c ||
+					rec->index != index ||
+					(rec->spaceAfter != 0 && rec->spaceAfter != 1))
+					return gFalse;
+				index += rec->len + rec->spaceAfter;
+				TextWord *word = new TextWord(rec->rot);
+				copyBox(word, &rec->box);
+				word->line = line;
+				word->len = word->size = rec->len;
+				word->index = rec->index;
+				word->spaceAfter = rec->spaceAfter;
+				word->edge = edges + e;
+				word->text = chars + c;
+				e += rec->len + 1;
+				c += rec->len;
+				word->prev = line->lastWord;
+				if (line->lastWord)
+					line->lastWord->next = word;
+				else
+					line->words = word;
+				line->lastWord = word;
+			}
+		}
+	}
+	return l == hdr->nLines && w == hdr->nWords && c == hdr->nChars;
+}
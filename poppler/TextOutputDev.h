@@ -18,7 +18,9 @@
 #pragma interface
 #endif
 
+#include <stddef.h>
 #include "gtypes.h"
+#include "GooTimer.h"
 #include "OutputDev.h"
 
 class GooString;
@@ -59,6 +61,7 @@ class TextWord {
 private:
 	TextWord(GfxState *state, int rotA, double x0, double y0, int charPosA,
 			 TextFontInfo *fontA, double fontSize);
+	TextWord(int rotA);
 	~TextWord();
 	void addChar(GfxState *state, double x, double y, double dx, double dy,
 				 CharCode c, Unicode u);
@@ -71,6 +74,7 @@ private:
 	GBool endWith(Unicode *str, int length, GBool caseSen);
 	GBool strEq(Unicode *str, int length, GBool caseSen);
 	GBool contain(Unicode *str, int length, GBool caseSen);
+	void setNorm();
 	
 	TextLine *line;
 	TextWord *next;
@@ -199,15 +203,39 @@ private:
 	friend class TextPage;
 };
 
+//------------------------------------------------------------------------
+// TextSelection
+//------------------------------------------------------------------------
+
+// Selection state of a TextPage, with words referred to by their index so
+// that it can be moved to another TextPage built for the same page.
+struct TextSelection {
+	int startWord, startIdx;
+	int endWord, endIdx;
+	int saveIdx;
+};
+
 //------------------------------------------------------------------------
 // TextPage
 //------------------------------------------------------------------------
 
 class TextPage : public OutputDev {
 public:
-	TextPage(PDFDoc *doc, int pageNum);
+	// Interpretation stops once timeLimit seconds have passed, charLimit
+	// characters have been drawn (0 means no limit), or abortCheckCbk
+	// returns gTrue. The words seen so far are still laid out and the page
+	// is flagged incomplete.
+	TextPage(PDFDoc *doc, int pageNum, double timeLimit = 0, int charLimit = 0,
+			 GBool (*abortCheckCbk)(void *data) = NULL,
+			 void *abortCheckCbkData = NULL);
+	// Restore a layout saved by writeCache. The cache file is mapped and
+	// word text and edges are used in place. isOk() is gFalse if the file
+	// is missing, damaged, or stale for doc and pageNum.
+	TextPage(const char *cacheFileName, PDFDoc *doc, int pageNum);
 	~TextPage();
 	virtual GBool isOk() { return ok; }
+	// gFalse if the build was stopped before the end of the page.
+	GBool isComplete() { return !incomplete; }
 	virtual GBool upsideDown() { return gTrue; }
 	virtual GBool useDrawChar() { return gTrue; }
 	virtual GBool interpretType3Chars() { return gFalse; }
@@ -227,6 +255,11 @@ public:
 	int getSelEndIdx() { return selEnd ? selEnd->index + selIdx2 : -1; }
 	GooList *getSelectedRegion();
 	Unicode *getSelectedText(GBool normalize, int *length);
+	GBool getSelection(TextSelection *sel);
+	void setSelection(TextSelection *sel);
+	// Approximate number of bytes held by the page layout.
+	size_t getMemoryUsage() { return memUsage; }
+	GBool writeCache(const char *cacheFileName, PDFDoc *doc, int pageNum);
 	
 private:
 	void beginWord(GfxState *state, double x0, double y0);
@@ -236,6 +269,10 @@ private:
 	void endWord();
 	void addWord(TextWord *word);
 	void coalesce();
+	GBool readCache(const char *cacheFileName, PDFDoc *doc, int pageNum);
+	void countMemory();
+	static GBool budgetCheck(void *data);
+	TextWord *findWord(int index);
 	TextWord *findNearest(double x, double y, TextWord *start = NULL);
 	int calIdx(double x, double y, TextWord *&word);
 	
@@ -249,6 +286,13 @@ private:
 	GBool primaryLR;
 	
 	GBool ok;
+	GBool incomplete;
+	GooTimer buildTimer;
+	double timeLimit;		// in seconds, or 0
+	int charLimit;
+	int nChars;
+	GBool (*abortCheckCbk)(void *data);
+	void *abortCheckCbkData;
 	TextWord *curWord;
 	int charPos;
 	TextFontInfo *curFont;
@@ -263,6 +307,9 @@ private:
 	GBool newActualTextSpan;
 	double actualText_x, actualText_y;
 	double actualText_dx, actualText_dy;
+	void *cacheData;		// mapped layout cache, if restored from one
+	size_t cacheDataLen;
+	size_t memUsage;
 	
 	friend class TextWord;
 	friend class TextPool;
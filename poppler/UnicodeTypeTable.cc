@@ -20,6 +20,7 @@
 //========================================================================
 
 #include <stdlib.h>
+#include <string.h>
 #include "gtypes.h"
 #include "UnicodeTypeTable.h"
 #include "gmem.h"
@@ -988,36 +989,30 @@ Unicode unicodeToUpper(Unicode c) {
       ? CC_PART2(((u) - UNICODE_PART2_START) / 256, (u) % 256) \
       : 0))
 
+#include "UnicodeNormTables.h"
+
+// Look up the decomposition trie entry of @u. Characters past
+// UNICODE_LAST_CHAR_PART1 have no decompositions and only need their
+// combining class checked.
+static inline unsigned short decomp_trie_lookup(Unicode u) {
+  if (u > UNICODE_LAST_CHAR_PART1)
+    return COMBINING_CLASS(u) == 0 ? 0 : DECOMP_TRIE_NFKC_MAYBE;
+  return decomp_trie_data[decomp_trie_index[u >> 8]][u & 0xff];
+}
+
 // Write the compatibility decomposition of @u into @buf, returning the number 
 // of characters written. @buf may be NULL, in which case the length of the
 // decomposition is returned but nothing is written. If @u is its own
 // decomposition, write @u into @buf and return 1.
 static int decomp_compat(Unicode u, Unicode *buf) {
-  // decomposition tables stored as lists {character, decomp_length, offset}
-  // so we do a binary search
-  int start = 0, end = DECOMP_TABLE_LENGTH;
-  if (u >= decomp_table[start].character 
-      && u <= decomp_table[end - 1].character)
-    while (gTrue) {
-      int midpoint = (start + end) / 2;
-      if (u == decomp_table[midpoint].character) {
-	int offset = decomp_table[midpoint].offset;
-	if (offset == -1)
-	  break;
-	else {
-	  int length = decomp_table[midpoint].length, i;
-	  if (buf)
-	    for (i = 0; i < length; ++i)
-	      buf[i] = decomp_expansion[offset + i];
-	  return length;
-	}
-      } else if (midpoint == start)
-	break;
-      else if (u > decomp_table[midpoint].character)
-	start = midpoint;
-      else
-	end = midpoint;
-    }
+  int entry = decomp_trie_lookup(u) & DECOMP_TRIE_INDEX_MASK;
+  if (entry) {
+    const decomposition *d = &decomp_table[entry - 1];
+    if (buf)
+      for (int i = 0; i < d->length; ++i)
+	buf[i] = decomp_expansion[d->offset + i];
+    return d->length;
+  }
   if (buf)
     *buf = u;
   return 1;
@@ -1095,17 +1090,17 @@ static GBool combine(Unicode base, Unicode add, Unicode *out) {
       (((v) - HANGUL_V_BASE) + (HANGUL_V_COUNT * ((l) - HANGUL_L_BASE)))))
 #define HANGUL_COMPOSE_LV_T(lv, t) ((lv) + ((t) - HANGUL_T_BASE))
 
-// Converts Unicode string @in of length @len to its normalization in form 
-// NFKC (compatibility decomposition + canonical composition). The length of
-// the resulting Unicode string is returned in @out_len. If non-NULL, @indices
-// is assigned the location of a newly-allocated array of length @out_len + 1, 
-// for each character in the normalized string giving the index in @in of the 
-// corresponding unnormalized character. @indices is not guaranteed monotone or
-// onto.
-Unicode *unicodeNormalizeNFKC(Unicode *in, int len, 
-			      int *out_len, int **indices) {
-  Unicode *out;
-  int i, o, *classes, *idx = NULL;
+GBool unicodeIsNormalizedNFKC(Unicode *in, int len) {
+  for (int i = 0; i < len; ++i)
+    if (in[i] >= 0xa0 && (decomp_trie_lookup(in[i]) & DECOMP_TRIE_NFKC_MAYBE))
+      return gFalse;
+  return gTrue;
+}
+
+// Number of characters in the compatibility decomposition of @in, which
+// bounds both the normalized length and the scratch space needed for it.
+static int decompLength(Unicode *in, int len) {
+  int i, o;
 
   for (i = 0, o = 0; i < len; ++i) {
     if (HANGUL_IS_L(in[i]) || HANGUL_IS_SYLLABLE(in[i])) {
@@ -1113,11 +1108,14 @@ Unicode *unicodeNormalizeNFKC(Unicode *in, int len,
     } else
       o += decomp_compat(in[i], NULL);
   }
-  
-  out = (Unicode *) gmallocn(o, sizeof(Unicode));
-  classes = (int *) gmallocn(o, sizeof(int));
-  if (indices)
-    idx = (int *) gmallocn(o + 1, sizeof(int));
+  return o;
+}
+
+// Normalize @in into @out, which must have room for decompLength(@in, @len)
+// characters. If @idx is non-NULL it must be equally large and receives the
+// index in @in of each output character. Returns the normalized length.
+static int normalizeNFKC(Unicode *in, int len, Unicode *out, int *idx) {
+  int i, o;
 
   for (i = 0, o = 0; i < len; ) {
     Unicode u = in[i];
@@ -1140,7 +1138,7 @@ Unicode *unicodeNormalizeNFKC(Unicode *in, int len,
 	  out[o] = lv;
       } else
 	out[o] = u;
-      if (indices)
+      if (idx)
 	idx[o] = i;
       ++i; ++o;
     } else {
@@ -1152,22 +1150,20 @@ Unicode *unicodeNormalizeNFKC(Unicode *in, int len,
 	if (j != i && COMBINING_CLASS(u) == 0)
 	  break;
 	dlen = decomp_compat(u, out + p);
-	for (q = p; q < p + dlen; ++q) {
-	  classes[q] = COMBINING_CLASS(out[q]);
-	  if (indices)
+	if (idx)
+	  for (q = p; q < p + dlen; ++q)
 	    idx[q] = j;
-	}
 	p += dlen;
       }
-      // put out[o, p) in canonical ordering
+      // put out[o, p) in canonical ordering; runs of combining marks are
+      // short, so the classes are looked up again rather than cached
       for (q = o + 1; q < p; ++q)
 	for (r = q; r > o + 1; --r) { 	// FIXME worth using a better sort?
 	  int swap;
-	  if (classes[r] >= classes[r-1])
+	  if (COMBINING_CLASS(out[r]) >= COMBINING_CLASS(out[r-1]))
 	    break;
 	  u = out[r]; out[r] = out[r - 1]; out[r - 1] = u;
-	  swap = classes[r]; classes[r] = classes[r - 1]; classes[r - 1] = swap;
-	  if (indices) {
+	  if (idx) {
 	    swap = idx[r]; 
 	    idx[r] = idx[r - 1];
 	    idx[r - 1] = swap;
@@ -1181,7 +1177,7 @@ Unicode *unicodeNormalizeNFKC(Unicode *in, int len,
       if (q != o + 1)
 	for (r = q, s = o + 1; r < p; ++r, ++s) {
 	  out[s] = out[r];
-	  if (indices)
+	  if (idx)
 	    idx[s] = idx[r];
 	}
       else
@@ -1189,12 +1185,58 @@ Unicode *unicodeNormalizeNFKC(Unicode *in, int len,
       i = j; o = s;
     }
   }
+  return o;
+}
+
+// Converts Unicode string @in of length @len to its normalization in form 
+// NFKC (compatibility decomposition + canonical composition). The length of
+// the resulting Unicode string is returned in @out_len. If non-NULL, @indices
+// is assigned the location of a newly-allocated array of length @out_len + 1, 
+// for each character in the normalized string giving the index in @in of the 
+// corresponding unnormalized character. @indices is not guaranteed monotone or
+// onto.
+Unicode *unicodeNormalizeNFKC(Unicode *in, int len, 
+			      int *out_len, int **indices) {
+  Unicode *out;
+  int i, o, *idx = NULL;
+
+  if (unicodeIsNormalizedNFKC(in, len)) {
+    out = (Unicode *) gmallocn(len, sizeof(Unicode));
+    memcpy(out, in, len * sizeof(Unicode));
+    if (indices) {
+      idx = (int *) gmallocn(len + 1, sizeof(int));
+      for (i = 0; i <= len; ++i)
+	idx[i] = i;
+      *indices = idx;
+    }
+    *out_len = len;
+    return out;
+  }
+
+  o = decompLength(in, len);
+  out = (Unicode *) gmallocn(o, sizeof(Unicode));
+  if (indices)
+    idx = (int *) gmallocn(o + 1, sizeof(int));
+
+  o = normalizeNFKC(in, len, out, idx);
 
   *out_len = o;
-  gfree(classes);
   if (indices) {
     idx[o] = len;
     *indices = idx;
   }
   return out;
 }
+
+int unicodeNormalizeNFKCInto(Unicode *in, int len, Unicode *out, int out_size) {
+  int o;
+
+  if (unicodeIsNormalizedNFKC(in, len)) {
+    if (len <= out_size)
+      memcpy(out, in, len * sizeof(Unicode));
+    return len;
+  }
+  if ((o = decompLength(in, len)) > out_size)
+    return o;
+  return normalizeNFKC(in, len, out, NULL);
+}
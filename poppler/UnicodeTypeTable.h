@@ -28,7 +28,19 @@ extern GBool unicodeTypeR(Unicode c);
 
 extern Unicode unicodeToUpper(Unicode c);
 
+// Quick check: returns gTrue if @in is known to be unchanged by NFKC
+// normalization, without allocating. A gFalse result only means that the
+// full normalization has to be run.
+extern GBool unicodeIsNormalizedNFKC(Unicode *in, int len);
+
 extern Unicode *unicodeNormalizeNFKC(Unicode *in, int len, 
 				     int *out_len, int **offsets);
 
+// Normalizes @in into the caller-provided buffer @out of @out_size
+// characters. Returns the normalized length; if that is larger than
+// @out_size, @out is left untouched and the return value is the buffer
+// size required to retry.
+extern int unicodeNormalizeNFKCInto(Unicode *in, int len,
+				    Unicode *out, int out_size);
+
 #endif
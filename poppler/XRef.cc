@@ -35,6 +35,9 @@
 #include <string.h>
 #include <ctype.h>
 #include <limits.h>
+#if MULTITHREADED
+#include <pthread.h>
+#endif
 #include "gmem.h"
 #include "Object.h"
 #include "Stream.h"
@@ -45,6 +48,7 @@
 #include "ErrorCodes.h"
 #include "XRef.h"
 #include "PopplerCache.h"
+#include "Decrypt.h"
 
 //------------------------------------------------------------------------
 // Permission bits
@@ -61,6 +65,24 @@
 #define permHighResPrint  (1<<11) // bit 12
 #define defPermFlags 0xfffc
 
+//------------------------------------------------------------------------
+
+// Limits of the cache of decoded object streams, as a number of
+// streams and as an estimate of the memory held by their objects.
+#define objStrCacheSize  256
+#define objStrCacheBytes (4 << 20)
+
+// Limits of the cache of parsed uncompressed objects.
+#define objCacheSize  4096
+#define objCacheBytes (2 << 20)
+
+// max number of cached object decryption keys
+#define objKeysSize 1024
+
+// Limits of the cache of data decoded from shared streams.
+#define decodedDataSize  64
+#define decodedDataBytes (16 << 20)
+
 //------------------------------------------------------------------------
 // ObjectStream
 //------------------------------------------------------------------------
@@ -72,6 +94,15 @@ public:
   // generation 0.
   ObjectStream(XRef *xref, int objStrNumA);
 
+  // Create an object stream from <objStr>, which has already been
+  // fetched and whose /N and /First values were read by getParams.
+  ObjectStream(XRef *xref, int objStrNumA, Object *objStr,
+	       int nObjectsA, int first);
+
+  // Read the number of objects and the offset of the first one from
+  // the dictionary of <objStr>.
+  static GBool getParams(Object *objStr, int *nObjectsA, int *firstA);
+
   GBool isOk() { return ok; }
 
   ~ObjectStream();
@@ -79,6 +110,9 @@ public:
   // Return the object number of this object stream.
   int getObjStrNum() { return objStrNum; }
 
+  // Return the approximate memory held by the parsed objects.
+  size_t getBytes() { return bytes; }
+
   // Get the <objIdx>th object from this stream, which should be
   // object number <objNum>, generation 0.
   Object *getObject(int objIdx, int objNum, Object *obj);
@@ -89,7 +123,10 @@ private:
   int nObjects;			// number of objects in the stream
   Object *objs;			// the objects (length = nObjects)
   int *objNums;			// the object numbers (length = nObjects)
+  size_t bytes;			// estimate of the memory held by objs
   GBool ok;
+
+  void parse(XRef *xref, Object *objStr, int first);
 };
 
 class ObjectStreamKey : public PopplerCacheKey
@@ -105,6 +142,11 @@ class ObjectStreamKey : public PopplerCacheKey
       return objStrNum == k->objStrNum;
     }
 
+    unsigned int hash() const
+    {
+      return (unsigned int)objStrNum * 0x9e3779b1u;
+    }
+
     const int objStrNum;
 };
 
@@ -120,61 +162,179 @@ class ObjectStreamItem : public PopplerCacheItem
       delete objStream;
     }
 
+    size_t getBytes() const
+    {
+      return objStream->getBytes();
+    }
+
     ObjectStream *objStream;
 };
 
+//------------------------------------------------------------------------
+// parsed object cache
+//------------------------------------------------------------------------
+
+class FetchedObjectKey : public PopplerCacheKey
+{
+  public:
+    FetchedObjectKey(int numA, int genA) : num(numA), gen(genA)
+    {
+    }
+
+    bool operator==(const PopplerCacheKey &key) const
+    {
+      const FetchedObjectKey *k = static_cast<const FetchedObjectKey*>(&key);
+      return num == k->num && gen == k->gen;
+    }
+
+    unsigned int hash() const
+    {
+      return (unsigned int)num * 0x9e3779b1u + (unsigned int)gen;
+    }
+
+    const int num, gen;
+};
+
+// Estimate the memory held by <obj> and the direct objects in it.
+static size_t getObjectBytes(Object *obj, int depth) {
+  Object obj1;
+  size_t n;
+  int i;
+
+  n = sizeof(Object);
+  if (depth > 32) {
+    return n;
+  }
+  if (obj->isString()) {
+    n += sizeof(GooString) + obj->getString()->getLength();
+  } else if (obj->isArray()) {
+    n += sizeof(Array);
+    for (i = 0; i < obj->arrayGetLength(); ++i) {
+      n += getObjectBytes(obj->arrayGetNF(i, &obj1), depth + 1);
+      obj1.free();
+    }
+  } else if (obj->isDict()) {
+    n += sizeof(Dict);
+    for (i = 0; i < obj->dictGetLength(); ++i) {
+      n += getObjectBytes(obj->dictGetValNF(i, &obj1), depth + 1);
+      obj1.free();
+    }
+  }
+  return n;
+}
+
+class FetchedObjectItem : public PopplerCacheItem
+{
+  public:
+    FetchedObjectItem(Object *objA)
+    {
+      objA->copy(&obj);
+      bytes = getObjectBytes(&obj, 0);
+    }
+
+    ~FetchedObjectItem()
+    {
+      obj.free();
+    }
+
+    size_t getBytes() const
+    {
+      return bytes;
+    }
+
+    Object obj;
+    size_t bytes;
+};
+
+//------------------------------------------------------------------------
+// object decryption key cache
+//------------------------------------------------------------------------
+
+class ObjKeyItem : public PopplerCacheItem
+{
+  public:
+    DecryptObjKey objKey;
+};
+
 ObjectStream::ObjectStream(XRef *xref, int objStrNumA) {
-  Stream *str;
-  Parser *parser;
-  int *offsets;
-  Object objStr, obj1, obj2;
-  int first, i;
+  Object objStr;
+  int first;
 
   objStrNum = objStrNumA;
   nObjects = 0;
   objs = NULL;
   objNums = NULL;
+  bytes = 0;
   ok = gFalse;
 
-  if (!xref->fetch(objStrNum, 0, &objStr)->isStream()) {
-    goto err1;
+  if (xref->fetch(objStrNum, 0, &objStr)->isStream() &&
+      getParams(&objStr, &nObjects, &first)) {
+    parse(xref, &objStr, first);
   }
+  objStr.free();
+}
+
+ObjectStream::ObjectStream(XRef *xref, int objStrNumA, Object *objStr,
+			   int nObjectsA, int first) {
+  objStrNum = objStrNumA;
+  nObjects = nObjectsA;
+  objs = NULL;
+  objNums = NULL;
+  bytes = 0;
+  ok = gFalse;
 
-  if (!objStr.streamGetDict()->lookup("N", &obj1)->isInt()) {
+  parse(xref, objStr, first);
+}
+
+GBool ObjectStream::getParams(Object *objStr, int *nObjectsA, int *firstA) {
+  Object obj1;
+
+  if (!objStr->streamGetDict()->lookup("N", &obj1)->isInt()) {
     obj1.free();
-    goto err1;
+    return gFalse;
   }
-  nObjects = obj1.getInt();
+  *nObjectsA = obj1.getInt();
   obj1.free();
-  if (nObjects <= 0) {
-    goto err1;
+  if (*nObjectsA <= 0) {
+    return gFalse;
   }
 
-  if (!objStr.streamGetDict()->lookup("First", &obj1)->isInt()) {
+  if (!objStr->streamGetDict()->lookup("First", &obj1)->isInt()) {
     obj1.free();
-    goto err1;
+    return gFalse;
   }
-  first = obj1.getInt();
+  *firstA = obj1.getInt();
   obj1.free();
-  if (first < 0) {
-    goto err1;
+  if (*firstA < 0) {
+    return gFalse;
   }
 
   // this is an arbitrary limit to avoid integer overflow problems
   // in the 'new Object[nObjects]' call (Acrobat apparently limits
   // object streams to 100-200 objects)
-  if (nObjects > 1000000) {
+  if (*nObjectsA > 1000000) {
     error(-1, "Too many objects in an object stream");
-    goto err1;
+    return gFalse;
   }
+  return gTrue;
+}
+
+void ObjectStream::parse(XRef *xref, Object *objStr, int first) {
+  Stream *str;
+  Parser *parser;
+  int *offsets;
+  Object obj1, obj2;
+  size_t textLen;
+  int i;
+
   objs = new Object[nObjects];
   objNums = (int *)gmallocn(nObjects, sizeof(int));
   offsets = (int *)gmallocn(nObjects, sizeof(int));
 
   // parse the header: object numbers and offsets
-  objStr.streamReset();
+  objStr->streamReset();
   obj1.initNull();
-  str = new EmbedStream(objStr.getStream(), &obj1, gTrue, first);
+  str = new EmbedStream(objStr->getStream(), &obj1, gTrue, first);
   parser = new Parser(xref, new Lexer(xref, str), gFalse);
   for (i = 0; i < nObjects; ++i) {
     parser->getObj(&obj1);
@@ -184,7 +344,7 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA) {
       obj2.free();
       delete parser;
       gfree(offsets);
-      goto err1;
+      return;
     }
     objNums[i] = obj1.getInt();
     offsets[i] = obj2.getInt();
@@ -194,7 +354,7 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA) {
 	(i > 0 && offsets[i] < offsets[i-1])) {
       delete parser;
       gfree(offsets);
-      goto err1;
+      return;
     }
   }
   while (str->getChar() != EOF) ;
@@ -204,16 +364,16 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA) {
   // the First key is supposed to be equal to offsets[0], but just in
   // case...
   for (i = first; i < offsets[0]; ++i) {
-    objStr.getStream()->getChar();
+    objStr->getStream()->getChar();
   }
 
   // parse the objects
   for (i = 0; i < nObjects; ++i) {
     obj1.initNull();
     if (i == nObjects - 1) {
-      str = new EmbedStream(objStr.getStream(), &obj1, gFalse, 0);
+      str = new EmbedStream(objStr->getStream(), &obj1, gFalse, 0);
     } else {
-      str = new EmbedStream(objStr.getStream(), &obj1, gTrue,
+      str = new EmbedStream(objStr->getStream(), &obj1, gTrue,
 			    offsets[i+1] - offsets[i]);
     }
     parser = new Parser(xref, new Lexer(xref, str), gFalse);
@@ -222,11 +382,17 @@ ObjectStream::ObjectStream(XRef *xref, int objStrNumA) {
     delete parser;
   }
 
+  // estimate the memory held by the objects as twice the length of
+  // their source text, taking the last object to be of average length
+  textLen = offsets[nObjects - 1];
+  if (nObjects > 1) {
+    textLen += textLen / (nObjects - 1);
+  }
+  bytes = sizeof(ObjectStream) + nObjects * (sizeof(Object) + sizeof(int)) +
+          2 * textLen;
+
   gfree(offsets);
   ok = gTrue;
-
- err1:
-  objStr.free();
 }
 
 ObjectStream::~ObjectStream() {
@@ -260,7 +426,10 @@ void XRef::init() {
   size = 0;
   streamEnds = NULL;
   streamEndsLen = 0;
-  objStrs = new PopplerCache(5);
+  objStrs = new PopplerCache(objStrCacheSize, objStrCacheBytes);
+  objCache = new PopplerCache(objCacheSize, objCacheBytes);
+  objKeys = new PopplerCache(objKeysSize);
+  decodedData = new PopplerCache(decodedDataSize, decodedDataBytes);
   mainXRefEntriesOffset = 0;
   xRefStream = gFalse;
 }
@@ -270,6 +439,7 @@ XRef::XRef() {
 }
 
 XRef::XRef(BaseStream *strA, Guint pos, Guint mainXRefEntriesOffsetA, GBool *wasReconstructed, GBool reconstruct) {
+  GMemScope memScope(gMemTagObjects);
   Object obj;
 
   init();
@@ -363,6 +533,9 @@ XRef::~XRef() {
   if (objStrs) {
     delete objStrs;
   }
+  delete objCache;
+  delete objKeys;
+  delete decodedData;
 }
 
 int XRef::reserve(int newSize)
@@ -747,148 +920,263 @@ GBool XRef::readXRefStreamSection(Stream *xrefStr, int *w, int first, int n) {
   return gTrue;
 }
 
+//------------------------------------------------------------------------
+// xref reconstruction scanner
+//------------------------------------------------------------------------
+
+// Bytes read from the file per scan step.
+#define reconstructChunkSize 65536
+
+// Bytes kept from the previous step so that the backward checks in
+// scanIsSegmentStart and scanObjHeader can look past a chunk boundary.
+// Longer '<num> <gen> obj' prefixes are not recognized.
+#define reconstructContext 256
+
+// Longest keyword the scanner matches ("endstream").
+#define reconstructMaxToken 9
+
+// Find the next occurrence of <tok> starting in [from, limit) and
+// ending within the first <len> bytes of <buf>.  Candidates are
+// located with memchr on a rarely used byte of the keyword (<anchor>
+// is its index in <tok>), which libc implements with vector
+// instructions, and then confirmed with memcmp.  Returns -1 if there
+// is none.
+static int scanFindToken(const char *buf, int from, int limit, int len,
+			 const char *tok, int tokLen, int anchor) {
+  const char *p, *end;
+
+  if (limit > len - tokLen + 1) {
+    limit = len - tokLen + 1;
+  }
+  p = buf + from + anchor;
+  end = buf + limit + anchor;
+  while (p < end &&
+	 (p = (const char *)memchr(p, tok[anchor], end - p))) {
+    if (!memcmp(p - anchor, tok, tokLen)) {
+      return (int)(p - anchor - buf);
+    }
+    ++p;
+  }
+  return -1;
+}
+
+// Check whether the token at <i> is the first one of a line or follows
+// an 'endobj' on the same line; keywords anywhere else are ignored.  On
+// success, *<segStart> is set to the offset to record for the token:
+// the start of the line, or the token itself after an 'endobj'.
+static GBool scanIsSegmentStart(const char *buf, int i, GBool bufIsFileStart,
+				int *segStart) {
+  int j;
+
+  j = i;
+  while (j > 0 && buf[j - 1] != '\n' && buf[j - 1] != '\r' &&
+	 buf[j - 1] != '\0' && Lexer::isSpace(buf[j - 1] & 0xff)) {
+    --j;
+  }
+  if (j == 0) {
+    *segStart = 0;
+    return bufIsFileStart;
+  }
+  if (buf[j - 1] == '\n' || buf[j - 1] == '\r') {
+    *segStart = j;
+    return gTrue;
+  }
+  if (j >= 6 && !memcmp(buf + j - 6, "endobj", 6)) {
+    *segStart = i;
+    return gTrue;
+  }
+  return gFalse;
+}
+
+static inline GBool scanIsInlineSpace(char c) {
+  return c != '\n' && c != '\r' && isspace(c & 0xff);
+}
+
+// Check whether the 'obj' at <i> is preceded by "<num> <gen> " and
+// return the offset of <num> in *<numStart> and of <gen> in *<genStart>.
+static GBool scanObjHeader(const char *buf, int i,
+			   int *numStart, int *genStart) {
+  int j;
+
+  j = i;
+  if (j == 0 || !scanIsInlineSpace(buf[j - 1])) {
+    return gFalse;
+  }
+  while (j > 0 && scanIsInlineSpace(buf[j - 1])) {
+    --j;
+  }
+  if (j == 0 || !isdigit(buf[j - 1] & 0xff)) {
+    return gFalse;
+  }
+  while (j > 0 && isdigit(buf[j - 1] & 0xff)) {
+    --j;
+  }
+  *genStart = j;
+  if (j == 0 || !scanIsInlineSpace(buf[j - 1])) {
+    return gFalse;
+  }
+  while (j > 0 && scanIsInlineSpace(buf[j - 1])) {
+    --j;
+  }
+  if (j == 0 || !isdigit(buf[j - 1] & 0xff)) {
+    return gFalse;
+  }
+  while (j > 0 && isdigit(buf[j - 1] & 0xff)) {
+    --j;
+  }
+  *numStart = j;
+  return gTrue;
+}
+
 // Attempt to construct an xref table for a damaged file.
 GBool XRef::constructXRef(GBool *wasReconstructed) {
   Parser *parser;
   Object newTrailerDict, obj;
-  char buf[256];
-  Guint pos;
+  char *buf;
+  Guint bufPos, filePos, *trailers;
+  int bufLen, n, from, limit, keep, i, segStart, numStart, genStart;
   int num, gen;
   int newSize;
-  int streamEndsSize;
-  char *p;
-  GBool gotRoot;
-  char* token = NULL;
-  bool oneCycle = true;
-  int offset = 0;
+  int streamEndsSize, trailersLen, trailersSize;
+  GBool gotRoot, eof;
 
   gfree(entries);
   capacity = 0;
   size = 0;
   entries = NULL;
 
+  // objects parsed so far may have come from wrong offsets
+  delete objCache;
+  objCache = new PopplerCache(objCacheSize, objCacheBytes);
+  delete decodedData;
+  decodedData = new PopplerCache(decodedDataSize, decodedDataBytes);
+
   error(-1, "PDF file is damaged - attempting to reconstruct xref table...");
   gotRoot = gFalse;
   streamEndsLen = streamEndsSize = 0;
+  trailers = NULL;
+  trailersLen = trailersSize = 0;
 
   if (wasReconstructed)
   {
     *wasReconstructed = true;
   }
 
+  // The file is read in large blocks instead of line by line.  Each
+  // block is first searched for the 'obj', 'trailer' and 'endstream'
+  // keywords; every hit is then validated against the bytes in front
+  // of it, which the previous block leaves in <buf>.
+  buf = (char *)gmalloc(reconstructContext + reconstructMaxToken +
+			reconstructChunkSize);
   str->reset();
-  while (1) {
-    pos = str->getPos();
-    if (!str->getLine(buf, 256)) {
-      break;
+  filePos = bufPos = str->getPos();
+  bufLen = 0;
+  from = 0;
+  eof = gFalse;
+  while (!eof) {
+    n = str->doGetChars(reconstructChunkSize, (Guchar *)buf + bufLen);
+    bufLen += n;
+    eof = n < reconstructChunkSize;
+    limit = eof ? bufLen : bufLen - reconstructMaxToken;
+
+    // objects: "<num> <gen> obj"
+    i = from;
+    while ((i = scanFindToken(buf, i, limit, bufLen, "obj", 3, 2)) >= 0) {
+      if (scanObjHeader(buf, i, &numStart, &genStart) &&
+	  scanIsSegmentStart(buf, numStart, bufPos == filePos, &segStart) &&
+	  (num = atoi(buf + numStart)) > 0) {
+	gen = atoi(buf + genStart);
+	if (num >= size) {
+	  newSize = (num + 1 + 255) & ~255;
+	  if (newSize < 0) {
+	    error(-1, "Bad object number");
+	    gfree(buf);
+	    gfree(trailers);
+	    return gFalse;
+	  }
+	  if (resize(newSize) != newSize) {
+	    error(-1, "Invalid 'obj' parameters");
+	    gfree(buf);
+	    gfree(trailers);
+	    return gFalse;
+	  }
+	}
+	if (entries[num].type == xrefEntryFree ||
+	    gen >= entries[num].gen) {
+	  entries[num].offset = bufPos + segStart - start;
+	  entries[num].gen = gen;
+	  entries[num].type = xrefEntryUncompressed;
+	}
+      }
+      i += 3;
     }
-    p = buf;
-
-    // skip whitespace
-    while (*p && Lexer::isSpace(*p & 0xff)) ++p;
-
-    oneCycle = true;
-    offset = 0;
-
-    while( ( token = strstr( p, "endobj" ) ) || oneCycle ) {
-      oneCycle = false;
 
-      if( token ) {
-        oneCycle = true;
-        token[0] = '\0'; 
-        offset = token - p;
+    // trailer dictionaries are parsed once the scan is complete
+    i = from;
+    while ((i = scanFindToken(buf, i, limit, bufLen, "trailer", 7, 4)) >= 0) {
+      if (scanIsSegmentStart(buf, i, bufPos == filePos, &segStart)) {
+	if (trailersLen == trailersSize) {
+	  trailersSize += 16;
+	  trailers = (Guint *)greallocn(trailers, trailersSize, sizeof(Guint));
+	}
+	trailers[trailersLen++] = bufPos + i;
       }
+      i += 7;
+    }
 
-      // got trailer dictionary
-      if (!strncmp(p, "trailer", 7)) {
-        obj.initNull();
-        parser = new Parser(NULL,
-		 new Lexer(NULL,
-		   str->makeSubStream(pos + 7, gFalse, 0, &obj)),
-		 gFalse);
-        parser->getObj(&newTrailerDict);
-        if (newTrailerDict.isDict()) {
-	  newTrailerDict.dictLookupNF("Root", &obj);
-	  if (obj.isRef()) {
-	    rootNum = obj.getRefNum();
-	    rootGen = obj.getRefGen();
-	    if (!trailerDict.isNone()) {
-	      trailerDict.free();
-	    }
-	    newTrailerDict.copy(&trailerDict);
-	    gotRoot = gTrue;
-	  }
-	  obj.free();
-        }
-        newTrailerDict.free();
-        delete parser;
-
-      // look for object
-      } else if (isdigit(*p)) {
-        num = atoi(p);
-        if (num > 0) {
-	  do {
-	    ++p;
-	  } while (*p && isdigit(*p));
-	  if (isspace(*p)) {
-	    do {
-	      ++p;
-	    } while (*p && isspace(*p));
-	    if (isdigit(*p)) {
-	      gen = atoi(p);
-	      do {
-	        ++p;
-	      } while (*p && isdigit(*p));
-	      if (isspace(*p)) {
-	        do {
-		  ++p;
-	        } while (*p && isspace(*p));
-	        if (!strncmp(p, "obj", 3)) {
-		  if (num >= size) {
-		    newSize = (num + 1 + 255) & ~255;
-		    if (newSize < 0) {
-		      error(-1, "Bad object number");
-		      return gFalse;
-		    }
-		    if (resize(newSize) != newSize) {
-		      error(-1, "Invalid 'obj' parameters");
-		      return gFalse;
-		    }
-		  }
-		  if (entries[num].type == xrefEntryFree ||
-		      gen >= entries[num].gen) {
-		    entries[num].offset = pos - start;
-		    entries[num].gen = gen;
-		    entries[num].type = xrefEntryUncompressed;
-		  }
-	        }
-	      }
-	    }
-	  }
-        }
-
-      } else if (!strncmp(p, "endstream", 9)) {
+    // stream ends
+    i = from;
+    while ((i = scanFindToken(buf, i, limit, bufLen, "endstream", 9, 2)) >= 0) {
+      if (scanIsSegmentStart(buf, i, bufPos == filePos, &segStart)) {
         if (streamEndsLen == streamEndsSize) {
 	  streamEndsSize += 64;
           if (streamEndsSize >= INT_MAX / (int)sizeof(int)) {
             error(-1, "Invalid 'endstream' parameter.");
+	    gfree(buf);
+	    gfree(trailers);
             return gFalse;
           }
 	  streamEnds = (Guint *)greallocn(streamEnds,
 					streamEndsSize, sizeof(int));
         }
-        streamEnds[streamEndsLen++] = pos;
+        streamEnds[streamEndsLen++] = bufPos + segStart;
       }
-      if( token ) {
-        p = token + 6;// strlen( "endobj" ) = 6
-        pos += offset + 6;// strlen( "endobj" ) = 6
-        while (*p && Lexer::isSpace(*p & 0xff)) {
-          ++p;
-          ++pos;
-        }
+      i += 9;
+    }
+
+    // keep the unscanned tail plus some context for the next block
+    keep = limit > reconstructContext ? limit - reconstructContext : 0;
+    memmove(buf, buf + keep, bufLen - keep);
+    bufLen -= keep;
+    bufPos += keep;
+    from = limit - keep;
+  }
+  gfree(buf);
+
+  for (i = 0; i < trailersLen; ++i) {
+    obj.initNull();
+    parser = new Parser(NULL,
+	       new Lexer(NULL,
+		 str->makeSubStream(trailers[i] + 7, gFalse, 0, &obj)),
+	       gFalse);
+    parser->getObj(&newTrailerDict);
+    if (newTrailerDict.isDict()) {
+      newTrailerDict.dictLookupNF("Root", &obj);
+      if (obj.isRef()) {
+	rootNum = obj.getRefNum();
+	rootGen = obj.getRefGen();
+	if (!trailerDict.isNone()) {
+	  trailerDict.free();
+	}
+	newTrailerDict.copy(&trailerDict);
+	gotRoot = gTrue;
       }
+      obj.free();
     }
+    newTrailerDict.free();
+    delete parser;
   }
+  gfree(trailers);
 
   if (gotRoot)
     return gTrue;
@@ -917,6 +1205,10 @@ void XRef::setEncryption(int permFlagsA, GBool ownerPasswordOkA,
   encVersion = encVersionA;
   encRevision = encRevisionA;
   encAlgorithm = encAlgorithmA;
+
+  // keys derived so far came from the previous file key
+  delete objKeys;
+  objKeys = new PopplerCache(objKeysSize);
 }
 
 GBool XRef::okToPrint(GBool ignoreOwnerPW) {
@@ -965,7 +1257,167 @@ GBool XRef::okToAssemble(GBool ignoreOwnerPW) {
   return (!ignoreOwnerPW && ownerPasswordOk) || (permFlags & permAssemble);
 }
 
+//------------------------------------------------------------------------
+// object stream preloading
+//------------------------------------------------------------------------
+
+// object stream data is read into buffers growing by this much
+#define preloadBufChunk (1 << 20)
+
+struct ObjectStreamJob {
+  int objStrNum;
+  int nObjects;
+  int first;
+  Object objStr;		// decoding stream over <buf>
+  char *buf;			// raw stream data
+  ObjectStream *result;
+};
+
+struct ObjectStreamJobList {
+  XRef *xref;
+  ObjectStreamJob *jobs;
+  int nJobs;
+  int next;			// next job to take
+};
+
+static void *preloadObjectStreamsThread(void *arg) {
+  ObjectStreamJobList *list = (ObjectStreamJobList *)arg;
+  ObjectStreamJob *job;
+  int i;
+
+#if MULTITHREADED
+  while ((i = __sync_fetch_and_add(&list->next, 1)) < list->nJobs) {
+#else
+  while ((i = list->next++) < list->nJobs) {
+#endif
+    job = &list->jobs[i];
+    if (!job->objStr.isStream()) {
+      continue;
+    }
+    job->result = new ObjectStream(list->xref, job->objStrNum, &job->objStr,
+				   job->nObjects, job->first);
+    job->objStr.free();
+  }
+  return NULL;
+}
+
+void XRef::preloadObjectStreams(int nThreads) {
+  ObjectStreamJobList list;
+  ObjectStreamJob *job;
+  Object objStr, dictObj;
+  BaseStream *baseStr;
+  Stream *decStr;
+  DecryptObjKey objKey;
+  char *seen;
+  int num, len, i;
+#if MULTITHREADED
+  pthread_t *threads;
+  int nStarted;
+#endif
+
+  // collect the object streams referenced by the xref table
+  seen = (char *)gmallocn(size, sizeof(char));
+  memset(seen, 0, size);
+  list.xref = this;
+  list.jobs = NULL;
+  list.nJobs = 0;
+  list.next = 0;
+  for (i = 0; i < size; ++i) {
+    if (entries[i].type != xrefEntryCompressed) {
+      continue;
+    }
+    num = (int)entries[i].offset;
+    if (num <= 0 || num >= size || seen[num]) {
+      continue;
+    }
+    seen[num] = 1;
+    if (!(list.nJobs & 63)) {
+      list.jobs = (ObjectStreamJob *)greallocn(list.jobs, list.nJobs + 64,
+					       sizeof(ObjectStreamJob));
+    }
+    list.jobs[list.nJobs++].objStrNum = num;
+  }
+  gfree(seen);
+
+  // make room for all of them in the cache
+  objStrs->setLimits(list.nJobs > objStrCacheSize ? list.nJobs
+						  : objStrCacheSize, 0);
+
+  // read the raw data of each stream on this thread, since all of
+  // them share the file position, and set up its filters over a copy
+  // in memory
+  for (i = 0; i < list.nJobs; ++i) {
+    job = &list.jobs[i];
+    job->objStr.initNull();
+    job->buf = NULL;
+    job->result = NULL;
+    if (objStrs->lookup(ObjectStreamKey(job->objStrNum)) ||
+	!fetch(job->objStrNum, 0, &objStr)->isStream() ||
+	!ObjectStream::getParams(&objStr, &job->nObjects, &job->first)) {
+      objStr.free();
+      continue;
+    }
+    baseStr = objStr.getStream()->getBaseStream();
+    // a bogus /Length only sets the first guess at the size, the
+    // buffer grows with the data actually there
+    len = baseStr->getLength();
+    if (len < 1) {
+      len = 1;
+    } else if (len > preloadBufChunk) {
+      len = preloadBufChunk;
+    }
+    job->buf = (char *)baseStr->toUnsignedChars(&len, len,
+						 preloadBufChunk);
+    baseStr->close();
+    dictObj.initDict(objStr.streamGetDict());
+    decStr = new MemStream(job->buf, 0, len, &dictObj);
+    if (encrypted) {
+      getObjKey(job->objStrNum, 0, &objKey);
+      decStr = new DecryptStream(decStr, &objKey, encAlgorithm);
+    }
+    decStr = decStr->addFilters(&dictObj);
+    job->objStr.initStream(decStr);
+    objStr.free();
+  }
+
+  // inflate and parse them in parallel
+#if MULTITHREADED
+  if (nThreads > list.nJobs) {
+    nThreads = list.nJobs;
+  }
+  threads = (pthread_t *)gmallocn(nThreads > 1 ? nThreads - 1 : 1,
+				  sizeof(pthread_t));
+  nStarted = 0;
+  for (i = 0; i < nThreads - 1; ++i) {
+    if (pthread_create(&threads[nStarted], NULL,
+		       &preloadObjectStreamsThread, &list) == 0) {
+      ++nStarted;
+    }
+  }
+  preloadObjectStreamsThread(&list);
+  for (i = 0; i < nStarted; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  gfree(threads);
+#else
+  preloadObjectStreamsThread(&list);
+#endif
+
+  for (i = 0; i < list.nJobs; ++i) {
+    job = &list.jobs[i];
+    if (job->result && job->result->isOk()) {
+      objStrs->put(new ObjectStreamKey(job->objStrNum),
+		   new ObjectStreamItem(job->result));
+    } else {
+      delete job->result;
+    }
+    gfree(job->buf);
+  }
+  gfree(list.jobs);
+}
+
 Object *XRef::fetch(int num, int gen, Object *obj, std::set<int> *fetchOriginatorNums) {
+  GMemScope memScope(gMemTagObjects);
   XRefEntry *e;
   Parser *parser;
   Object obj1, obj2, obj3;
@@ -983,6 +1435,16 @@ Object *XRef::fetch(int num, int gen, Object *obj, std::set<int> *fetchOriginato
     return obj;
   }
 
+  // objects parsed before are shared: dictionaries and arrays are
+  // reference counted and must not be modified by the caller
+  if (e->type == xrefEntryUncompressed) {
+    FetchedObjectItem *item =
+        static_cast<FetchedObjectItem *>(objCache->lookup(FetchedObjectKey(num, gen)));
+    if (item) {
+      return item->obj.copy(obj);
+    }
+  }
+
   if (fetchOriginatorNums == NULL) {
     fetchOriginatorNums = new std::set<int>();
     deleteFetchOriginatorNums = true;
@@ -1042,6 +1504,10 @@ Object *XRef::fetch(int num, int gen, Object *obj, std::set<int> *fetchOriginato
     obj2.free();
     obj3.free();
     delete parser;
+    // streams carry a read position, so each fetch gets its own
+    if (!obj->isStream()) {
+      objCache->put(new FetchedObjectKey(num, gen), new FetchedObjectItem(obj));
+    }
     break;
 
   case xrefEntryCompressed:
@@ -1104,6 +1570,34 @@ Object *XRef::getDocInfoNF(Object *obj) {
   return trailerDict.dictLookupNF("Info", obj);
 }
 
+void XRef::getObjKey(int num, int gen, DecryptObjKey *objKey) {
+  ObjKeyItem *item;
+
+  item = static_cast<ObjKeyItem *>(objKeys->lookup(FetchedObjectKey(num, gen)));
+  if (!item) {
+    item = new ObjKeyItem();
+    Decrypt::makeObjKey(fileKey, encAlgorithm, keyLength, num, gen,
+			&item->objKey);
+    objKeys->put(new FetchedObjectKey(num, gen), item);
+  }
+  *objKey = item->objKey;
+}
+
+PopplerCacheItem *XRef::lookupDecodedData(int num, int gen) {
+  return decodedData->lookup(FetchedObjectKey(num, gen));
+}
+
+void XRef::putDecodedData(int num, int gen, PopplerCacheItem *item) {
+  decodedData->put(new FetchedObjectKey(num, gen), item);
+}
+
+void XRef::getObjStrCacheStats(unsigned long *hits, unsigned long *misses,
+			       size_t *bytes) {
+  *hits = objStrs->getHits();
+  *misses = objStrs->getMisses();
+  *bytes = objStrs->numberOfBytes();
+}
+
 GBool XRef::getStreamEnd(Guint streamStart, Guint *streamEnd) {
   int a, b, m;
 
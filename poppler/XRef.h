@@ -41,6 +41,8 @@ class Dict;
 class Stream;
 class Parser;
 class PopplerCache;
+class PopplerCacheItem;
+struct DecryptObjKey;
 
 //------------------------------------------------------------------------
 // XRef
@@ -103,6 +105,26 @@ public:
   // Fetch an indirect reference.
   Object *fetch(int num, int gen, Object *obj, std::set<int> *fetchOriginatorNums = NULL);
 
+  // Decode all object streams and keep them in the cache, so that
+  // fetching compressed objects no longer inflates anything.  The
+  // cache's byte limit is dropped and its entry limit raised to the
+  // number of object streams (but not below the default of 256), so
+  // every stream fits.  The streams are read on the calling thread and
+  // decoded by <nThreads> threads (including the calling one).
+  void preloadObjectStreams(int nThreads);
+
+  // Get the decryption key of object <num, gen>.  Keys are derived
+  // once and cached.
+  void getObjKey(int num, int gen, DecryptObjKey *objKey);
+
+  // Data decoded from stream <num, gen> once, for all the streams that
+  // refer to it, e.g. JBIG2 globals.  lookupDecodedData returns NULL if
+  // none is cached; the item may be deleted by the next putDecodedData,
+  // so callers keep their own reference to what it holds.
+  // putDecodedData takes ownership of <item>.
+  PopplerCacheItem *lookupDecodedData(int num, int gen);
+  void putDecodedData(int num, int gen, PopplerCacheItem *item);
+
   // Return the document's Info dictionary (if any).
   Object *getDocInfo(Object *obj);
   Object *getDocInfoNF(Object *obj);
@@ -114,6 +136,10 @@ public:
   int getRootNum() { return rootNum; }
   int getRootGen() { return rootGen; }
 
+  // Get the statistics of the cache of decoded object streams.
+  void getObjStrCacheStats(unsigned long *hits, unsigned long *misses,
+			   size_t *bytes);
+
   // Get end position for a stream in a damaged file.
   // Returns false if unknown or file is not damaged.
   GBool getStreamEnd(Guint streamStart, Guint *streamEnd);
@@ -142,6 +168,9 @@ private:
 				//   damaged files
   int streamEndsLen;		// number of valid entries in streamEnds
   PopplerCache *objStrs;	// cached object streams
+  PopplerCache *objCache;	// cached parsed uncompressed objects
+  PopplerCache *objKeys;	// cached object decryption keys
+  PopplerCache *decodedData;	// cached data decoded from shared streams
   GBool encrypted;		// true if file is encrypted
   int encRevision;		
   int encVersion;		// encryption algorithm